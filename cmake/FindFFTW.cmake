@@ -6,6 +6,10 @@
 #   - FFTW_INCLUDE_DIRS
 #   - FFTW_LIBRARIES
 #
+# and, when the MPI interface of FFTW is installed,
+#   - FFTW_MPI_FOUND
+#   - FFTW_MPI_LIBRARIES
+#
 
 find_path(FFTW_INCLUDE_DIRS
   fftw3.h
@@ -17,7 +21,20 @@ find_library(FFTW_LIBRARIES
   HINTS ${FFTW_DIR} ${CMAKE_INSTALL_PREFIX}
   PATHS_SUFFIXES lib)
 
+find_library(FFTW_MPI_LIBRARIES
+  NAMES fftw3_mpi
+  HINTS ${FFTW_DIR} ${CMAKE_INSTALL_PREFIX}
+  PATHS_SUFFIXES lib)
+find_path(FFTW_MPI_INCLUDE_DIR
+  fftw3-mpi.h
+  HINTS ${FFTW_DIR} ${CMAKE_INSTALL_PREFIX}
+  PATHS_SUFFIXES include)
+if(FFTW_MPI_LIBRARIES AND FFTW_MPI_INCLUDE_DIR)
+  set(FFTW_MPI_FOUND TRUE)
+endif()
+
 include(FindPackageHandleStandardArgs)
 find_package_handle_standard_args(
   FFTW DEFAULT_MSG FFTW_LIBRARIES FFTW_INCLUDE_DIRS)
-mark_as_advanced(FFTW_INCLUDE_DIRS FFTW_LIBRARIES)
+mark_as_advanced(FFTW_INCLUDE_DIRS FFTW_LIBRARIES FFTW_MPI_LIBRARIES
+  FFTW_MPI_INCLUDE_DIR)
@@ -0,0 +1,23 @@
+# Find the PAPI hardware performance counter library
+#
+# Set PAPI_DIR to the base directory where the package is installed
+#
+# Sets two variables
+#   - PAPI_INCLUDE_DIRS
+#   - PAPI_LIBRARIES
+#
+
+find_path(PAPI_INCLUDE_DIRS
+  papi.h
+  HINTS ${PAPI_ROOT} ${PAPI_DIR} ${CMAKE_INSTALL_PREFIX}
+  PATH_SUFFIXES include)
+
+find_library(PAPI_LIBRARIES
+  NAMES papi
+  HINTS ${PAPI_ROOT} ${PAPI_DIR} ${CMAKE_INSTALL_PREFIX}
+  PATH_SUFFIXES lib lib64)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(
+  PAPI DEFAULT_MSG PAPI_INCLUDE_DIRS PAPI_LIBRARIES)
+mark_as_advanced(PAPI_INCLUDE_DIRS PAPI_LIBRARIES)
@@ -0,0 +1,72 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ABLMESHGENERATOR_H
+#define ABLMESHGENERATOR_H
+
+#include "FieldTypeDef.h"
+
+#include <array>
+#include <string>
+
+namespace YAML {
+class Node;
+}
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Structured HEX_8 mesh of an atmospheric boundary layer box
+ *
+ *  The box is built in memory by the STK generated-mesh database, every rank
+ *  creating only its own slab of elements, so that neither a mesh file nor a
+ *  rebalance is needed. The generated index-space box has the vertical
+ *  direction along its first axis; map_coordinates() then maps it onto the
+ *  physical box with z vertical, which decomposes the mesh into slabs along
+ *  y. The vertical spacing grows geometrically from the lower boundary by
+ *  `vertical_stretching_ratio`.
+ *
+ *  The element block is `block_1` and the sidesets are `surface_1` (west,
+ *  x-min), `surface_2` (east), `surface_3` (south, y-min), `surface_4`
+ *  (north), `surface_5` (lower, z-min) and `surface_6` (upper).
+ */
+class ABLMeshGenerator
+{
+public:
+  explicit ABLMeshGenerator(const YAML::Node& node);
+
+  //! STK generated-mesh specification of the index-space box
+  std::string database_name() const;
+
+  //! Map the index-space model coordinates of every node onto the box
+  void
+  map_coordinates(const stk::mesh::BulkData& bulk, VectorFieldType& coords) const;
+
+  //! Height above the lower boundary of vertical grid level k
+  double level_height(const int k) const;
+
+  const std::array<int, 3>& num_elements() const { return numElements_; }
+
+private:
+  std::array<double, 3> lower_{{0.0, 0.0, 0.0}};
+  std::array<double, 3> upper_{{1.0, 1.0, 1.0}};
+  std::array<int, 3> numElements_{{1, 1, 1}};
+  double stretchingRatio_{1.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ABLMESHGENERATOR_H */
@@ -41,6 +41,7 @@ public:
   void initial_work();
   void initial_production();
   void initial_mdot();
+  //! Metric tensor and the terms of the averages that depend on it only
   void compute_metric_tensor();
   void predict_state();
   void post_iter_work();
@@ -53,6 +54,8 @@ private:
   ScalarFieldType* avgTkeResolved_;
   GenericFieldType* avgDudx_;
   GenericFieldType* metric_;
+  GenericFieldType* metric43_;
+  GenericFieldType* metricCoeffs_;
   ScalarFieldType* beta_;
 
   ScalarFieldType* resAdequacy_;
@@ -0,0 +1,139 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef AlgTraitsDispatch_h
+#define AlgTraitsDispatch_h
+
+#include <AlgTraits.h>
+
+#include <stk_topology/topology.hpp>
+#include <stk_util/util/ReportHandler.hpp>
+
+#include <utility>
+
+namespace sierra {
+namespace nalu {
+
+/** Run-time topology to compile-time AlgTraits
+ *
+ *  Calls f(AlgTraits{}) with the traits of the topology so that legacy bucket
+ *  loops can be written as templates on the traits, the way the kernels are
+ *  built by KernelBuilder, with fixed-size work arrays and non-virtual master
+ *  element calls. The callable is typically a generic lambda forwarding to a
+ *  member template, e.g.
+ *
+ *    dispatch_elem_topo(b.topology(), [&](auto traits) {
+ *      execute_bucket<decltype(traits)>(b);
+ *    });
+ */
+template <typename Functor>
+void dispatch_elem_topo(stk::topology topo, Functor&& f)
+{
+  switch(topo.value()) {
+    case stk::topology::HEX_8:
+      f(AlgTraitsHex8()); return;
+    case stk::topology::HEX_27:
+      f(AlgTraitsHex27()); return;
+    case stk::topology::TET_4:
+      f(AlgTraitsTet4()); return;
+    case stk::topology::PYRAMID_5:
+      f(AlgTraitsPyr5()); return;
+    case stk::topology::WEDGE_6:
+      f(AlgTraitsWed6()); return;
+    case stk::topology::QUAD_4_2D:
+      f(AlgTraitsQuad4_2D()); return;
+    case stk::topology::QUAD_9_2D:
+      f(AlgTraitsQuad9_2D()); return;
+    case stk::topology::TRI_3_2D:
+      f(AlgTraitsTri3_2D()); return;
+    default:
+      ThrowRequireMsg(false, "No AlgTraits for element topology " << topo.name());
+  }
+}
+
+//! face topology counterpart of dispatch_elem_topo
+template <typename Functor>
+void dispatch_face_topo(stk::topology topo, Functor&& f)
+{
+  switch(topo.value()) {
+    case stk::topology::QUAD_4:
+      f(AlgTraitsQuad4()); return;
+    case stk::topology::QUAD_9:
+      f(AlgTraitsQuad9()); return;
+    case stk::topology::TRI_3:
+      f(AlgTraitsTri3()); return;
+    case stk::topology::LINE_2:
+      f(AlgTraitsEdge_2D()); return;
+    case stk::topology::LINE_3:
+      f(AlgTraitsEdge3_2D()); return;
+    default:
+      ThrowRequireMsg(false, "No AlgTraits for face topology " << topo.name());
+  }
+}
+
+//! face/element pair counterpart, the pairs of build_face_elem_topo_kernel
+template <typename Functor>
+void dispatch_face_elem_topo(stk::topology faceTopo, stk::topology elemTopo, Functor&& f)
+{
+  switch(faceTopo.value()) {
+    case stk::topology::QUAD_4:
+      switch(elemTopo.value()) {
+        case stk::topology::HEX_8:
+          f(AlgTraitsQuad4Hex8()); return;
+        case stk::topology::PYRAMID_5:
+          f(AlgTraitsQuad4Pyr5()); return;
+        case stk::topology::WEDGE_6:
+          f(AlgTraitsQuad4Wed6()); return;
+        default:
+          break;
+      }
+      break;
+    case stk::topology::QUAD_9:
+      if (elemTopo == stk::topology::HEX_27) {
+        f(AlgTraitsQuad9Hex27()); return;
+      }
+      break;
+    case stk::topology::TRI_3:
+      switch(elemTopo.value()) {
+        case stk::topology::TET_4:
+          f(AlgTraitsTri3Tet4()); return;
+        case stk::topology::PYRAMID_5:
+          f(AlgTraitsTri3Pyr5()); return;
+        case stk::topology::WEDGE_6:
+          f(AlgTraitsTri3Wed6()); return;
+        default:
+          break;
+      }
+      break;
+    case stk::topology::LINE_2:
+      switch(elemTopo.value()) {
+        case stk::topology::TRI_3_2D:
+          f(AlgTraitsEdge2DTri32D()); return;
+        case stk::topology::QUAD_4_2D:
+          f(AlgTraitsEdge2DQuad42D()); return;
+        default:
+          break;
+      }
+      break;
+    case stk::topology::LINE_3:
+      if (elemTopo == stk::topology::QUAD_9_2D) {
+        f(AlgTraitsEdge32DQuad92D()); return;
+      }
+      break;
+    default:
+      break;
+  }
+  ThrowRequireMsg(false, "No AlgTraits for face " << faceTopo.name()
+    << " attached to element " << elemTopo.name());
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
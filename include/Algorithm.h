@@ -48,6 +48,11 @@ public:
 
   virtual void pre_work() {}
 
+  /** True if execute() restricts its entities with
+   *  Realm::assembly_phase_selector() and can run in two phases
+   */
+  virtual bool supports_split_phase() const { return false; }
+
   Realm &realm_;
   stk::mesh::PartVector partVec_;
   std::vector<SupplementalAlgorithm *> supplementalAlg_;
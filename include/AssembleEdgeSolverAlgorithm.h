@@ -60,16 +60,54 @@ public:
                               stk::mesh::selectUnion(partVec_) &
                               !(realm_.get_inactive_selector());
 
-    const auto& buckets = stk::mesh::get_bucket_ids(bulk, entityRank_, sel);
-    auto team_exec = get_device_team_policy(buckets.size(), bytes_per_team, bytes_per_thread);
-
     // Create local copies of class data for device capture
     const auto entityRank = entityRank_;
     const auto rhsSize = rhsSize_;
 
-    auto coeffApplier = coeff_applier();
+    if (realm_.use_edge_coloring()) {
+      build_colored_edge_lists(bulk, sel);
+
+      // no two edges of a color share a row, so the sums need no atomics
+      auto coeffApplier = coeff_applier(true);
+      const auto coloredEdges = coloredEdges_;
+
+      for (size_t c = 0; c + 1 < colorOffsets_.size(); ++c) {
+        const unsigned colorBegin = colorOffsets_[c];
+        const unsigned numColorEdges = colorOffsets_[c + 1] - colorBegin;
+        if (numColorEdges == 0)
+          continue;
+
+        const unsigned numChunks =
+          (numColorEdges + coloredChunkSize_ - 1) / coloredChunkSize_;
+        auto team_exec =
+          get_device_team_policy(numChunks, bytes_per_team, bytes_per_thread);
+
+        Kokkos::parallel_for(
+          team_exec, KOKKOS_LAMBDA(const DeviceTeamHandleType& team) {
+            ShmemDataType smdata(team, rhsSize);
+
+            const unsigned chunkBegin = team.league_rank() * coloredChunkSize_;
+            const unsigned chunkLen =
+              (chunkBegin + coloredChunkSize_ < numColorEdges)
+                ? coloredChunkSize_
+                : numColorEdges - chunkBegin;
+            Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team, chunkLen),
+              [&](const unsigned& k) {
+                const auto& fmi = coloredEdges(colorBegin + chunkBegin + k);
+                const auto edge =
+                  ngpMesh.get_bucket(entityRank, fmi.bucket_id)[fmi.bucket_ord];
+                assemble_edge(ngpMesh, edge, smdata, lambdaFunc, coeffApplier);
+              });
+          });
+      }
+      return;
+    }
+
+    const auto& buckets = stk::mesh::get_bucket_ids(bulk, entityRank_, sel);
+    auto team_exec = get_device_team_policy(buckets.size(), bytes_per_team, bytes_per_thread);
 
-    const auto nodesPerEntity = nodesPerEntity_;
+    auto coeffApplier = coeff_applier();
 
     Kokkos::parallel_for(
       team_exec, KOKKOS_LAMBDA(const DeviceTeamHandleType& team) {
@@ -82,28 +120,49 @@ public:
         Kokkos::parallel_for(
           Kokkos::TeamThreadRange(team, bktLen),
           [&](const size_t& bktIndex) {
-            auto edge = b[bktIndex];
-            const auto edgeIndex = ngpMesh.fast_mesh_index(edge);
-            smdata.ngpElemNodes = ngpMesh.get_nodes(entityRank, edgeIndex);
+            assemble_edge(ngpMesh, b[bktIndex], smdata, lambdaFunc, coeffApplier);
+          });
+      });
+  }
+
+  template<typename LambdaFunction>
+  KOKKOS_FUNCTION
+  static void assemble_edge(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Entity edge,
+    ShmemDataType& smdata,
+    const LambdaFunction& lambdaFunc,
+    const NGPApplyCoeff& coeffApplier)
+  {
+    const auto edgeIndex = ngpMesh.fast_mesh_index(edge);
+    smdata.ngpElemNodes = ngpMesh.get_nodes(entityRank_, edgeIndex);
 
-            const auto nodeL = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[0]);
-            const auto nodeR = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[1]);
+    const auto nodeL = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[0]);
+    const auto nodeR = ngpMesh.fast_mesh_index(smdata.ngpElemNodes[1]);
 
-            set_vals(smdata.rhs, 0.0);
-            set_vals(smdata.lhs, 0.0);
+    set_vals(smdata.rhs, 0.0);
+    set_vals(smdata.lhs, 0.0);
 
-            lambdaFunc(smdata, edgeIndex, nodeL, nodeR);
+    lambdaFunc(smdata, edgeIndex, nodeL, nodeR);
 
-            coeffApplier(
-              nodesPerEntity, smdata.ngpElemNodes, smdata.scratchIds,
-              smdata.sortPermutation, smdata.rhs, smdata.lhs, __FILE__);
-          });
-      });
+    coeffApplier.apply_edge(
+      edge, nodesPerEntity_, smdata.ngpElemNodes, smdata.scratchIds,
+      smdata.sortPermutation, smdata.rhs, smdata.lhs, __FILE__);
   }
 
 protected:
+  //! Group the selected edges by their Realm edge color
+  void build_colored_edge_lists(
+    const stk::mesh::BulkData& bulk, const stk::mesh::Selector& sel);
+
   ElemDataRequests dataNeeded_;
 
+  //! Selected edges ordered by color, delimited by colorOffsets_
+  Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace> coloredEdges_;
+  std::vector<unsigned> colorOffsets_;
+  size_t coloringSyncCount_{0};
+  static constexpr unsigned coloredChunkSize_{512};
+
   static constexpr stk::mesh::EntityRank entityRank_{stk::topology::EDGE_RANK};
   static constexpr int nodesPerEntity_{2};
   static constexpr int NDimMax_{3};
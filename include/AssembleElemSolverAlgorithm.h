@@ -18,9 +18,13 @@
 #include <SimdInterface.h>
 #include<ScratchViews.h>
 #include <SharedMemData.h>
+#include <NGPInstance.h>
 #include<CopyAndInterleave.h>
+#include <MasterElementGeometryCache.h>
+#include <utils/TeamSizeTuner.h>
 #include<FieldTypeDef.h>
 #include <stk_mesh/base/NgpMesh.hpp>
+#include <ngp_utils/NgpEntityList.h>
 #include <ngp_utils/NgpFieldManager.h>
 
 namespace stk {
@@ -65,24 +69,108 @@ public:
                            ? ElemReqType::ELEM : ElemReqType::FACE;
 
     const int bytes_per_team = 0;
-    const int bytes_per_thread = calculate_shared_mem_bytes_per_thread(
+    scratchPlan_ = plan_elem_scratch(
       lhsSize, rhsSize_, scratchIdsSize, meta_data.spatial_dimension(),
       dataNeededNGP, reqType);
+    const int bytes_per_thread = scratchPlan_.total_bytes();
 
-    stk::mesh::Selector elemSelector = meta_data.locally_owned_part() &
-                                       stk::mesh::selectUnion(partVec_) &
-                                       !realm_.get_inactive_selector();
+    const stk::mesh::Selector elemSelector = entity_selector();
 
-    const auto& elem_buckets =
-      stk::mesh::get_bucket_ids(bulk_data, entityRank_, elemSelector);
+    // opt-in reuse of master element geometry, shared across the block
+    const bool cacheGeometry = realm_.cacheMasterElementGeometry_ &&
+                               (entityRank_ == stk::topology::ELEM_RANK);
+    if (cacheGeometry) {
+      if (!geometryCache_)
+        geometryCache_ = realm_.shared_geometry_cache(entityRank_, partVec_);
+      geometryCache_->update(
+        bulk_data, elemSelector, dataNeededNGP, nDim,
+        realm_.geometry_cache_epoch());
+    }
+    const bool useGeometryCache = cacheGeometry && geometryCache_->is_active();
+    const auto geometryCache =
+      useGeometryCache ? *geometryCache_ : MasterElementGeometryCache();
 
     // Create local copies of class data
     const auto entityRank = entityRank_;
     const auto nodesPerEntity = nodesPerEntity_;
     const auto rhsSize = rhsSize_;
 
-    auto team_exec = sierra::nalu::get_device_team_policy(
-      elem_buckets.size(), bytes_per_team, bytes_per_thread);
+    if (realm_.coalesceElementBuckets_) {
+      build_coalesced_entity_list(bulk_data, elemSelector);
+
+      const auto entities = coalescedEntities_;
+      const unsigned numEntities = entities.size();
+      const unsigned chunkSize = realm_.coalescedChunkSize_;
+      TunedTeamLaunch launch(launch_key() + "_coalesced");
+      auto team_exec = launch.policy(
+        entities.num_chunks(chunkSize), bytes_per_team, bytes_per_thread);
+      Kokkos::parallel_for(
+        team_exec,
+        KOKKOS_LAMBDA(const sierra::nalu::DeviceTeamHandleType& team) {
+          SharedMemData<DeviceTeamHandleType, DeviceShmem> smdata(
+            team, nDim, dataNeededNGP, nodesPerEntity, rhsSize);
+
+          const unsigned chunkBegin = team.league_rank() * chunkSize;
+          const unsigned chunkLen = (chunkBegin + chunkSize < numEntities)
+                                      ? chunkSize
+                                      : numEntities - chunkBegin;
+          const size_t numSimdGroups = get_num_simd_groups(chunkLen);
+
+          Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(team, numSimdGroups),
+            [&](const size_t& groupIndex) {
+              const unsigned first = chunkBegin + groupIndex * simdLen;
+              int numSimdElems =
+                get_length_of_next_simd_group(groupIndex, chunkLen);
+              smdata.numSimdElems = numSimdElems;
+
+              // a SIMD group may span the end of a bucket
+              for (int simdElemIndex = 0; simdElemIndex < numSimdElems;
+                   ++simdElemIndex) {
+                const auto& elemIndex = entities(first + simdElemIndex);
+                stk::mesh::Entity element = ngpMesh.get_bucket(
+                  entityRank, elemIndex.bucket_id)[elemIndex.bucket_ord];
+                smdata.ngpElemNodes[simdElemIndex] =
+                  ngpMesh.get_nodes(entityRank, elemIndex);
+                fill_pre_req_data(
+                  dataNeededNGP, ngpMesh, entityRank, element,
+                  *smdata.prereqData[0]);
+#ifndef KOKKOS_ENABLE_CUDA
+                interleave_lane(
+                  *smdata.prereqData[0], simdElemIndex, smdata.simdPrereqData);
+#endif
+              }
+
+#ifndef KOKKOS_ENABLE_CUDA
+              zero_unused_lanes(smdata.simdPrereqData, numSimdElems);
+#endif
+
+              // the cache stores the same selection in the same bucket order,
+              // so consecutive entities map to consecutive cache rows
+              if (useGeometryCache) {
+                const auto& firstIndex = entities(first);
+                geometryCache.fill_master_element_views(
+                  dataNeededNGP, smdata.simdPrereqData, firstIndex.bucket_id,
+                  firstIndex.bucket_ord, numSimdElems);
+              } else {
+                fill_master_element_views(
+                  dataNeededNGP, smdata.simdPrereqData);
+              }
+              lambdaFunc(smdata);
+            });
+        });
+
+      if (useGeometryCache)
+        geometryCache_->set_current();
+      return;
+    }
+
+    const auto& elem_buckets =
+      stk::mesh::get_bucket_ids(bulk_data, entityRank_, elemSelector);
+
+    TunedTeamLaunch launch(launch_key());
+    auto team_exec =
+      launch.policy(elem_buckets.size(), bytes_per_team, bytes_per_thread);
     Kokkos::parallel_for(
       team_exec, KOKKOS_LAMBDA(const sierra::nalu::DeviceTeamHandleType& team) {
         auto bktId = elem_buckets.device_get(team.league_rank());
@@ -115,19 +203,53 @@ public:
                 ngpMesh.get_nodes(entityRank, elemIndex);
               fill_pre_req_data(
                 dataNeededNGP, ngpMesh, entityRank, element,
-                *smdata.prereqData[simdElemIndex]);
+                *smdata.prereqData[0]);
+#ifndef KOKKOS_ENABLE_CUDA
+              // No need to interleave on GPUs
+              interleave_lane(
+                *smdata.prereqData[0], simdElemIndex, smdata.simdPrereqData);
+#endif
             }
 
 #ifndef KOKKOS_ENABLE_CUDA
-            // No need to interleave on GPUs
-            copy_and_interleave(
-              smdata.prereqData, numSimdElems, smdata.simdPrereqData);
+            zero_unused_lanes(smdata.simdPrereqData, numSimdElems);
 #endif
 
-            fill_master_element_views(dataNeededNGP, smdata.simdPrereqData);
+            if (useGeometryCache) {
+              geometryCache.fill_master_element_views(
+                dataNeededNGP, smdata.simdPrereqData, bktId, bktIndex * simdLen,
+                numSimdElems);
+            } else {
+              fill_master_element_views(dataNeededNGP, smdata.simdPrereqData);
+            }
             lambdaFunc(smdata);
           });
       });
+
+    if (useGeometryCache)
+      geometryCache_->set_current();
+  }
+
+  //! Locally owned, active entities of this algorithm
+  stk::mesh::Selector entity_selector() const;
+
+  //! Key of the team launches of this algorithm in the TeamSizeTuner
+  std::string launch_key() const;
+
+  //! Flatten the selected buckets into one list of entities
+  void build_coalesced_entity_list(
+    const stk::mesh::BulkData& bulk, const stk::mesh::Selector& sel);
+
+  /** Accumulated entities and wall time of the assemblies
+   *
+   *  Only recorded when the Realm reports the assembly throughput.
+   */
+  size_t num_entities_assembled() const { return numEntitiesAssembled_; }
+  double assembly_time() const { return assemblyTime_; }
+  void reset_throughput()
+  {
+    numEntitiesAssembled_ = 0;
+    assemblyTime_ = 0.0;
   }
 
   ElemDataRequests dataNeededByKernels_;
@@ -137,6 +259,24 @@ public:
   double diagRelaxFactor_{1.0};
   unsigned nodesPerEntity_;
   int rhsSize_;
+
+  //! Stored master element geometry of the block, when the Realm enables it
+  std::shared_ptr<MasterElementGeometryCache> geometryCache_;
+
+  //! Selected entities in bucket order, rebuilt after mesh modification
+  nalu_ngp::EntityList<stk::mesh::NgpMesh> coalescedEntities_;
+  size_t coalescedSyncCount_{0};
+  bool hasCoalescedList_{false};
+
+  size_t numEntitiesAssembled_{0};
+  double assemblyTime_{0.0};
+
+  //! Per-thread scratch layout of the last launch
+  ElemScratchPlan scratchPlan_;
+  bool scratchReported_{false};
+
+  //! Device instances of the active kernels, refreshed in place
+  nalu_ngp::NGPInstanceView<Kernel> ngpKernels_;
 };
 
 } // namespace nalu
@@ -18,6 +18,7 @@
 #include <ScratchViews.h>
 #include <SimdInterface.h>
 #include <SharedMemData.h>
+#include <NGPInstance.h>
 #include <CopyAndInterleave.h>
 #include <stk_mesh/base/NgpMesh.hpp>
 #include <ngp_utils/NgpFieldManager.h>
@@ -165,6 +166,9 @@ public:
   unsigned nodesPerFace_;
   unsigned nodesPerElem_;
   int rhsSize_;
+
+  //! Device instances of the active kernels, refreshed in place
+  nalu_ngp::NGPInstanceView<Kernel> ngpKernels_;
 };
 
 } // namespace nalu
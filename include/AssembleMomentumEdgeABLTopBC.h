@@ -38,6 +38,9 @@
 #include<FieldTypeDef.h>
 #include<complex> // Must proceed fftw3.h in order to get native c complex
 #include<fftw3.h>
+#ifdef NALU_USES_FFTW_MPI
+#include<fftw3-mpi.h>
+#endif
 
 namespace stk {
 namespace mesh {
@@ -66,7 +69,8 @@ public:
     Realm &realm,
     stk::mesh::Part *part,
     EquationSystem *eqSystem, std::vector<int>& grid_dims_,
-    std::vector<int>& horiz_bcs_, double z_sample_);
+    std::vector<int>& horiz_bcs_, double z_sample_,
+    bool distributed_fft = false);
   virtual ~AssembleMomentumEdgeABLTopBC();
   virtual void initialize_connectivity();
 
@@ -101,6 +105,34 @@ public:
     std::vector<double>& vBC,
     std::vector<double>& wBC );
 
+#ifdef NALU_USES_FFTW_MPI
+  /** Builds the slab decomposition of the periodic-periodic transforms and
+    * the exchange patterns between the owners of the plane nodes and the
+    * owners of the slab rows.
+    */
+  void initialize_distributed_fft();
+
+  /** Distributed counterpart of potentialBCPeriodicPeriodic; the plane
+    * stays distributed in rows of y over all ranks.
+    * @param wSamp Input array containing the vertical velocity at the
+    * sampling plane nodes of this process, in nodeMapSamp_ order.
+    * @param UAvg Input array containing the average velocity over the
+    * sampling plane.
+    * @param uBC Output array containing the u velocty component at the
+    * upper boundary nodes of this process, in nodeMapBC_ order.
+    * @param vBC Output array containing the v velocty component at the
+    * upper boundary nodes of this process, in nodeMapBC_ order.
+    * @param wBC Output array containing the w velocty component at the
+    * upper boundary nodes of this process, in nodeMapBC_ order.
+    */
+  void potentialBCPeriodicPeriodicDistributed(
+    std::vector<double>& wSamp,
+    std::vector<double>& UAvg,
+    std::vector<double>& uBC,
+    std::vector<double>& vBC,
+    std::vector<double>& wBC );
+#endif
+
   /** Solves the potential flow problem for inflow-periodic conditions
     * in x and y.
     * @param wSamp Input array containing the vertical velocity on the
@@ -159,6 +191,23 @@ public:
   fftw_plan planFourier2dF_, planFourier2dB_, planSinx_, planCosx_,
             planFourierxF_, planFourierxB_,   planSiny_, planCosy_,
             planFourieryF_, planFourieryB_;
+
+  /** Distributed transform data; rows [localYStart_, localYStart_+localNy_)
+    * of the sampling plane live on this process, padded to 2*(nx/2+1) reals.
+    * The send/recv lists map the local plane nodes to slab positions, with
+    * per-process counts and displacements for MPI_Alltoallv.
+    */
+  bool distributedFFT_;
+#ifdef NALU_USES_FFTW_MPI
+  ptrdiff_t localNy_, localYStart_, allocLocal_;
+  double *slabReal_;
+  fftw_complex *slabU_, *slabV_, *slabW_;
+  fftw_plan planMpi2dF_, planMpi2dB_;
+  std::vector<int> sampSendIndex_, sampSendCounts_, sampSendDispl_,
+                   sampRecvPos_, sampRecvCounts_, sampRecvDispl_;
+  std::vector<int> bcRecvIndex_, bcRecvCounts_, bcRecvDispl_,
+                   bcServePos_, bcServeCounts_, bcServeDispl_;
+#endif
 };
 
 } // namespace nalu
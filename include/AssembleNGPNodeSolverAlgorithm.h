@@ -12,6 +12,8 @@
 #define ASSEMBLENGPNODESOLVERALGORITHM_H
 
 #include "SolverAlgorithm.h"
+#include "NGPInstance.h"
+#include "ngp_utils/NgpEntityList.h"
 
 #include <vector>
 #include <memory>
@@ -54,10 +56,20 @@ public:
     nodeKernels_.push_back(std::make_unique<T>(std::forward<Args>(args)...));
   }
 
+  NodeKernelVecType& node_kernels() { return nodeKernels_; }
+
 private:
   //! List of NodeKernels registered with this algorithm
   NodeKernelVecType nodeKernels_;
 
+  //! Device instances of the node kernels, refreshed in place
+  nalu_ngp::NGPInstanceView<NodeKernel> ngpKernels_;
+
+  //! Selected nodes in bucket order, rebuilt after mesh modification
+  nalu_ngp::EntityList<stk::mesh::NgpMesh> nodeList_;
+  size_t nodeListSyncCount_{0};
+  bool hasNodeList_{false};
+
   //! Number of DOFs per nodal entity
   const int rhsSize_;
 };
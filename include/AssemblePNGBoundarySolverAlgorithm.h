@@ -18,6 +18,7 @@
 namespace stk {
 namespace mesh {
 class Part;
+class Bucket;
 }
 }
 
@@ -39,6 +40,10 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  //! one face bucket with compile-time sizes
+  template <typename FaceTraits>
+  void execute_bucket(const stk::mesh::Bucket& b);
+
   ScalarFieldType *scalarQ_;
   GenericFieldType *exposedAreaVec_;
 };
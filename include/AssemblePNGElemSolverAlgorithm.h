@@ -18,6 +18,7 @@
 namespace stk {
 namespace mesh {
 class Part;
+class Bucket;
 }
 }
 
@@ -40,6 +41,10 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  //! one element bucket with compile-time sizes
+  template <typename AlgTraits>
+  void execute_bucket(const stk::mesh::Bucket& b);
+
   ScalarFieldType *scalarQ_;
   VectorFieldType *dqdx_;
   VectorFieldType *coordinates_;
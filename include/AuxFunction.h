@@ -60,6 +60,9 @@ public:
   }
   virtual void setup(const double /* time */) {}
 
+  unsigned begin_pos() const { return beginPos_; }
+  unsigned end_pos() const { return endPos_; }
+
 protected:
 
   // Derived classes must at_least implement this method
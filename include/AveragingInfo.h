@@ -64,6 +64,13 @@ public:
   std::vector<std::string> resolvedFieldNameVec_;
   std::vector<std::string> movingAvgFieldNameVec_;
 
+  // moving averages: one average per time scale, optionally stored as float
+  std::vector<double> movingAvgTimeScales_;
+  bool movingAvgSinglePrecision_{false};
+
+  // averages and statistics stored as float; updated in double precision
+  bool singlePrecision_{false};
+
 
   // vector of pairs of fields
   std::vector<std::pair<stk::mesh::FieldBase *, stk::mesh::FieldBase *> > favreFieldVecPair_;
@@ -0,0 +1,66 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef BlockCrsMatrixCopy_h
+#define BlockCrsMatrixCopy_h
+
+#include <LinearSolverTypes.h>
+
+#include <Teuchos_RCP.hpp>
+#include <Tpetra_BlockCrsMatrix.hpp>
+
+
+namespace sierra {
+namespace nalu {
+
+/** Block CRS copy of a point matrix with dense blocks of all node dofs
+ *
+ *  The multi-dof systems interleave the dofs of a node and couple every dof
+ *  of a node to every dof of its neighbors, so the point graph is made of
+ *  full `blockSize x blockSize` blocks. The copy stores one column index per
+ *  block instead of one per entry and is handed to Belos and Ifpack2 in
+ *  place of the point matrix. Assembly still goes through the point matrix;
+ *  update() scatters its values into the blocks on device before every
+ *  solve. Only the device map from point entries to block offsets is kept
+ *  besides the block matrix; the point matrix is not used by the solve.
+ */
+class BlockCrsMatrixCopy
+{
+public:
+  using BlockMatrix = Tpetra::BlockCrsMatrix<
+    LinSys::Scalar,
+    LinSys::LocalOrdinal,
+    LinSys::GlobalOrdinal,
+    LinSys::Node>;
+
+  BlockCrsMatrixCopy(
+    Teuchos::RCP<const LinSys::Matrix> matrix,
+    const LinSys::LocalOrdinal blockSize);
+
+  //! Copy the current values of the point matrix into the blocks on device
+  void update();
+
+  Teuchos::RCP<BlockMatrix> matrix() const { return blockMatrix_; }
+
+private:
+  using OffsetView = Kokkos::View<size_t*, LinSys::Matrix::device_type>;
+
+  Teuchos::RCP<const LinSys::Matrix> pointMatrix_;
+  Teuchos::RCP<LinSys::Graph> blockGraph_;
+  Teuchos::RCP<BlockMatrix> blockMatrix_;
+  const LinSys::LocalOrdinal blockSize_;
+
+  //! Offset in the row major block values of every point matrix entry
+  OffsetView pointToBlock_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -0,0 +1,261 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef BOUNDARYPLANESTREAM_H
+#define BOUNDARYPLANESTREAM_H
+
+#include "KokkosInterface.h"
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+class Part;
+typedef std::vector<Part*> PartVector;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Header of a boundary-plane file
+ *
+ *  The file holds the nodes of the boundary parts of a precursor realm,
+ *  ordered by global id: the magic "NALUBPL", a version, the name and
+ *  number of components of every field, the number of nodes and their
+ *  coordinates. The time levels follow, each one the time and then the
+ *  components of all fields node by node, so that every level has the same
+ *  size and is located from its index alone.
+ */
+struct BoundaryPlaneHeader
+{
+  std::vector<std::string> fieldNames_;
+  std::vector<int> fieldSizes_;
+  int64_t numNodes_{0};
+  std::vector<double> coordinates_;
+
+  //! Components of all fields at one node
+  int values_per_node() const;
+
+  //! Bytes of the header in the file
+  size_t header_bytes() const;
+
+  //! Bytes of one time level in the file
+  size_t level_bytes() const;
+
+  //! Number of complete time levels in a file of this size
+  int num_levels(const size_t fileBytes) const;
+
+  void write(std::ostream& out) const;
+  void read(std::istream& in);
+};
+
+//! Coordinates of the nodes, three per node in any dimension
+std::vector<double> boundary_plane_coordinates(
+  Realm& realm,
+  const stk::mesh::BulkData& bulk,
+  const std::vector<stk::mesh::Entity>& nodes);
+
+/** File node matching each local node
+ *
+ *  Nodes are matched by coordinates within `tolerance` in every direction;
+ *  throws if a local node has no match.
+ */
+std::vector<int64_t> match_boundary_plane_nodes(
+  const std::vector<double>& fileCoords,
+  const std::vector<double>& localCoords,
+  const double tolerance);
+
+/** Levels bracketing `time` and the linear weight of the upper level
+ *
+ *  Times before the first and after the last level are clamped to them.
+ *
+ *  @return false when the time was clamped
+ */
+bool bracket_boundary_plane_levels(
+  const std::vector<double>& times,
+  const double time,
+  int& lower,
+  int& upper,
+  double& weight);
+
+//! Device indices of the nodes with these global ids
+void boundary_plane_mesh_indices(
+  const stk::mesh::BulkData& bulk,
+  const std::vector<stk::mesh::EntityId>& nodeIds,
+  Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace>& nodes);
+
+/** Interpolate two levels linearly in time into the target fields on device
+ *
+ *  `fields` holds the target fields with the offset of their components in
+ *  the values of a node; the fields are marked modified on device.
+ */
+void interpolate_boundary_plane_levels(
+  const Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace>& nodes,
+  const Kokkos::View<double**, MemSpace>& levelA,
+  const Kokkos::View<double**, MemSpace>& levelB,
+  const double weight,
+  const std::vector<std::pair<const stk::mesh::FieldBase*, int>>& fields);
+
+/** Writer of the boundary-plane file of a precursor realm
+ *
+ *  At the configured frequency the owned nodes of the boundary parts are
+ *  gathered to rank 0, which appends one time level to the file. The
+ *  gather layout is computed once; the boundary parts must not change
+ *  during the run.
+ */
+class BoundaryPlaneWriter
+{
+public:
+  BoundaryPlaneWriter(Realm& realm, const YAML::Node& node);
+
+  void load(const YAML::Node& node);
+
+  // resolve the parts and fields, write the header
+  void initialize();
+
+  void execute(const int timeStepCount, const double currentTime);
+
+private:
+  Realm& realm_;
+  std::string fileName_;
+  int outputFreq_{1};
+  std::vector<std::string> targetNames_;
+  std::vector<std::string> fieldNames_;
+
+  stk::mesh::PartVector parts_;
+  std::vector<const stk::mesh::FieldBase*> fields_;
+  BoundaryPlaneHeader header_;
+
+  //! Locally owned plane nodes
+  std::vector<stk::mesh::Entity> nodes_;
+
+  //! Nodes gathered from every rank and their file order, on rank 0
+  std::vector<int> recvCounts_;
+  std::vector<int> recvDispls_;
+  std::vector<int64_t> fileOrder_;
+
+  size_t syncCount_{0};
+  std::ofstream file_;
+};
+
+/** Reader of a boundary-plane file into the inflow fields of a realm
+ *
+ *  Every local node of the target parts is matched to a node of the file
+ *  once. A background thread reads the local subset of the upcoming time
+ *  levels into a ring of `prefetch_levels` buffers while the solver
+ *  advances, so that the time step only waits on I/O when the solver
+ *  outruns the prefetch. At every external data transfer the two levels
+ *  bracketing the current time are interpolated linearly on device into
+ *  the target fields; a level is copied to the device once, when the
+ *  bracket first reaches it.
+ */
+class BoundaryPlaneReader
+{
+public:
+  BoundaryPlaneReader(Realm& realm, const YAML::Node& node);
+  ~BoundaryPlaneReader();
+
+  BoundaryPlaneReader(const BoundaryPlaneReader&) = delete;
+  BoundaryPlaneReader& operator=(const BoundaryPlaneReader&) = delete;
+
+  void load(const YAML::Node& node);
+
+  // read the header, match the nodes and start the prefetch thread
+  void initialize();
+
+  void execute(const double currentTime);
+
+private:
+  using LevelView = Kokkos::View<double**, MemSpace>;
+
+  struct Level
+  {
+    double time_{0.0};
+    std::vector<double> data_;
+  };
+
+  void read_level(
+    std::ifstream& file,
+    const int index,
+    std::vector<double>& buffer,
+    Level& level) const;
+  void prefetch_loop();
+
+  //! Wait for level `index`, releasing the ring slots of levels before `first`
+  const Level& acquire(const int first, const int index);
+  void upload(const Level& level, LevelView& view);
+
+  Realm& realm_;
+  std::string fileName_;
+  std::vector<std::string> targetNames_;
+  std::vector<std::pair<std::string, std::string>> fieldPairs_;
+  int prefetchLevels_{4};
+  double tolerance_{1.0e-6};
+
+  BoundaryPlaneHeader header_;
+  std::vector<double> times_;
+
+  //! Target fields and the offset of their components in a file node
+  std::vector<std::pair<const stk::mesh::FieldBase*, int>> fields_;
+
+  //! Local plane nodes, their file index and the range of file nodes read
+  std::vector<stk::mesh::EntityId> nodeIds_;
+  std::vector<int64_t> fileIndex_;
+  int64_t firstFileNode_{0};
+  int64_t numFileNodes_{0};
+
+  Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace> nodes_;
+  size_t syncCount_{0};
+
+  //! Levels on device and their indices
+  LevelView levelA_;
+  LevelView levelB_;
+  LevelView::HostMirror hostLevel_;
+  int indexA_{-1};
+  int indexB_{-1};
+  bool warnedClamp_{false};
+
+  //! Ring of prefetched levels; level i lives in slot i % prefetchLevels_
+  std::vector<Level> ring_;
+  int first_{0};
+  int nextRead_{0};
+  bool shutdown_{false};
+  std::exception_ptr readError_;
+
+  std::mutex mutex_;
+  std::condition_variable readCond_;
+  std::condition_variable doneCond_;
+  std::thread reader_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* BOUNDARYPLANESTREAM_H */
@@ -14,8 +14,11 @@
 
 #include<Algorithm.h>
 #include<FieldTypeDef.h>
+#include<NonConformalDeviceInfo.h>
 
 // stk
+#include <stk_mesh/base/NgpField.hpp>
+#include <stk_mesh/base/NgpMesh.hpp>
 #include <stk_mesh/base/Part.hpp>
 
 namespace sierra{
@@ -23,6 +26,57 @@ namespace nalu{
 
 class Realm;
 
+/** Non-conformal mass flow rate at one DgInfo point
+ *
+ *  Shared by the mdot algorithm and the continuity assembly; the latter
+ *  also needs the penalty, the time scale and the normals.
+ */
+struct NonConformalMdotKernel
+{
+  struct Result
+  {
+    double mdot;
+    double penalty;
+    double projTimeScale;
+    double areaMag;
+    double cNx[3];
+    double oNx[3];
+  };
+
+  NonConformalMdotKernel(
+    Realm &realm,
+    ScalarFieldType *pressure,
+    VectorFieldType *Gjp,
+    VectorFieldType *velocity,
+    VectorFieldType *meshVelocity,
+    ScalarFieldType *density,
+    GenericFieldType *exposedAreaVec,
+    const double meshMotionFac,
+    const double includePstab,
+    const bool useCurrentNormal);
+
+  //! Sync the fields to device; called on host before the kernel is used
+  void sync_to_device();
+
+  KOKKOS_FUNCTION
+  void operator()(const NonConformalDeviceInfo &info, const int pt, Result &res) const;
+
+  stk::mesh::NgpMesh ngpMesh_;
+  stk::mesh::NgpField<double> pressure_;
+  stk::mesh::NgpField<double> Gjp_;
+  stk::mesh::NgpField<double> velocity_;
+  stk::mesh::NgpField<double> meshVelocity_;
+  stk::mesh::NgpField<double> density_;
+  stk::mesh::NgpField<double> Udiag_;
+  stk::mesh::NgpField<double> exposedAreaVec_;
+
+  int nDim_;
+  double interpTogether_;
+  double meshMotionFac_;
+  double includePstab_;
+  bool useCurrentNormal_;
+};
+
 class ComputeMdotNonConformalAlgorithm : public Algorithm
 {
 public:
@@ -30,7 +30,12 @@ public:
   virtual void execute();
   
   VectorFieldType *coordinates_;
-  ScalarFieldType *maxLengthScale_;
+  stk::mesh::FieldBase *maxLengthScale_;
+
+private:
+  //! Max edge length, for the storage type T of the field
+  template<typename T>
+  void compute_max_length_scale();
 };
 
 } // namespace nalu
@@ -37,6 +37,10 @@ public:
 
   void execute();
 
+  //! one face bucket with compile-time sizes and master element tables
+  template <typename AlgTraits>
+  void execute_bucket(const stk::mesh::Bucket& b);
+
   void zero_nodal_fields();
 
   void compute_utau(
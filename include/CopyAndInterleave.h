@@ -55,7 +55,7 @@ void copy_and_interleave(const MultiDimViewsType ** data,
                          int simdElems,
                          SimdMultiDimViewsType& simdData)
 {
-  const double* src[stk::simd::ndoubles] = {nullptr};
+  const double* src[simdLen] = {nullptr};
   unsigned numViews = simdData.get_num_1D_views();
   for(unsigned viewIndex=0; viewIndex<numViews; ++viewIndex) {
     for(int simdIndex=0; simdIndex<simdElems; ++simdIndex) {
@@ -97,7 +97,7 @@ void copy_and_interleave(std::unique_ptr<ScratchViews<double>>* data,
                          ScratchViews<DoubleType>& simdData)
 {
     MultiDimViews<DoubleType, TeamHandleType, HostShmem>& simdFieldViews = simdData.get_field_views();
-    const MultiDimViews<double, TeamHandleType, HostShmem>* fViews[stk::simd::ndoubles] = {nullptr};
+    const MultiDimViews<double, TeamHandleType, HostShmem>* fViews[simdLen] = {nullptr};
 
     for(int simdIndex=0; simdIndex<simdElems; ++simdIndex) {
       fViews[simdIndex] = &data[simdIndex]->get_field_views();
@@ -107,6 +107,70 @@ void copy_and_interleave(std::unique_ptr<ScratchViews<double>>* data,
 }
 #endif
 
+/** Copy the field views of a single entity into one lane of the SIMD views
+ *
+ *  Lets one gather buffer be reused for every lane of a SIMD group instead of
+ *  holding simdLen buffers until the group is interleaved.
+ */
+template<typename MultiDimViewsType, typename SimdMultiDimViewsType>
+KOKKOS_INLINE_FUNCTION
+void interleave_lane(const MultiDimViewsType& data,
+                     int simdIndex,
+                     SimdMultiDimViewsType& simdData)
+{
+  for(unsigned v=0; v<simdData.get_num_1D_views(); ++v) {
+    interleave(simdData.get_1D_view_by_index(v), data.get_1D_view_by_index(v), simdIndex);
+  }
+  for(unsigned v=0; v<simdData.get_num_2D_views(); ++v) {
+    interleave(simdData.get_2D_view_by_index(v), data.get_2D_view_by_index(v), simdIndex);
+  }
+  for(unsigned v=0; v<simdData.get_num_3D_views(); ++v) {
+    interleave(simdData.get_3D_view_by_index(v), data.get_3D_view_by_index(v), simdIndex);
+  }
+}
+
+//! Zero the lanes of a partially filled SIMD group, as copy_and_interleave does
+template<typename SimdMultiDimViewsType>
+KOKKOS_INLINE_FUNCTION
+void zero_unused_lanes(SimdMultiDimViewsType& simdData, int simdElems)
+{
+  auto zero = [&](DoubleType* dptr, int dim) {
+    for(int i=0; i<dim; ++i) {
+      for(int simdIndex=simdElems; simdIndex<simdLen; ++simdIndex) {
+        stk::simd::set_data(dptr[i], simdIndex, 0.0);
+      }
+    }
+  };
+  for(unsigned v=0; v<simdData.get_num_1D_views(); ++v) {
+    auto& view = simdData.get_1D_view_by_index(v);
+    zero(view.data(), view.size());
+  }
+  for(unsigned v=0; v<simdData.get_num_2D_views(); ++v) {
+    auto& view = simdData.get_2D_view_by_index(v);
+    zero(view.data(), view.size());
+  }
+  for(unsigned v=0; v<simdData.get_num_3D_views(); ++v) {
+    auto& view = simdData.get_3D_view_by_index(v);
+    zero(view.data(), view.size());
+  }
+}
+
+#ifndef KOKKOS_ENABLE_CUDA
+inline
+void interleave_lane(const ScratchViews<double>& data,
+                     int simdIndex,
+                     ScratchViews<DoubleType>& simdData)
+{
+  interleave_lane(data.get_field_views(), simdIndex, simdData.get_field_views());
+}
+
+inline
+void zero_unused_lanes(ScratchViews<DoubleType>& simdData, int simdElems)
+{
+  zero_unused_lanes(simdData.get_field_views(), simdElems);
+}
+#endif
+
 KOKKOS_FUNCTION
 inline
 void extract_vector_lane(const SharedMemView<DoubleType*,DeviceShmem>& simdrhs, int simdIndex, SharedMemView<double*,DeviceShmem>& rhs)
@@ -0,0 +1,141 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef DATAPROBEDEVICESAMPLER_H
+#define DATAPROBEDEVICESAMPLER_H
+
+#include "KokkosInterface.h"
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+class Part;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class DataProbeSpecInfo;
+
+/** Samples the fields of one data probe specification on the device
+ *
+ *  Replaces the STK transfer used by DataProbePostProcessing. The owning
+ *  entity of every probe point and the associated shape function weights
+ *  are computed once on the host (and again only when the mesh moves); each
+ *  sample is then a device gather over the precomputed stencils into one
+ *  compact buffer. Only that buffer is copied to the host and sent to the
+ *  ranks owning the probe nodes, where it is written into the `*_probe`
+ *  fields so that the output writers are unchanged.
+ *
+ *  With statistics enabled, the samples are instead accumulated on the device
+ *  into a running mean and variance and, optionally, the power of the lowest
+ *  discrete Fourier modes over a window of samples; only these are sent to
+ *  the probe owners, into the `*_probe`, `*_probe_variance` and
+ *  `*_probe_spectrum` fields, when write_statistics is called.
+ */
+class DataProbeDeviceSampler
+{
+public:
+  DataProbeDeviceSampler(
+    Realm& realm,
+    const DataProbeSpecInfo& probeSpec,
+    const double searchTolerance);
+
+  //! Locate the probe points and compute the interpolation weights
+  void initialize();
+
+  //! Interpolate all fields and populate the probe node fields
+  void execute();
+
+  //! Number of probe points interpolated by this rank
+  int num_local_samples() const { return numMatches_; }
+
+  /** Accumulate statistics instead of populating every sample
+   *
+   *  Call before initialize(). With `numSpectrumBins` > 0, the power of the
+   *  Fourier modes 1 to `numSpectrumBins` of each window of
+   *  `samplesPerWindow` samples is accumulated too.
+   */
+  void enable_statistics(const int numSpectrumBins, const int samplesPerWindow);
+
+  //! Interpolate all fields and update the running statistics on the device
+  void accumulate();
+
+  //! Populate the probe node fields with the statistics and restart them
+  void write_statistics();
+
+  //! Interpolate all fields into the device sample buffer
+  void interpolate();
+
+private:
+  // send hostSamples_ to the probe owners and populate the probe node fields
+  void deliver();
+
+  // all probe point coordinates, ordered by the rank owning the probe node
+  void gather_probe_points(std::vector<double>& allCoords);
+  // communication pattern from the sampling ranks to the probe owners
+  void exchange_plan(const std::vector<int>& matchPoint);
+
+  Realm& realm_;
+  const DataProbeSpecInfo& probeSpec_;
+  const double searchTolerance_;
+
+  std::vector<stk::mesh::Part*> fromParts_;
+  std::vector<const stk::mesh::FieldBase*> fromFields_;
+  std::vector<stk::mesh::FieldBase*> toFields_;
+  std::vector<int> fieldOffset_;
+  int totalComp_{0};
+  // doubles per point in hostSamples_
+  int pointStride_{0};
+
+  // running statistics, see enable_statistics
+  bool statistics_{false};
+  int numBins_{0};
+  int samplesPerWindow_{1};
+  int numAccumulated_{0};
+  std::vector<stk::mesh::FieldBase*> varianceFields_;
+  std::vector<stk::mesh::FieldBase*> spectrumFields_;
+  Kokkos::View<double**, Kokkos::LayoutRight, MemSpace> mean_;
+  Kokkos::View<double**, Kokkos::LayoutRight, MemSpace> m2_;
+  Kokkos::View<double***, Kokkos::LayoutRight, MemSpace> modeRe_;
+  Kokkos::View<double***, Kokkos::LayoutRight, MemSpace> modeIm_;
+  Kokkos::View<double***, Kokkos::LayoutRight, MemSpace> power_;
+  Kokkos::View<double**, Kokkos::LayoutRight, MemSpace> statsBuffer_;
+
+  // probe nodes owned by this rank and the global offsets of each rank
+  std::vector<stk::mesh::Entity> localProbeNodes_;
+  std::vector<int> pointOffsets_;
+
+  // interpolation stencils of the points found in the local mesh
+  int numMatches_{0};
+  int maxNodes_{0};
+  Kokkos::View<stk::mesh::Entity**, Kokkos::LayoutRight, MemSpace> stencilNodes_;
+  Kokkos::View<double**, Kokkos::LayoutRight, MemSpace> stencilWeights_;
+  Kokkos::View<int*, MemSpace> stencilSize_;
+  Kokkos::View<double**, Kokkos::LayoutRight, MemSpace> samples_;
+  Kokkos::View<double**, Kokkos::LayoutRight, MemSpace>::HostMirror hostSamples_;
+
+  // samples are ordered by destination rank
+  std::vector<int> sendCounts_, sendDispls_;
+  std::vector<int> recvCounts_, recvDispls_;
+  std::vector<int> recvNodeIndex_;
+  std::vector<double> recvBuffer_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* DATAPROBEDEVICESAMPLER_H */
@@ -14,6 +14,10 @@
 
 #include "NaluParsedTypes.h"
 
+#include <mpi.h>
+
+#include <fstream>
+#include <future>
 #include <string>
 #include <vector>
 #include <utility>
@@ -43,6 +47,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class DataProbeDeviceSampler;
 class Transfer;
 class Transfers;
 
@@ -140,15 +145,31 @@ public:
   // create the transfer and hold the vector in the DataProbePostProcessing class
   void create_transfer();
 
+  // create the device samplers used in place of the transfer
+  void create_device_samplers();
+
   // optionally create an exodus database
   void create_exodus();
 
+  // optionally create the aggregated binary writer(s)
+  void create_binary();
+
   // populate nodal field and output norms (if appropriate)
   void execute();
 
   // output to a file
   void provide_output_txt(const double currentTime);
   void provide_output_exodus(const double currentTime);
+  void provide_output_binary(const double currentTime);
+
+  // write the buffered binary samples to disk (writer ranks only)
+  void flush_binary();
+
+  // wait for a background binary write to complete
+  void wait_binary();
+
+  // wait for the background writes of the text planes to complete
+  void wait_planes();
 
   
   // provide the inactive selector
@@ -181,6 +202,10 @@ public:
   // hold the transfers
   Transfers *transfers_;
 
+  // sample on the device instead of using the transfers
+  bool useDeviceSampling_;
+  std::vector<std::unique_ptr<DataProbeDeviceSampler>> deviceSamplers_;
+
 
   DataProbeSampleType probeType_;
 
@@ -190,10 +215,39 @@ private:
   double previousTime_;
   bool useExo_{false};
   bool useText_{false};
+  bool useBinary_{false};
   bool enablePerfTiming_{false};
   std::string exoName_;
   size_t fileIndex_;
   size_t precisionvar_;
+
+  // binary output: probes are gathered onto a few writer ranks, each keeping
+  // one file open and flushing every binaryFlushFreq_ samples; with
+  // binaryAsync_ the flush hands the buffer to a background write
+  std::string binaryName_{"data_probes"};
+  int numBinaryWriters_{1};
+  int binaryFlushFreq_{10};
+  int binarySamplesBuffered_{0};
+  MPI_Comm binaryComm_{MPI_COMM_NULL};
+  std::ofstream binaryFile_;
+  std::vector<char> binaryBuffer_;
+  bool binaryAsync_{false};
+  std::vector<char> binaryPending_;
+  std::future<void> binaryWrite_;
+
+  // device statistics: every statisticsSampleFreq_ steps the samples are
+  // accumulated on the device, and only the statistics are written at the
+  // output steps
+  bool accumulateStatistics_{false};
+  int statisticsSampleFreq_{1};
+  int spectrumBins_{0};
+  int spectrumWindow_{0};
+
+  // text planes: with planeAsync_ each plane of an output step is compressed
+  // and written by a background task, overlapping the following time step;
+  // the writes complete before the next text output
+  bool planeAsync_{false};
+  std::vector<std::future<void>> planeWrites_;
 };
 
 } // namespace nalu
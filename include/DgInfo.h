@@ -19,6 +19,7 @@
 #include <stk_mesh/base/Entity.hpp>
 #include <stk_topology/topology.hpp>
 
+#include <cstdint>
 #include <vector>
 
 namespace sierra {
@@ -101,14 +102,20 @@ class DgInfo {
   // master element for opposing face connected element
   MasterElement *meSCSOpposing_;
 
-  // coordinates of gauss points on current face
-  std::vector<double> currentGaussPointCoords_;
+  // coordinates of gauss points on current face; first nDim entries are used
+  double currentGaussPointCoords_[3];
 
   // iso-parametric coordinates for gauss point on current face (-1:1)
-  std::vector<double> currentIsoParCoords_;
+  double currentIsoParCoords_[3];
 
   // iso-parametric coordinates for gauss point on opposing face (-1:1)
-  std::vector<double> opposingIsoParCoords_;  
+  double opposingIsoParCoords_[3];
+
+  // gauss point minus its opposing point at the last coarse search
+  double searchOffset_[3];
+
+  // opposing candidates carried over from the last coarse search
+  bool searchCached_;
 
   // possible reuse
   std::vector<uint64_t> allOpposingFaceIds_;
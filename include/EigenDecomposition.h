@@ -250,6 +250,126 @@ sym_diagonalize(const T (&A)[3][3], T (&Q)[3][3], T (&D)[3][3])
   }
 }
 
+//--------------------------------------------------------------------------
+//-------- jacobi_rotation (3D) --------------------------------------------
+//--------------------------------------------------------------------------
+template <class T>
+KOKKOS_FUNCTION void
+jacobi_rotation(
+  T (&D)[3][3], T (&Q)[3][3], const int p, const int q, const int r)
+{
+  // rotation in the (p,q) plane annihilating D[p][q]; r is the third index.
+  // A zero off diagonal gives t = 0, the identity rotation
+  const T apq = D[p][q];
+  const auto isDiag = apq == 0.0;
+  const T theta = (D[q][q] - D[p][p]) /
+                  (2.0 * stk::math::if_then_else(isDiag, 1.0, apq));
+  const T sgn = stk::math::if_then_else(theta < 0.0, -1.0, 1.0);
+  const T absTheta = theta * sgn;
+
+  // sign(T)/(|T|+sqrt(T^2+1)), with the large T limit avoiding overflow
+  T t = stk::math::if_then_else(
+    absTheta < 1.E6, sgn / (absTheta + stk::math::sqrt(absTheta * absTheta + 1.0)),
+    0.5 * sgn / stk::math::if_then_else(absTheta < 1.E6, 1.0, absTheta));
+  t = stk::math::if_then_else(isDiag, 0.0, t);
+  const T c = 1.0 / stk::math::sqrt(t * t + 1.0);
+  const T s = t * c;
+
+  D[p][p] = D[p][p] - t * apq;
+  D[q][q] = D[q][q] + t * apq;
+  D[p][q] = 0.0;
+  D[q][p] = 0.0;
+
+  const T drp = D[r][p];
+  const T drq = D[r][q];
+  D[r][p] = c * drp - s * drq;
+  D[p][r] = D[r][p];
+  D[r][q] = s * drp + c * drq;
+  D[q][r] = D[r][q];
+
+  for (int k = 0; k < 3; ++k) {
+    const T qkp = Q[k][p];
+    const T qkq = Q[k][q];
+    Q[k][p] = c * qkp - s * qkq;
+    Q[k][q] = s * qkp + c * qkq;
+  }
+}
+
+//--------------------------------------------------------------------------
+//-------- symmetric diagonalize, fixed sweeps (3D) ------------------------
+//--------------------------------------------------------------------------
+/** Cyclic Jacobi diagonalization with a fixed number of sweeps
+ *
+ *  Same contract as sym_diagonalize: D = QT * A * Q and A = Q*D*QT. Every
+ *  lane performs the same rotations with no data-dependent exit, so that the
+ *  routine vectorizes over SIMD lanes and does not diverge on device. Each
+ *  sweep rotates the three off-diagonal pairs; convergence is quadratic and
+ *  the default number of sweeps reaches double precision for 3x3 matrices.
+ *  The eigenvalues are not sorted.
+ */
+template <int NumSweeps = 5, class T>
+KOKKOS_FUNCTION void
+sym_diagonalize_fixed_sweeps(const T (&A)[3][3], T (&Q)[3][3], T (&D)[3][3])
+{
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      D[i][j] = A[i][j];
+      Q[i][j] = (i == j) ? 1.0 : 0.0;
+    }
+  }
+
+  for (int sweep = 0; sweep < NumSweeps; ++sweep) {
+    jacobi_rotation(D, Q, 0, 1, 2);
+    jacobi_rotation(D, Q, 0, 2, 1);
+    jacobi_rotation(D, Q, 1, 2, 0);
+  }
+}
+
+//--------------------------------------------------------------------------
+//-------- symmetric diagonalize, batched (3D) -----------------------------
+//--------------------------------------------------------------------------
+/** Diagonalize a batch of symmetric 3x3 matrices in SIMD lanes
+ *
+ *  A and Q hold numMatrices row-major 3x3 matrices and lambda the three
+ *  eigenvalues of each matrix. The matrices are packed stk::simd::ndoubles at
+ *  a time into DoubleType and diagonalized with sym_diagonalize_fixed_sweeps;
+ *  the unused lanes of the last pack carry the identity.
+ */
+inline void
+sym_diagonalize_batch(
+  const int numMatrices, const double* A, double* Q, double* lambda)
+{
+  const int simdLen = stk::simd::ndoubles;
+  for (int start = 0; start < numMatrices; start += simdLen) {
+    const int numLanes =
+      (numMatrices - start < simdLen) ? numMatrices - start : simdLen;
+
+    DoubleType Av[3][3], Qv[3][3], Dv[3][3];
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 3; ++j)
+        Av[i][j] = (i == j) ? 1.0 : 0.0;
+
+    for (int l = 0; l < numLanes; ++l) {
+      const double* Al = A + 9 * (start + l);
+      for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+          stk::simd::set_data(Av[i][j], l, Al[3 * i + j]);
+    }
+
+    sym_diagonalize_fixed_sweeps(Av, Qv, Dv);
+
+    for (int l = 0; l < numLanes; ++l) {
+      double* Ql = Q + 9 * (start + l);
+      double* lambdal = lambda + 3 * (start + l);
+      for (int i = 0; i < 3; ++i) {
+        lambdal[i] = stk::simd::get_data(Dv[i][i], l);
+        for (int j = 0; j < 3; ++j)
+          Ql[3 * i + j] = stk::simd::get_data(Qv[i][j], l);
+      }
+    }
+  }
+}
+
 //--------------------------------------------------------------------------
 //-------- matrix_matrix_multiply 3D ---------------------------------------
 //--------------------------------------------------------------------------
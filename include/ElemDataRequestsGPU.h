@@ -19,6 +19,7 @@
 #include <stk_mesh/base/Ngp.hpp>
 #include <stk_mesh/base/GetNgpField.hpp>
 #include <ngp_utils/NgpFieldManager.h>
+#include <utils/SyncAudit.h>
 
 namespace sierra{
 namespace nalu{
@@ -27,12 +28,12 @@ struct FieldInfoNGP {
   FieldInfoNGP(const stk::mesh::FieldBase* fld, unsigned scalars)
   : field(stk::mesh::get_updated_ngp_field<double>(*fld)), scalarsDim1(scalars), scalarsDim2(0)
   {
-    field.sync_to_device();
+    NALU_SYNC_TO_DEVICE(field);
   }  
   FieldInfoNGP(const stk::mesh::FieldBase* fld, unsigned tensorDim1, unsigned tensorDim2)
   : field(stk::mesh::get_updated_ngp_field<double>(*fld)), scalarsDim1(tensorDim1), scalarsDim2(tensorDim2)
   {
-    field.sync_to_device();
+    NALU_SYNC_TO_DEVICE(field);
   }
   FieldInfoNGP(NGPDoubleFieldType& fld, unsigned scalars)
     : field(fld), scalarsDim1(scalars), scalarsDim2(0)
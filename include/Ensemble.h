@@ -0,0 +1,112 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ENSEMBLE_H
+#define ENSEMBLE_H
+
+#include <mpi.h>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Layout of an ensemble run: many input decks in one job
+ *
+ *  The ranks of the job communicator are split into `numGroups` contiguous
+ *  groups of (nearly) equal size. Group g runs the decks g, g + numGroups,
+ *  g + 2 numGroups, ... one after the other on its own communicator, so that
+ *  MPI, Kokkos and hypre are initialized once for all the members.
+ *
+ *  The list file holds one input deck per line; blank lines and lines
+ *  starting with `#` are skipped. It is read by rank 0 of the job and
+ *  broadcast.
+ */
+class Ensemble
+{
+public:
+  //! Outcome of one member, as collected on rank 0 of the job
+  struct Member
+  {
+    std::string inputFile;
+    int group{-1};
+    bool success{false};
+    double wallTime{0.0};
+  };
+
+  /** Split the job communicator
+   *
+   *  @param numGroups Number of rank groups; zero or more groups than decks
+   *  or ranks is clamped to the smaller of the two
+   */
+  Ensemble(const std::string& listFile, const int numGroups, MPI_Comm comm);
+
+  ~Ensemble();
+
+  Ensemble(const Ensemble&) = delete;
+  Ensemble& operator=(const Ensemble&) = delete;
+
+  int num_groups() const { return numGroups_; }
+  int group() const { return group_; }
+
+  //! Communicator of the ranks of this group
+  MPI_Comm group_comm() const { return groupComm_; }
+
+  const std::vector<std::string>& decks() const { return decks_; }
+
+  //! Indices of the decks run by this group, in order
+  std::vector<size_t> group_decks() const;
+
+  /** Whether the deck just run failed on any rank of this group
+   *
+   *  Collective over the group, on a communicator of its own so that it
+   *  never matches a collective of the deck. A rank whose deck threw waits
+   *  at most `timeout` seconds for the others; past that they are stuck in
+   *  a collective of the deck that will never complete and the job is
+   *  aborted.
+   */
+  bool group_failed(const bool failed, const double timeout) const;
+
+  //! Record the outcome of a deck of this group; called on all its ranks
+  void record(const size_t deck, const bool success, const double wallTime);
+
+  /** Collect the outcome of every member on rank 0 of the job
+   *
+   *  Collective over the job communicator; only rank 0 gets the list.
+   */
+  std::vector<Member> gather() const;
+
+  //! One line per member, followed by the throughput of the job
+  static void write_summary(std::ostream& os, const std::vector<Member>& members);
+
+  //! Group of a rank for a contiguous split of numRanks into numGroups
+  static int group_of_rank(const int rank, const int numRanks, const int numGroups);
+
+  //! Input decks of the list file contents
+  static std::vector<std::string> parse_list(const std::string& contents);
+
+private:
+  MPI_Comm comm_;
+  MPI_Comm groupComm_{MPI_COMM_NULL};
+  MPI_Comm statusComm_{MPI_COMM_NULL};
+  int numGroups_{1};
+  int group_{0};
+  std::vector<std::string> decks_;
+
+  // outcome of the decks of this group, indexed by deck
+  std::vector<int> success_;
+  std::vector<double> wallTime_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ENSEMBLE_H */
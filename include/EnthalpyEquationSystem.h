@@ -97,6 +97,7 @@ public:
   void solve_and_update();
   void post_iter_work_dep();
   void extract_temperature();
+  void report_temperature_clipping(const size_t* troubleCount);
   void post_converged_work();
   void initial_work();
   
@@ -0,0 +1,85 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef EntityLocalitySorter_h
+#define EntityLocalitySorter_h
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+#include <stk_mesh/base/EntitySorterBase.hpp>
+
+#include <Enums.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Morton (Z-order) key of a point quantized on the box [lo, hi]
+ *
+ *  Each direction is quantized to 21 bits and the bits are interleaved.
+ */
+uint64_t morton_key(const double* x, const double* lo, const double* hi, int nDim);
+
+/** Reverse Cuthill-McKee permutation of an undirected graph
+ *
+ *  \return perm such that perm[k] is the vertex placed at position k
+ */
+std::vector<int>
+reverse_cuthill_mckee(const std::vector<std::vector<int>>& adjacency);
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// EntityLocalitySorter
+//=============================================================================
+/**
+ * * @par Description:
+ * - Class that sorts nodes and elements within their buckets so that
+ *   neighboring entities are close in local storage.
+ *
+ * @par Design Considerations:
+ * - STK only allows reordering within a partition, so the ordering is
+ *   computed per entity vector handed to sort(). Nodes and elements are
+ *   ordered along a Morton curve through their (centroid) coordinates or by
+ *   reverse Cuthill-McKee on the node-element graph; other ranks are left
+ *   untouched.
+ */
+//=============================================================================
+
+class EntityLocalitySorter : public stk::mesh::EntitySorterBase {
+
+public:
+  EntityLocalitySorter(
+    const stk::mesh::FieldBase& coordinates, LocalityOrdering ordering);
+
+  virtual void
+  sort(stk::mesh::BulkData& bulk, stk::mesh::EntityVector& entityVector) const;
+
+private:
+  void morton_sort(
+    const stk::mesh::BulkData& bulk,
+    stk::mesh::EntityVector& entityVector) const;
+
+  void rcm_sort(
+    const stk::mesh::BulkData& bulk,
+    stk::mesh::EntityVector& entityVector) const;
+
+  void centroid(
+    const stk::mesh::BulkData& bulk, stk::mesh::Entity entity, double* x) const;
+
+  const stk::mesh::FieldBase& coordinates_;
+  const LocalityOrdering ordering_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -53,6 +53,30 @@ enum AlgorithmType{
   Z_SYM_STRONG
 };
 
+// matching string name index into above enums (must match PERFECTLY)
+static const std::string AlgorithmTypeNames[] = {
+  "interior",
+  "boundary",
+  "inflow",
+  "wall",
+  "wall_fcn",
+  "open",
+  "mass",
+  "src",
+  "symmetry",
+  "wall_hf",
+  "wall_cht",
+  "wall_rad",
+  "non_conformal",
+  "elem_source",
+  "overset",
+  "wall_abl",
+  "top_abl",
+  "ref_pressure",
+  "x_sym_strong",
+  "y_sym_strong",
+  "z_sym_strong"};
+
 enum BoundaryConditionType{
   INFLOW_BC    = 1,
   OPEN_BC      = 2,
@@ -328,6 +352,18 @@ static std::map<std::string, EntrainmentMethod> EntrainmentMethodMap
   {"specified", EntrainmentMethod::SPECIFIED}
 };
 
+enum class LocalityOrdering { NONE = 0, MORTON = 1, RCM = 2 };
+
+static std::map<std::string, LocalityOrdering> LocalityOrderingMap
+{
+  {"none", LocalityOrdering::NONE},
+  {"morton", LocalityOrdering::MORTON},
+  {"rcm", LocalityOrdering::RCM}
+};
+
+//! Entities visited by split-phase assembly relative to the shared nodes
+enum class AssemblyPhase { ALL = 0, HALO = 1, INTERIOR = 2 };
+
 
 } // namespace nalu
 } // namespace Sierra
@@ -18,6 +18,7 @@
 #include "PecletFunction.h"
 #include "NGPInstance.h"
 #include "SimdInterface.h"
+#include "LinearSolveInitialGuess.h"
 
 #include<NaluParsedTypes.h>
 
@@ -157,14 +158,61 @@ public:
   virtual void post_iter_work_dep() {}
   virtual void assemble_and_solve(
     stk::mesh::FieldBase *deltaSolution);
+  /** Assemble and solve without zeroing the linear system first
+   *
+   *  Used when part of the linear system has already been assembled by a
+   *  fused algorithm owned by another equation system (e.g., the fused SST
+   *  k/omega edge algorithm).
+   */
+  void assemble_and_solve_prezeroed(
+    stk::mesh::FieldBase *deltaSolution);
+
+  //! Zero the linear system
+  void zero_system();
+
+  /** First half of assemble_and_solve_prezeroed(): execute the solver
+   *  algorithms and complete the load of the linear system
+   *
+   *  Grouped solves of independent systems assemble all of the systems
+   *  before solving any of them, see EquationSystems::assemble_and_solve_group
+   */
+  void assemble_prezeroed();
+
+  //! Second half of assemble_and_solve_prezeroed(): solve for the delta
+  void solve_assembled(stk::mesh::FieldBase *deltaSolution);
+
+  /** Assemble, solve and apply field += omega * delta
+   *
+   *  When the linear system supports it and the delta is not needed
+   *  otherwise (no periodic constraint, no initial guess), the update is
+   *  applied while reading the solver vector and deltaSolution is not
+   *  written; callers must not read it.
+   */
+  void assemble_solve_and_update(
+    stk::mesh::FieldBase* deltaSolution,
+    const double omega,
+    stk::mesh::FieldBase& field,
+    const unsigned numComponents = 1);
   virtual void predict_state() {}
   virtual void register_interior_algorithm(
     stk::mesh::Part * /* part */) {}
   virtual void provide_output() {}
   virtual void pre_timestep_work();
   virtual void reinitialize_linear_system() {}
+
+  /** Reinitialize on the existing linear system when it keeps its graph
+   *
+   *  If the graph is frozen, or reused in an overset run, the connectivity is
+   *  rebuilt in place and the device data structures are only rebuilt when
+   *  the graph has actually changed. Returns false when the caller must
+   *  recreate the linear system instead.
+   */
+  bool reinitialize_reusing_graph();
   virtual void post_adapt_work() {}
   virtual void dump_eq_time();
+
+  //! Entities per second of each element assembly algorithm
+  void dump_assembly_throughput();
   virtual double provide_scaled_norm() const;
   virtual double provide_norm() const;
   virtual double provide_norm_increment() const;
@@ -233,6 +281,12 @@ public:
   template<typename T = DoubleType>
   PecletFunction<T>* ngp_create_peclet_function(const std::string& dofName);
 
+  /** Return the Peclet function of the dof as a value type for capture by
+   *  the edge algorithm lambdas
+   */
+  template<typename T = double>
+  NgpPecletFunction<T> ngp_peclet_function(const std::string& dofName);
+
   virtual void load(const YAML::Node & node);
 
   /** Update field with delta solution of linear solve
@@ -255,6 +309,7 @@ public:
   bool supp_alg_is_requested(std::vector<std::string>);
 
   bool nodal_src_is_requested();
+  bool nodal_src_is_requested(const std::string& srcName);
 
   EquationSystems &equationSystems_;
   Realm &realm_;
@@ -264,6 +319,9 @@ public:
   int maxIterations_;
   double convergenceTolerance_;
 
+  //! Initial guess of the linear solves of this system
+  LinearSolveInitialGuess initialGuess_;
+
   // driver that holds all solver algorithms
   SolverAlgorithmDriver *solverAlgDriver_;
 
@@ -279,13 +337,19 @@ public:
   double avgLinearIterations_;
   double maxLinearIterations_;
   double minLinearIterations_;
+  double avgLinearReductions_{0.0};
+  double maxLinearReductions_{0.0};
   int nonLinearIterationCount_;
+  //! Linear solves and iterations since the start of the run, never reset
+  int totalLinearSolves_{0};
+  int totalLinearIterations_{0};
   bool reportLinearIterations_;
   bool firstTimeStepSolve_;
   bool edgeNodalGradient_;
 
   void update_iteration_statistics(
-    const int & iters);
+    const int & iters,
+    const double reductions = 0.0);
   
   bool bc_data_specified(
     const UserData&, std::string &name);
@@ -409,6 +473,20 @@ EquationSystem::ngp_create_peclet_function(const std::string& dofName)
   return pecletFunction;
 }
 
+template<typename T>
+NgpPecletFunction<T>
+EquationSystem::ngp_peclet_function(const std::string& dofName)
+{
+  if ("classic" == realm_.get_tanh_functional_form(dofName)) {
+    const double hybridFactor = realm_.get_hybrid_factor(dofName);
+    return NgpPecletFunction<T>(PecletFunctionForm::CLASSIC, hybridFactor, 1.0);
+  }
+  const double c1 = realm_.get_tanh_trans(dofName);
+  const double c2 = realm_.get_tanh_width(dofName);
+  return NgpPecletFunction<T>(
+    PecletFunctionForm::TANH, c1, c2, realm_.get_tanh_table_size(dofName));
+}
+
 } // namespace nalu
 } // namespace Sierra
 
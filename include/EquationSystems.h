@@ -197,6 +197,21 @@ class EquationSystems
 
   bool all_systems_decoupled() const;
 
+  /** Assemble and solve a group of mutually independent linear systems
+   *
+   *  All systems of the group are zeroed and assembled, including the load
+   *  complete, before the first linear solve. The assembly kernels of the
+   *  group are therefore queued back to back on the device, without the
+   *  synchronization of a solve in between. The systems must not depend on
+   *  each other's delta solution, e.g., the Jacobi iteration of the SST
+   *  equations.
+   *
+   *  @param group Pairs of an equation system and its delta solution field
+   */
+  void assemble_and_solve_group(
+    const std::vector<std::pair<EquationSystem*, stk::mesh::FieldBase*>>&
+      group);
+
   Realm &realm_;
   std::string name_;
   int maxIterations_;
@@ -227,6 +242,20 @@ class EquationSystems
    *  appropriate input options.
    */
   bool decoupledOversetGlobalFlag_{false};
+
+  /** Skip the solve of an equation system in later outer iterations once its
+   *  scaled norm is below its convergence tolerance
+   */
+  bool skipConvergedSystems_{false};
+
+  //! Equation system solves skipped during the current time step
+  int skippedSolves_{0};
+
+  //! Equation system solves skipped over the whole simulation
+  size_t totalSkippedSolves_{0};
+
+  //! Equation system solves performed over the whole simulation
+  size_t totalSolves_{0};
 };
 
 } // namespace nalu
@@ -248,4 +248,11 @@ SIERRA_FORTRAN( quad3d_shape_fcn ) ( const int*  npts,
                                      const double* par_coords,
                                      double* shape_fcn );
 
+extern "C" void
+SIERRA_FORTRAN( polyhedralareabyfaces ) ( const int* ncoords,
+                                          const double* areacoords,
+                                          const int* ntriangles,
+                                          const int* triangleFaceTable,
+                                          double* area );
+
 #endif // FORTRAN_Proto_h
@@ -0,0 +1,172 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef HaloSumExchange_h
+#define HaloSumExchange_h
+
+#include <FieldTypeDef.h>
+#include <KokkosInterface.h>
+
+#include <stk_mesh/base/Selector.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <mpi.h>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+/** True if MPI can be handed device pointers directly
+ *
+ *  Queries the MPI library when it reports CUDA or ROCm support, otherwise
+ *  trusts the ENABLE_DEVICE_AWARE_MPI configure option. Always false when
+ *  the device memory space is host accessible.
+ */
+bool device_aware_mpi_available();
+
+//! True if MPI provides MPI-3 shared memory windows
+bool shared_memory_mpi_available();
+
+/** Split-phase parallel sum of nodal fields over the shared nodes
+ *
+ *  Performs the same reduction as stk::mesh::parallel_sum, but in two calls
+ *  so that local work can proceed while the messages are in flight:
+ *  begin() packs the shared node values from the device views and posts
+ *  non-blocking sends and receives; finish() waits and adds the received
+ *  contributions on device.
+ *
+ *  The shared nodes of each neighbor rank are ordered by entity id, so both
+ *  ranks agree on the buffer layout without exchanging keys. With device
+ *  aware MPI the device buffers are sent directly; otherwise they are staged
+ *  through host mirrors.
+ *
+ *  With the shared memory option the host staged values for neighbors on the
+ *  same node are published in an MPI-3 shared window instead of being sent;
+ *  each neighbor copies its segment straight out of the window. This makes
+ *  both begin() and the window allocation collective over the ranks of a
+ *  node.
+ */
+class HaloSumExchange
+{
+public:
+  using IndexView = Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace>;
+  using BufferView = Kokkos::View<double*, MemSpace>;
+
+  HaloSumExchange() = default;
+  ~HaloSumExchange();
+
+  HaloSumExchange(const HaloSumExchange&) = delete;
+  HaloSumExchange& operator=(const HaloSumExchange&) = delete;
+
+  /** Build the shared node lists for the nodes in selector
+   *
+   *  Only rebuilds when the mesh was modified since the last call.
+   */
+  void update(const stk::mesh::BulkData& bulk, const stk::mesh::Selector& sel);
+
+  /** Post the exchange of the shared node values of fields
+   *
+   *  \param numComponents Number of scalars per node of each field
+   */
+  void begin(
+    const std::vector<NGPDoubleFieldType*>& fields,
+    const std::vector<int>& numComponents);
+
+  //! Wait for the messages posted by begin() and sum them into the fields
+  void finish();
+
+  //! True between begin() and finish()
+  bool in_progress() const { return inProgress_; }
+
+  /** Hand the device buffers to MPI instead of staging through the host
+   *
+   *  Ignored when device_aware_mpi_available() is false.
+   */
+  void set_device_aware(bool flag)
+  {
+    deviceAware_ = flag && device_aware_mpi_available();
+  }
+
+  bool device_aware() const { return deviceAware_; }
+
+  /** Exchange with neighbors on the same node through shared memory
+   *
+   *  Ignored when shared_memory_mpi_available() is false or the device
+   *  buffers are handed to MPI. Must be set identically on all ranks.
+   */
+  void set_shared_memory(bool flag);
+
+  bool shared_memory() const { return sharedMemory_ && !deviceAware_; }
+
+private:
+  void wait_all();
+
+  //! Build the node communicator and the window offsets of on-node neighbors
+  void update_shared_memory();
+
+  //! Copy the on-node segments of sendData to the window and synchronize
+  void publish_shared(const double* sendData);
+
+  //! Reallocate the window to hold at least capacity values of this rank
+  void allocate_window(size_t capacity);
+
+  void free_window();
+
+  MPI_Comm comm_{MPI_COMM_NULL};
+  size_t syncCount_{0};
+  bool initialized_{false};
+  bool inProgress_{false};
+  bool deviceAware_{false};
+
+  std::vector<int> neighborProcs_;
+
+  //! Offset of the first node of each neighbor in nodes_
+  std::vector<int> procOffsets_;
+
+  //! Shared nodes for all neighbors, one segment per neighbor
+  IndexView nodes_;
+
+  BufferView sendBuffer_;
+  BufferView recvBuffer_;
+  BufferView::HostMirror hostSend_;
+  BufferView::HostMirror hostRecv_;
+
+  std::vector<MPI_Request> requests_;
+
+  std::vector<NGPDoubleFieldType*> fields_;
+  std::vector<int> numComponents_;
+  int scalarsPerNode_{0};
+
+  bool sharedMemory_{false};
+  MPI_Comm nodeComm_{MPI_COMM_NULL};
+  MPI_Win window_{MPI_WIN_NULL};
+  double* windowBase_{nullptr};
+  size_t windowCapacity_{0};
+
+  //! Rank of each neighbor in nodeComm_, or -1 if it is on another node
+  std::vector<int> nodeRanks_;
+
+  //! Offset of this rank's segment in the node layout of each neighbor
+  std::vector<int> remoteOffsets_;
+
+  //! Window memory of each on-node neighbor
+  std::vector<const double*> neighborBase_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
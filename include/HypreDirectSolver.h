@@ -64,6 +64,22 @@ public:
 
   //! public API for resetting the flag for how often the preconditioner is recomputed
   virtual void set_initialize_solver_flag();
+
+  /** Advance the autotuning before the solves of an equation system
+   *
+   *  Called before every solve; on the first solve of a time step the
+   *  candidate settings are switched once the current one has been used for
+   *  the configured number of time steps, and the fastest candidate is kept
+   *  once all have been measured.
+   *
+   *  @param timeStep The time step count of the realm
+   *  @param eqSysName Equation system used in the log of the choice
+   */
+  void autotune_update(const int timeStep, const std::string& eqSysName);
+
+  //! Settings of the solver are still being compared
+  bool autotune_active() const
+  { return (hypreConfig_->numAutotuneCandidates() > 1) && !autotuneDone_; }
   
   //! Instance of the Hypre parallel matrix
   mutable HYPRE_ParCSRMatrix parMat_;
@@ -89,6 +105,12 @@ protected:
   //! Create the Hypre preconditioner and related call methods
   void createPrecond();
 
+  //! Add the setup and solve time of a solve to the current candidate
+  void autotune_record(const double time)
+  { if (autotune_active()) autotuneTimes_[autotuneCandidate_] += time; }
+
+  HypreLinearSolverConfig* hypreConfig_;
+
   //! Enum indicating the solver type used in this simulation
   Ifpack2::Hypre::Hypre_Solver solverType_;
 
@@ -141,6 +163,18 @@ protected:
   //! Used with recomputePrecondFrequency to determine when to reinitialize the solver/preconditioner
   unsigned internalIterCounter_{0};
 
+  //! Iterations of the solves since the last set_initialize_solver_flag()
+  int solveIterations_{0};
+
+  //! Autotuning: candidate settings used by the solves
+  size_t autotuneCandidate_{0};
+  //! Autotuning: setup and solve time accumulated by every candidate
+  std::vector<double> autotuneTimes_;
+  //! Autotuning: time steps solved with the current candidate
+  int autotuneSteps_{0};
+  int autotuneLastStep_{-1};
+  bool autotuneDone_{false};
+
 private:
   HypreDirectSolver() = delete;
   HypreDirectSolver(const HypreDirectSolver&) = delete;
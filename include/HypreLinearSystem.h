@@ -37,6 +37,8 @@
 #include "overset/OversetInfo.h"
 #include <utils/CreateDeviceExpression.h>
 
+#include <cstdint>
+
 namespace sierra {
 namespace nalu {
 
@@ -71,17 +73,35 @@ using HypreIntTypeUnorderedMap =
   Kokkos::UnorderedMap<HypreIntType, HypreIntType, sierra::nalu::MemSpace>;
 using HypreIntTypeUnorderedMapHost = HypreIntTypeUnorderedMap::HostMirror;
 
+// (row, col) keys of the COO assembly mode
+using CooKeyView = Kokkos::View<uint64_t*, sierra::nalu::MemSpace>;
+using UnsignedViewScalar = Kokkos::View<unsigned, sierra::nalu::MemSpace>;
+
 using MemoryMap =
   Kokkos::UnorderedMap<HypreIntType, unsigned, sierra::nalu::MemSpace>;
 using MemoryMapHost = MemoryMap::HostMirror;
 
-// UVM Views
-using DoubleViewUVM = Kokkos::View<double*, sierra::nalu::UVMSpace>;
-using DoubleView2DUVM =
-  Kokkos::View<double**, Kokkos::LayoutLeft, sierra::nalu::UVMSpace>;
-using HypreIntTypeViewUVM = Kokkos::View<HypreIntType*, sierra::nalu::UVMSpace>;
-using HypreIntTypeView2DUVM =
-  Kokkos::View<HypreIntType**, Kokkos::LayoutLeft, sierra::nalu::UVMSpace>;
+/** Memory space of the assembly buffers handed to HYPRE
+ *
+ *  When HYPRE runs on the device the values, columns and rows are assembled
+ *  in device memory and passed to the IJ interface after a fence; managed
+ *  memory is only used when HYPRE runs on the host, or when requested with
+ *  ENABLE_HYPRE_UVM_ASSEMBLY to compare against the device path.
+ */
+#if defined(KOKKOS_ENABLE_CUDA) && defined(HYPRE_USING_CUDA) &&               \
+  !defined(NALU_HYPRE_UVM_ASSEMBLY)
+using HypreAssemblySpace = sierra::nalu::MemSpace;
+#else
+using HypreAssemblySpace = sierra::nalu::UVMSpace;
+#endif
+
+// Assembly Views
+using DoubleViewAsm = Kokkos::View<double*, HypreAssemblySpace>;
+using DoubleView2DAsm =
+  Kokkos::View<double**, Kokkos::LayoutLeft, HypreAssemblySpace>;
+using HypreIntTypeViewAsm = Kokkos::View<HypreIntType*, HypreAssemblySpace>;
+using HypreIntTypeView2DAsm =
+  Kokkos::View<HypreIntType**, Kokkos::LayoutLeft, HypreAssemblySpace>;
 
 // Periodic Node Map
 using PeriodicNodeMap =
@@ -146,10 +166,10 @@ public:
   HypreIntTypeViewHost cols_shared_host_;
   HypreIntTypeViewHost cols_host_;
 
-  HypreIntTypeViewUVM rows_uvm_;
+  HypreIntTypeViewAsm rows_asm_;
   HypreIntTypeViewHost rows_host_;  
 
-  HypreIntTypeView2DUVM rhs_rows_uvm_;
+  HypreIntTypeView2DAsm rhs_rows_asm_;
   HypreIntTypeView2DHost rhs_rows_host_;  
 
 #ifdef HYPRE_LINEAR_SYSTEM_TIMER
@@ -166,6 +186,7 @@ public:
   std::vector<double> finalizeLinearSystemTimer_;
   std::vector<double> hypreMatAssemblyTimer_;
   std::vector<double> hypreRhsAssemblyTimer_;
+  std::vector<double> cooReductionTimer_;
 #endif
 
   // Quiet "partially overridden" compiler warnings.
@@ -189,6 +210,11 @@ public:
   virtual void buildOversetNodeGraph(
     const stk::mesh::PartVector&); // overset->elem_node assembly
   virtual void finalizeLinearSystem();
+
+  /** Keep this linear system when reinitializing with a frozen graph, or
+   *  with `reuse_linear_system` in overset simulations
+   */
+  virtual bool reuseGraphOnReinitialize() const;
   /** Tag rows that must be handled as a Dirichlet BC node
    *
    *  @param[in] partVec List of parts that contain the Dirichlet nodes
@@ -214,6 +240,12 @@ public:
 
   virtual void dumpMatrixStats();
 
+  //! Write the owned rows of the assembled matrix and rhs for replay
+  void capture_system();
+
+  //! Bytes of the owned rows of the matrix in Hypre's CSR layout
+  virtual size_t memory_bytes() const;
+
   /** Reset the matrix and rhs data structures for the next iteration/timestep
    *
    */
@@ -227,6 +259,16 @@ public:
    */
   virtual int solve(stk::mesh::FieldBase* linearSolutionField);
 
+  //! Copy the owned values of guessField into the HYPRE solution vector
+  virtual void setInitialGuess(stk::mesh::FieldBase* guessField);
+
+  virtual bool supports_fused_update() const { return true; }
+
+  virtual bool supports_device_overset_constraints() const
+  {
+    return numDof() == 1;
+  }
+
   //! Helper method to transfer the solution from a HYPRE_IJVector instance to
   //! the STK field data instance.
   double copy_hypre_to_stk(stk::mesh::FieldBase*);
@@ -249,10 +291,34 @@ public:
   virtual void finishCoupledOversetAssembly();
   virtual void hypreIJMatrixSetAddToValues();
   virtual void hypreIJVectorSetAddToValues();
+  //! Allocate the COO buffer when `hypre_coo_assembly` is set
+  virtual void buildCoeffApplierCooDataStructures();
+  /** Sum the matrix entries gathered in the COO buffer into the CSR values
+   *
+   *  The keys are sorted on device and each run of equal keys is reduced and
+   *  added to its CSR entry, so that the column search happens once per
+   *  nonzero rather than once per contribution. Called before any algorithm
+   *  that may overwrite CSR values directly, i.e., whenever a new coefficient
+   *  applier is handed out, before Dirichlet rows are applied and at
+   *  loadComplete.
+   */
+  virtual void reduceCooAssembly();
   virtual void buildCoeffApplierDeviceOwnedDataStructures();
   virtual void buildCoeffApplierDeviceSharedDataStructures();
   virtual void buildCoeffApplierDeviceDataStructures();
   virtual void computeRowSizes();
+  /** Build the exchange of the shared rows with their owning ranks
+   *
+   *  Only active when `hypre_overlap_shared_rows` is set in the solver block.
+   *  The rows and columns of the shared entries are sent once per graph; the
+   *  values then travel over persistent requests at every loadComplete.
+   */
+  void setupSharedRowsExchange();
+  //! Stage the shared values on the host and start the persistent requests
+  void postSharedRowsExchange();
+  //! Wait for the values of the shared rows owned by this rank
+  void completeSharedRowsExchange();
+  void freeSharedRowsExchange();
   virtual void fill_hids_columns(
     const unsigned numNodes,
     stk::mesh::Entity const* nodes,
@@ -265,6 +331,19 @@ public:
     std::vector<HypreIntType>& hids,
     std::vector<HypreIntType>& columns);
 
+  /** Check if the graph accumulated since beginLinearSystemConstruction is
+   *  identical to the one already finalized on this linear system
+   *
+   *  Only active when `freeze_linear_system_graph` is set in the solver
+   *  block. The result is reduced across all MPI ranks so that every rank
+   *  takes the same path through finalizeLinearSystem.
+   */
+  virtual bool graphIsUnchanged();
+  //! Reuse the existing device data structures and only zero the values
+  virtual void reuseFrozenGraph();
+  //! Clear the host data structures used to accumulate the graph
+  virtual void resetGraphConstructionData();
+
   /***************************************************************************************************/
   /*                     Beginning of HypreLinSysCoeffApplier definition */
   /***************************************************************************************************/
@@ -304,6 +383,19 @@ public:
       const SharedMemView<int*, DeviceShmem>& sortPermutation,
       unsigned N);
 
+    /** Append the entries of one row to the COO buffer
+     *
+     *  @return false if the buffer is full, in which case the caller sums
+     *  into the CSR values instead
+     */
+    KOKKOS_FUNCTION
+    bool coo_sum_into(
+      const HypreIntType row,
+      const unsigned numCols,
+      const SharedMemView<int*, DeviceShmem>& localIds,
+      const SharedMemView<int*, DeviceShmem>& sortPermutation,
+      const double* cur_lhs);
+
     KOKKOS_FUNCTION
     virtual void sum_into(
       unsigned numEntities,
@@ -339,6 +431,19 @@ public:
       const SharedMemView<const double**, DeviceShmem>& lhs,
       const char* trace_tag);
 
+    KOKKOS_FUNCTION
+    virtual void set_overset_row(
+      const stk::mesh::Entity fringe,
+      const unsigned numDonors,
+      const stk::mesh::Entity* donors,
+      const double* weights,
+      const double diag,
+      const double rhs);
+
+    //! Global row of a node, accounting for the periodic node mapping
+    KOKKOS_FUNCTION
+    HypreIntType hypre_id(const stk::mesh::Entity node) const;
+
     virtual void free_device_pointer();
 
     virtual sierra::nalu::CoeffApplier* device_pointer();
@@ -358,9 +463,9 @@ public:
 
     /* monolithic data structures for holding all the values for
        the owned and shared parts. Shared MUST come after owned. */
-    DoubleViewUVM values_uvm_;
-    HypreIntTypeViewUVM cols_uvm_;
-    DoubleView2DUVM rhs_uvm_;
+    DoubleViewAsm values_asm_;
+    HypreIntTypeViewAsm cols_asm_;
+    DoubleView2DAsm rhs_asm_;
 
     //! Data structures for the owned CSR Matrix and RHS Vector(s)
     HypreIntType num_rows_owned_;
@@ -378,7 +483,7 @@ public:
     //! Random access views
     UnsignedViewRA mat_row_start_owned_ra_;
     UnsignedViewRA mat_row_start_shared_ra_;
-    HypreIntTypeViewRA cols_uvm_ra_;
+    HypreIntTypeViewRA cols_asm_ra_;
 
     //! Auxilliary Data structures
 
@@ -398,6 +503,15 @@ public:
     //! this is the pointer to the device function ... that assembles the lists
     HypreLinSysCoeffApplier* devicePointer_;
 
+    /* COO assembly mode: every matrix contribution is appended to these
+       buffers as a (row * coo_num_cols_ + col) key and a value */
+    bool cooAssembly_ = false;
+    CooKeyView coo_keys_;
+    DoubleView coo_vals_;
+    UnsignedViewScalar coo_counter_;
+    unsigned coo_capacity_ = 0;
+    uint64_t coo_num_cols_ = 0;
+
     /* flag to reinitialize or not */
     bool reinitialize_ = true;
 
@@ -561,6 +675,74 @@ protected:
   //! Flag indicating whether the linear system has been initialized
   bool matrixStatsDumped_{false};
 
+  //! COO contributions, and those that did not fit in the buffer, gathered
+  //! since the last loadComplete
+  size_t cooContributions_{0};
+  size_t cooOverflow_{0};
+
+  //! Shared rows sent to their owners ahead of the IJ calls, see
+  //! setupSharedRowsExchange
+  bool overlapSharedRows_{false};
+  bool sharedRowsExchangePending_{false};
+  std::vector<int> sharedSendProcs_;
+  std::vector<int> sharedRecvProcs_;
+  //! Offsets of the neighbors in the shared (or received) nonzeros and rows
+  std::vector<HypreIntType> sharedSendNnzOffsets_;
+  std::vector<HypreIntType> sharedSendRowOffsets_;
+  std::vector<HypreIntType> sharedRecvNnzOffsets_;
+  std::vector<HypreIntType> sharedRecvRowOffsets_;
+  std::vector<double> sharedSendBuffer_;
+  std::vector<double> sharedRecvBuffer_;
+  std::vector<MPI_Request> sharedRowsRequests_;
+  DoubleViewHost sharedValuesHost_;
+  DoubleView2DHost sharedRhsHost_;
+  DoubleViewHost recvValuesHost_;
+  DoubleView2DHost recvRhsHost_;
+  //! Received contributions, handed to hypre as on-process entries
+  HypreIntType numRecvNonzeros_{0};
+  HypreIntType numRecvRows_{0};
+  HypreIntTypeViewAsm recv_rows_asm_;
+  HypreIntTypeViewAsm recv_cols_asm_;
+  DoubleViewAsm recv_values_asm_;
+  HypreIntTypeView2DAsm recv_rhs_rows_asm_;
+  DoubleView2DAsm recv_rhs_asm_;
+
+  //! Hash of the finalized graph used by the frozen graph mode
+  std::size_t graphSignature_{0};
+
+  /** Compute a hash of the graph accumulated on this MPI rank
+   *
+   *  The signature covers the owned and shared column lists as well as the
+   *  rows tagged as Dirichlet or overset constraint rows.
+   */
+  std::size_t compute_graph_signature() const;
+
+  /** True while the current construction restored the cached base graph
+   *
+   *  The base graph is the connectivity accumulated before the overset
+   *  constraint rows, i.e., by the interior and boundary algorithms. During
+   *  overset reinitialization it only changes when the set of inactive (hole)
+   *  entities changes, so the node, face, edge and element graph builds
+   *  return immediately and only the overset and Dirichlet rows are rebuilt.
+   */
+  bool reuseBaseGraph() const { return baseGraphRestored_; }
+
+  //! Copy the accumulated graph as the base graph for later constructions
+  void saveBaseGraph();
+
+  //! Hash of the locally owned entities inactivated on this MPI rank
+  std::size_t compute_inactive_signature() const;
+
+  //! Cached base graph and the inactive entities it was built with
+  bool baseGraphSaved_{false};
+  bool baseGraphRestored_{false};
+  std::size_t baseGraphInactiveSignature_{0};
+  std::vector<std::vector<HypreIntType>> baseColumnsOwned_;
+  std::vector<HypreIntType> baseRowCountOwned_;
+  std::map<HypreIntType, std::vector<HypreIntType>> baseColumnsShared_;
+  std::map<HypreIntType, unsigned> baseRowCountShared_;
+  std::unordered_set<HypreIntType> baseSkippedRows_;
+
 private:
   //! HYPRE right hand side data structure
   mutable HYPRE_IJVector rhs_;
@@ -0,0 +1,165 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef INSITUEXTRACTION_H
+#define INSITUEXTRACTION_H
+
+#include "FieldTypeDef.h"
+#include "KokkosInterface.h"
+
+#include <stk_mesh/base/NgpMesh.hpp>
+#include <stk_mesh/base/Selector.hpp>
+
+#include <array>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+class Part;
+typedef std::vector<Part*> PartVector;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class TurbulenceAveragingPostProcessing;
+
+/** Scalar function whose zero contour is extracted
+ *
+ *  Either the signed distance to a plane, `normal . (x - origin)`, or the
+ *  difference between the first component of a node field and an isovalue.
+ */
+struct ExtractionLevelSet
+{
+  enum Type { PLANE = 0, ISOVALUE = 1 };
+
+  int type_{PLANE};
+  double origin_[3]{0.0, 0.0, 0.0};
+  double normal_[3]{0.0, 0.0, 1.0};
+  NGPDoubleFieldType field_;
+  double value_{0.0};
+
+  KOKKOS_INLINE_FUNCTION
+  double evaluate(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Entity node,
+    const double* x) const
+  {
+    if (type_ == PLANE) {
+      double phi = 0.0;
+      for (int d = 0; d < 3; ++d)
+        phi += normal_[d] * (x[d] - origin_[d]);
+      return phi;
+    }
+    return field_.get(ngpMesh, node, 0) - value_;
+  }
+};
+
+/** Triangulate the zero contour of a level set on device
+ *
+ *  HEX_8 elements are split into six tetrahedra and every tetrahedron is
+ *  cut by marching tetrahedra, so that the result is exact for planes
+ *  through linear elements. Each triangle is stored as three vertices of
+ *  three coordinates followed by the components of `fields` interpolated
+ *  along the cut edges.
+ *
+ *  @param sel          Locally owned elements to search
+ *  @param maxTriangles Capacity of the output; triangles beyond it are
+ *                      counted but dropped
+ *  @param triangles    Host copy of at most maxTriangles triangles
+ *  @return the number of triangles found, which may exceed maxTriangles
+ */
+int extract_contour(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::Selector& sel,
+  const VectorFieldType& coordinates,
+  const ExtractionLevelSet& levelSet,
+  const std::vector<const stk::mesh::FieldBase*>& fields,
+  const int maxTriangles,
+  std::vector<double>& triangles);
+
+//! Doubles per extracted triangle for the given node fields
+int extraction_triangle_size(
+  const std::vector<const stk::mesh::FieldBase*>& fields);
+
+/** In-situ extraction of slices and isosurfaces
+ *
+ *  At the configured frequency every slice and isosurface is extracted on
+ *  device from the locally owned elements of the target blocks, and only
+ *  the triangles are written, one binary file per rank. The number of
+ *  triangles per extraction and rank is bounded by max_triangles. The
+ *  Q-criterion is computed through TurbulenceAveragingPostProcessing when
+ *  an isosurface of q_criterion is requested.
+ */
+class InSituExtraction
+{
+public:
+  InSituExtraction(Realm& realm, const YAML::Node& node);
+  ~InSituExtraction();
+
+  void load(const YAML::Node& node);
+
+  // register the Q-criterion if needed (before populate_mesh())
+  void setup();
+
+  // resolve the parts and fields, open the output file
+  void initialize();
+
+  void execute(const int timeStepCount, const double currentTime);
+
+  //! Maximum number of output fields
+  static constexpr int maxFields = 8;
+
+private:
+  struct ExtractionInfo
+  {
+    std::string name_;
+    int type_{ExtractionLevelSet::PLANE};
+    std::array<double, 3> origin_{{0.0, 0.0, 0.0}};
+    std::array<double, 3> normal_{{0.0, 0.0, 1.0}};
+    std::string fieldName_;
+    double value_{0.0};
+  };
+
+  void write_header();
+
+  Realm& realm_;
+
+  int outputFreq_{10};
+  int maxTriangles_{1000000};
+  std::string fileName_{"extraction"};
+  std::vector<std::string> targetNames_;
+  std::vector<std::string> fieldNames_;
+  std::vector<ExtractionInfo> extractions_;
+
+  stk::mesh::PartVector parts_;
+  std::vector<const stk::mesh::FieldBase*> fields_;
+
+  bool needsQcriterion_{false};
+  std::unique_ptr<TurbulenceAveragingPostProcessing> qCriterion_;
+
+  std::ofstream file_;
+  std::vector<double> triangles_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* INSITUEXTRACTION_H */
@@ -45,12 +45,15 @@ namespace nalu {
 #ifdef KOKKOS_ENABLE_CUDA
 typedef Kokkos::CudaSpace    MemSpace;
 typedef Kokkos::CudaUVMSpace UVMSpace;
+typedef Kokkos::CudaHostPinnedSpace PinnedSpace;
 #elif defined(KOKKOS_HAVE_OPENMP)
 typedef Kokkos::OpenMP       MemSpace;
 typedef Kokkos::OpenMP       UVMSpace;
+typedef Kokkos::HostSpace    PinnedSpace;
 #else
 typedef Kokkos::HostSpace    MemSpace;
 typedef Kokkos::HostSpace    UVMSpace;
+typedef Kokkos::HostSpace    PinnedSpace;
 #endif
 
 // Tpetra requires UVM on Cuda
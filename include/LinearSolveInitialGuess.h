@@ -0,0 +1,77 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef LinearSolveInitialGuess_h
+#define LinearSolveInitialGuess_h
+
+#include <KokkosInterface.h>
+
+#include <string>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Initial guess of the delta solution handed to the linear solver
+ *
+ *  - zero: every solve starts from zero
+ *  - previous_iteration: the delta of the last solve of the system is kept
+ *    in the delta field and used as the guess
+ *  - extrapolate: the first solve of a time step starts from the linear
+ *    extrapolation of the first-solve deltas of the two previous steps
+ *    (constant with a single step of history); the remaining outer
+ *    iterations start from zero
+ *
+ *  The extrapolation history is stored per node local offset on device and
+ *  is discarded when the mesh is modified.
+ */
+class LinearSolveInitialGuess
+{
+public:
+  enum Type { ZERO = 0, PREVIOUS_ITERATION = 1, EXTRAPOLATE = 2 };
+
+  LinearSolveInitialGuess() = default;
+  explicit LinearSolveInitialGuess(const std::string& type);
+
+  Type type() const { return type_; }
+
+  /** Write the guess into the delta field before the solve
+   *
+   *  @return true if the guess may be nonzero and should be loaded into the
+   *          linear system
+   */
+  bool apply(Realm& realm, stk::mesh::FieldBase& delta);
+
+  //! Record the solved delta of the first solve of a time step
+  void store(Realm& realm, stk::mesh::FieldBase& delta);
+
+private:
+  void check_history(Realm& realm, const int numComponents);
+
+  Type type_{ZERO};
+  int lastStep_{-1};
+  bool firstSolveOfStep_{false};
+  int numStored_{0};
+  size_t syncCount_{0};
+
+  //! Deltas of the two previous steps: [node offset][state * ncomp + comp]
+  Kokkos::View<double**, MemSpace> history_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
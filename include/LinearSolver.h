@@ -55,6 +55,9 @@ namespace nalu{
 
 
 class LinearSolvers;
+class BlockCrsMatrixCopy;
+class MixedPrecisionPreconditioner;
+class MixedPrecisionRefinement;
 class Simulation;
 
 const LocalOrdinal INVALID = std::numeric_limits<LocalOrdinal>::max();
@@ -177,6 +180,21 @@ class LinearSolver
   double timerPrecond_;
   bool activateMueLu_{false};
 
+  //! Adaptive reuse: the next solve must set up the preconditioner
+  bool rebuildPrecond_{true};
+  //! Adaptive reuse: the last solve used a newly set up preconditioner
+  bool freshPrecond_{false};
+  int baselineIters_{0};
+  unsigned solvesSinceSetup_{0};
+  unsigned numPrecondSetups_{0};
+
+  //! Record a preconditioner setup for the statistics and the reuse policy
+  void mark_precond_setup()
+  {
+    ++numPrecondSetups_;
+    freshPrecond_ = true;
+  }
+
   public:
   //! Flag indicating whether the preconditioner is recomputed on each invocation
   bool & recomputePreconditioner() {return recomputePreconditioner_;}
@@ -184,7 +202,22 @@ class LinearSolver
   bool & reusePreconditioner() {return reusePreconditioner_;}
 
   //! Reset the preconditioner timer to 0.0 for future accumulation
-  void zero_timer_precond() { timerPrecond_ = 0.0;}
+  void zero_timer_precond() { timerPrecond_ = 0.0; numPrecondSetups_ = 0;}
+
+  //! Number of preconditioner setups since the last zero_timer_precond()
+  unsigned num_precond_setups() const { return numPrecondSetups_; }
+
+  //! Flag indicating whether the adaptive preconditioner reuse is active
+  bool adaptive_precond_reuse() const
+  { return config_->precondReuseIterationRatio() > 0.0; }
+
+  /** Update the adaptive reuse policy with the iterations of the last solve
+   *
+   *  The first solve after a setup defines the baseline iteration count; a
+   *  rebuild is requested once a later solve exceeds the configured ratio of
+   *  that baseline or the maximum number of solves is reached.
+   */
+  void update_precond_reuse(const int iters);
 
   //! Get the preconditioner timer for the last invocation
   double get_timer_precond() { return timerPrecond_;}
@@ -216,17 +249,26 @@ class TpetraLinearSolver : public LinearSolver
       Teuchos::RCP<LinSys::Matrix> matrix,
       Teuchos::RCP<LinSys::MultiVector> rhs);
 
+  /** Create the Belos problem, preconditioner and solver
+   *
+   *  @param[in] blockSize Dofs per node; with `block_crs_matrix` and more
+   *                       than one dof the solve uses a block CRS copy
+   */
     void setupLinearSolver(
       Teuchos::RCP<LinSys::MultiVector> sln,
       Teuchos::RCP<LinSys::Matrix> matrix,
       Teuchos::RCP<LinSys::MultiVector> rhs,
-      Teuchos::RCP<LinSys::MultiVector> coords);
+      Teuchos::RCP<LinSys::MultiVector> coords,
+      const int blockSize = 1);
 
     virtual void destroyLinearSolver() override;
 
   //! Initialize the MueLU preconditioner before solve
     void setMueLu();
 
+  //! Create the Belos solver manager for the current problem
+    void create_solver();
+
   /** Compute the norm of the non-linear solution vector
    *
    *  @param[in] whichNorm [0, 1, 2] norm to be computed
@@ -263,6 +305,9 @@ class TpetraLinearSolver : public LinearSolver
     Teuchos::RCP<LinSys::LinearProblem> problem_;
     Teuchos::RCP<LinSys::SolverManager> solver_;
     Teuchos::RCP<LinSys::Preconditioner> preconditioner_;
+    Teuchos::RCP<MixedPrecisionPreconditioner> mixedPreconditioner_;
+    Teuchos::RCP<MixedPrecisionRefinement> refinement_;
+    Teuchos::RCP<BlockCrsMatrixCopy> blockMatrix_;
     Teuchos::RCP<MueLu::TpetraOperator<SC,LO,GO,NO> > mueluPreconditioner_;
     Teuchos::RCP<LinSys::MultiVector> coords_;
 
@@ -13,6 +13,7 @@
 #define LinearSolverConfig_h
 
 #include <string>
+#include <vector>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 
@@ -47,6 +48,25 @@ public:
   inline bool getWriteMatrixFiles() const
   { return writeMatrixFiles_; }
 
+  /** Time step at which the linear systems are captured for replay
+   *
+   *  Set with the `capture_linear_system` entry of the solver block; a
+   *  negative value disables the capture.
+   */
+  inline int captureTimeStep() const
+  { return captureTimeStep_; }
+
+  //! Equation system captured; empty for all systems using this solver
+  inline const std::string& captureEquation() const
+  { return captureEquation_; }
+
+  inline const std::string& captureOutputPrefix() const
+  { return captureOutputPrefix_; }
+
+  //! The solver block of the input file, stored with the captures
+  inline const std::string& yamlBlock() const
+  { return yamlBlock_; }
+
   inline bool recomputePreconditioner() const
   { return recomputePreconditioner_; }
 
@@ -56,6 +76,19 @@ public:
   inline bool reusePreconditioner() const
   { return reusePreconditioner_; }
 
+  /** Iteration growth that triggers a preconditioner rebuild
+   *
+   *  When positive, the preconditioner is kept until the linear iterations
+   *  exceed this ratio times the iterations of the first solve after the last
+   *  setup. Zero disables the adaptive policy.
+   */
+  inline double precondReuseIterationRatio() const
+  { return precondReuseIterationRatio_; }
+
+  //! Maximum solves with the same preconditioner (0 means unlimited)
+  inline unsigned precondReuseMaxSolves() const
+  { return precondReuseMaxSolves_; }
+
   inline bool useSegregatedSolver() const
   { return useSegregatedSolver_; }
 
@@ -69,6 +102,16 @@ public:
   inline bool reuseLinSysIfPossible() const
   { return reuseLinSysIfPossible_; }
 
+  /** User flag indicating that the linear system graph should be frozen
+   *
+   *  When enabled, reinitializing the linear system rebuilds the connectivity
+   *  on the existing linear system instance and skips the expensive device
+   *  data structure rebuild if the graph signature is unchanged. Currently
+   *  only supported by the Hypre linear systems.
+   */
+  inline bool freezeLinSysGraph() const
+  { return freezeLinSysGraph_; }
+
   std::string get_method() const
   {return method_;}
 
@@ -84,7 +127,19 @@ public:
   std::string solver_type() const
   { return solverType_; }
 
+  /** Estimated number of global reductions performed by a solve
+   *
+   *  Neither Belos nor Hypre count their allreduces, so this is a model of
+   *  the dot products and norms of the selected Krylov method. It is used for
+   *  the per-solve reduction statistics of the equation systems.
+   */
+  inline double estimated_reductions(const int iters) const
+  { return reductionsPerSolve_ + reductionsPerIteration_ * iters; }
+
 protected:
+  //! Parse the `capture_linear_system` entry and keep the solver block
+  void load_capture(const YAML::Node&);
+
   std::string solverType_;
   std::string name_;
   std::string method_;
@@ -93,6 +148,10 @@ protected:
   double tolerance_;
   double finalTolerance_;
 
+  //! Reductions for the initial residual and the convergence check
+  double reductionsPerSolve_{2.0};
+  //! Reductions for every Krylov iteration, see estimated_reductions()
+  double reductionsPerIteration_{3.0};
 
   Teuchos::RCP<Teuchos::ParameterList> params_;
   Teuchos::RCP<Teuchos::ParameterList> paramsPrecond_;
@@ -100,9 +159,16 @@ protected:
   bool recomputePreconditioner_{true};
   unsigned recomputePrecondFrequency_{1}; /* positive integer. Recompute precond before all solves */
   bool reusePreconditioner_{false};
+  double precondReuseIterationRatio_{0.0};
+  unsigned precondReuseMaxSolves_{0};
   bool useSegregatedSolver_{false};
   bool writeMatrixFiles_{false};
   bool reuseLinSysIfPossible_{false};
+  bool freezeLinSysGraph_{false};
+  int captureTimeStep_{-1};
+  std::string captureEquation_;
+  std::string captureOutputPrefix_{"linsys_capture"};
+  std::string yamlBlock_;
 };
 
 class TpetraLinearSolverConfig : public LinearSolverConfig
@@ -116,12 +182,58 @@ public:
   std::string & muelu_xml_file() {return muelu_xml_file_;}
   bool use_MueLu() const {return useMueLu_;}
 
+  //! Build and apply the Ifpack2 preconditioner in single precision
+  bool mixedPrecisionPreconditioner() const {return mixedPrecisionPrecond_;}
+
+  /** Refine the solution in double precision around single precision solves
+   *
+   *  The correction equations are solved by the Belos method with a single
+   *  precision preconditioner to refinementInnerTolerance(), for at most
+   *  refinementMaxCycles() cycles; see MixedPrecisionRefinement.
+   */
+  bool mixedPrecisionRefinement() const {return mixedPrecisionRefinement_;}
+  int refinementMaxCycles() const {return refinementMaxCycles_;}
+  double refinementInnerTolerance() const {return refinementInnerTolerance_;}
+
+  //! Solve multi-dof systems with a block CRS copy of the matrix
+  bool blockCrsMatrix() const {return blockCrsMatrix_;}
+
+  //! The Belos solver keeps a recycled subspace between solves
+  bool recyclesKrylovSpace() const {return recyclesKrylovSpace_;}
+
+  //! Belos block solver used for several right hand sides; empty if unused
+  const std::string& block_krylov_method() const {return blockKrylovMethod_;}
+
+  //! Edge contributions are summed through CSR offsets built with the graph
+  bool scatterMapAssembly() const {return scatterMapAssembly_;}
+
 private:
   std::string muelu_xml_file_;
+  bool mixedPrecisionPrecond_{false};
+  bool mixedPrecisionRefinement_{false};
+  int refinementMaxCycles_{10};
+  double refinementInnerTolerance_{1.0e-2};
+  bool blockCrsMatrix_{false};
+  std::string blockKrylovMethod_;
+  bool recyclesKrylovSpace_{false};
+  bool scatterMapAssembly_{false};
   bool summarizeMueluTimer_{false};
   bool useMueLu_{false};
 };
 
+/** Hypre settings tried by the autotuning of a solver
+ *
+ *  The settings of a candidate are the entries of the Hypre options with the
+ *  overrides of the candidate applied; see HypreLinearSolverConfig::load.
+ */
+struct HypreAutotuneCandidate
+{
+  //! Overrides of the candidate, for the log
+  std::string description;
+  Teuchos::RCP<Teuchos::ParameterList> paramsPrecond;
+  std::vector<Teuchos::RCP<Ifpack2::FunctionParameter>> funcParams;
+};
+
 /** User configuration parmeters for Hypre solvers and preconditioners
  */
 class HypreLinearSolverConfig : public LinearSolverConfig
@@ -143,6 +255,30 @@ public:
   inline bool dumpHypreMatrixStats() const
   { return dumpHypreMatrixStats_; }
 
+  inline bool hypreCooAssembly() const
+  { return hypreCooAssembly_; }
+
+  inline double hypreCooCapacityFactor() const
+  { return hypreCooCapacityFactor_; }
+
+  inline bool hypreOverlapSharedRows() const
+  { return hypreOverlapSharedRows_; }
+
+  /** Number of settings compared by the autotuning
+   *
+   *  The first candidate holds the settings of the input file. Autotuning is
+   *  active when there is more than one candidate.
+   */
+  inline size_t numAutotuneCandidates() const
+  { return autotuneCandidates_.size(); }
+
+  inline const HypreAutotuneCandidate& autotuneCandidate(const size_t i) const
+  { return autotuneCandidates_[i]; }
+
+  //! Time steps solved with every candidate before the next one is tried
+  inline int autotuneStepsPerCandidate() const
+  { return autotuneStepsPerCandidate_; }
+
 protected:
   //! List of HYPRE API calls and corresponding arugments to configure solver
   //! and preconditioner after they are created.
@@ -184,8 +320,20 @@ protected:
   bool useSegregatedSolver_{false};
   bool simpleHypreMatrixAssemble_{false};
   bool dumpHypreMatrixStats_{false};
+  bool hypreCooAssembly_{false};
+  double hypreCooCapacityFactor_{4.0};
+  bool hypreOverlapSharedRows_{false};
+
+  std::vector<HypreAutotuneCandidate> autotuneCandidates_;
+  int autotuneStepsPerCandidate_{2};
 
 private:
+  //! Register the Hypre calls for the solver and preconditioner options
+  void configure_functions(const YAML::Node&);
+
+  //! Build the candidates of the `autotune` entry of the solver block
+  void load_autotune(const YAML::Node& node, const YAML::Node& hnode);
+
   void boomerAMG_solver_config(const YAML::Node&);
   void boomerAMG_precond_config(const YAML::Node&);
 
@@ -95,9 +95,18 @@ struct LinSys {
 
   using EntityToLIDView = Kokkos::View<LocalOrdinal*, Kokkos::LayoutRight, LinSysMemSpace>;
   using ConstEntityToLIDView = Kokkos::View<const LocalOrdinal*, Kokkos::LayoutRight, LinSysMemSpace>;
+  //! Flat CSR value offsets of every (row, column) entry of a scatter
+  using ScatterMapView = Kokkos::View<LocalOrdinal**, Kokkos::LayoutRight, LinSysMemSpace>;
 
 };
 
+//! Bytes of the values, column indices and row offsets of a local matrix
+inline size_t local_matrix_bytes(const LinSys::LocalMatrix& mat)
+{
+  return mat.nnz() * (sizeof(LinSys::Scalar) + sizeof(LinSys::LocalOrdinal))
+    + (mat.numRows() + 1) * sizeof(LinSys::LocalMatrix::size_type);
+}
+
 
 } // namespace nalu
 } // namespace Sierra
@@ -38,6 +38,7 @@ class EquationSystem;
 class Realm;
 class LinearSolver;
 class LinearSolverConfig;
+struct LinearSystemCapture;
 
 class CoeffApplier
 {
@@ -65,6 +66,34 @@ public:
                           const SharedMemView<const double**,DeviceShmem> & lhs,
                           const char * trace_tag) = 0;
 
+  /** Sum the contribution of one edge through CSR offsets precomputed when
+   *  the graph was built
+   *
+   *  @return false when the linear system has no scatter map for the edge;
+   *  the caller then sums through operator()
+   */
+  KOKKOS_FUNCTION
+  virtual bool scatter_edge(const stk::mesh::Entity /* edge */,
+                            const stk::mesh::NgpMesh::ConnectedNodes& /* entities */,
+                            const SharedMemView<const double*,DeviceShmem> & /* rhs */,
+                            const SharedMemView<const double**,DeviceShmem> & /* lhs */)
+  { return false; }
+
+  /** Overwrite the overset constraint row of one fringe node
+   *
+   *  The row gets `diag` in the fringe node column, `-diag * weights[k]` in
+   *  the columns of the donor nodes and `rhs` on the right hand side. Only
+   *  called when LinearSystem::supports_device_overset_constraints() is true.
+   */
+  KOKKOS_FUNCTION
+  virtual void set_overset_row(const stk::mesh::Entity /* fringe */,
+                               const unsigned /* numDonors */,
+                               const stk::mesh::Entity* /* donors */,
+                               const double* /* weights */,
+                               const double /* diag */,
+                               const double /* rhs */)
+  {}
+
   virtual void free_device_pointer() = 0;
   virtual CoeffApplier* device_pointer() = 0;
   
@@ -102,6 +131,11 @@ public:
   virtual void buildOversetNodeGraph(const stk::mesh::PartVector & parts)=0; // overset->elem_node assembly
   virtual void finalizeLinearSystem()=0;
 
+  /** True if reinitialization rebuilds the connectivity on this linear
+   *  system instead of deleting and recreating it
+   */
+  virtual bool reuseGraphOnReinitialize() const { return false; }
+
   /** Process nodes that belong to Dirichlet-type BC
    *
    */
@@ -124,6 +158,16 @@ public:
     return nullptr;
   }
 
+  /** Coefficient applier for loops where no two concurrent calls touch the
+   *  same row, e.g. one color of a colored edge loop
+   *
+   *  Systems without a dedicated implementation return the atomic applier.
+   */
+  virtual CoeffApplier* get_conflict_free_coeff_applier()
+  {
+    return get_coeff_applier();
+  }
+
 
   virtual void sumInto(
     unsigned numEntities,
@@ -173,13 +217,43 @@ public:
 
   // Solve
   virtual int solve(stk::mesh::FieldBase * linearSolutionField)=0;
+
+  /** Start the next solve from the values of guessField instead of zero
+   *
+   *  Called between loadComplete() and solve(); systems that do not support
+   *  an initial guess ignore it.
+   */
+  virtual void setInitialGuess(stk::mesh::FieldBase * /* guessField */) {}
+
+  /** Apply field += omega * solution in the next solve
+   *
+   *  The next call to solve() updates the field while reading the solver
+   *  vector instead of writing the delta solution field, and synchronizes the
+   *  field in its place. Only valid if supports_fused_update() is true.
+   */
+  void set_fused_update(stk::mesh::FieldBase* field, const double omega)
+  {
+    fusedUpdateField_ = field;
+    fusedUpdateOmega_ = omega;
+  }
+  virtual bool supports_fused_update() const { return false; }
+  //! The coeff applier writes the coupled overset rows on the device
+  virtual bool supports_device_overset_constraints() const { return false; }
   virtual void loadComplete()=0;
 
   virtual void writeToFile(const char * filename, bool useOwned=true)=0;
   virtual void writeSolutionToFile(const char * filename, bool useOwned=true)=0;
   virtual unsigned numDof() const { return numDof_; }
+  //! Bytes of the assembled matrices on this rank; zero when not tracked
+  virtual size_t memory_bytes() const { return 0; }
+  //! Estimated preconditioner storage relative to the matrix storage
+  double preconditioner_memory_factor() const;
   const int & linearSolveIterations() const {return linearSolveIterations_; }
+  //! Estimated global reductions of the last solve
+  double linearSolveReductions() const;
   const double & linearResidual() const {return linearResidual_; }
+  //! L2 norm of the solution update applied by the last solve
+  double solutionUpdateNorm() const { return solutionUpdateNorm_; }
   const double & nonLinearResidual() const {return nonLinearResidual_; }
   const double & scaledNonLinearResidual() const {return scaledNonLinearResidual_; }
   void setNonLinearResidual(const double nlr) { nonLinearResidual_ = nlr;}
@@ -187,6 +261,8 @@ public:
   bool recomputePreconditioner() const {return recomputePreconditioner_;}
   bool reusePreconditioner() const {return reusePreconditioner_;}
   double get_timer_precond();
+  //! Preconditioner setups since the last zero_timer_precond()
+  unsigned num_precond_setups() const;
   void zero_timer_precond();
   bool useSegregatedSolver() const;
 
@@ -199,6 +275,29 @@ protected:
     const char * msg)=0;
 
   void sync_field(const stk::mesh::FieldBase *field);
+
+  //! Field the solve writes the solution vector into
+  stk::mesh::FieldBase* solution_target(stk::mesh::FieldBase* linearSolutionField) const
+  {
+    return fusedUpdateField_ ? fusedUpdateField_ : linearSolutionField;
+  }
+
+  //! Synchronize the solution target and clear the fused update
+  void finish_solution_update(stk::mesh::FieldBase* target);
+
+  /** True when the solver block asks for the capture of this system now
+   *
+   *  Checked before the solve, see `capture_linear_system`; a linear system
+   *  is captured at most once.
+   */
+  bool capture_requested() const;
+
+  /** Complete the capture of the rows owned by this rank and write it
+   *
+   *  Rank 0 also writes the solver block and the equation system next to
+   *  the rank files, for the replay with nalu_solver_bench.
+   */
+  void write_capture(LinearSystemCapture& capture);
   bool debug();
 
   Realm &realm_;
@@ -213,6 +312,10 @@ protected:
   double linearResidual_;
   double firstNonLinearResidual_;
   double scaledNonLinearResidual_;
+  double solutionUpdateNorm_{0.0};
+  stk::mesh::FieldBase* fusedUpdateField_{nullptr};
+  double fusedUpdateOmega_{1.0};
+  bool captured_{false};
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
 
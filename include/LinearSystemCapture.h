@@ -0,0 +1,67 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef LINEARSYSTEMCAPTURE_H
+#define LINEARSYSTEMCAPTURE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Rows of an assembled linear system owned by one MPI rank
+ *
+ *  Written by the linear systems when the solver block has a
+ *  `capture_linear_system` entry and replayed by `nalu_solver_bench`. The
+ *  matrix is stored in CSR format with global row and column ids, followed
+ *  by the right hand sides and, when the solver uses them, the nodal
+ *  coordinates of the rows, both stored one component after the other.
+ */
+struct LinearSystemCapture
+{
+  int numRanks{1};
+  int rank{0};
+  int numDof{1};
+  int numRhs{1};
+  int numCoords{0};
+  int timeStep{0};
+  //! Index base of the global ids (1 for Tpetra, 0 for Hypre)
+  std::int64_t indexBase{0};
+  std::int64_t globalNumRows{0};
+
+  std::vector<std::int64_t> rows;
+  std::vector<std::int64_t> rowOffsets;
+  std::vector<std::int64_t> cols;
+  std::vector<double> values;
+  std::vector<double> rhs;
+  std::vector<double> coords;
+
+  size_t num_rows() const { return rows.size(); }
+  size_t num_nonzeros() const { return cols.size(); }
+};
+
+//! Base name of the capture files of an equation system at a time step
+std::string linear_system_capture_name(
+  const std::string& prefix, const std::string& eqSysName, const int timeStep);
+
+//! File holding the rows of the rank, `<base>.bin.<numRanks>.<rank>`
+std::string linear_system_capture_file(
+  const std::string& baseName, const int numRanks, const int rank);
+
+void write_linear_system_capture(
+  const std::string& fileName, const LinearSystemCapture& capture);
+
+LinearSystemCapture read_linear_system_capture(const std::string& fileName);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* LINEARSYSTEMCAPTURE_H */
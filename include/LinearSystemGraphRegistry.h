@@ -0,0 +1,68 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef LINEARSYSTEMGRAPHREGISTRY_H
+#define LINEARSYSTEMGRAPHREGISTRY_H
+
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+
+namespace sierra {
+namespace nalu {
+
+/** Sparsity graphs of the linear systems of a realm, keyed by stencil
+ *
+ *  Equation systems with identical stencils (the edge and boundary graphs of
+ *  the scalar transport equations, for example) find the graph of the first
+ *  system that built it and only allocate their own values. The registry
+ *  does not own the graphs: an entry expires when the last linear system
+ *  using it is destroyed, e.g. on a reinitialization of the linear systems.
+ */
+template <typename GraphData>
+class LinearSystemGraphRegistry
+{
+public:
+  /** Graph registered with the signature on all ranks
+   *
+   *  Collective; returns a null pointer unless every rank has a live graph
+   *  with the signature, so that the ranks agree on rebuilding the graph.
+   */
+  std::shared_ptr<GraphData>
+  find(const std::size_t signature, stk::ParallelMachine comm)
+  {
+    std::shared_ptr<GraphData> graph;
+    auto it = graphs_.find(signature);
+    if (it != graphs_.end()) {
+      graph = it->second.lock();
+      if (!graph)
+        graphs_.erase(it);
+    }
+
+    int localFound = graph ? 1 : 0;
+    int globalFound = 0;
+    MPI_Allreduce(&localFound, &globalFound, 1, MPI_INT, MPI_MIN, comm);
+    return (globalFound == 1) ? graph : nullptr;
+  }
+
+  void insert(const std::size_t signature, std::shared_ptr<GraphData> graph)
+  {
+    graphs_[signature] = graph;
+  }
+
+private:
+  std::map<std::size_t, std::weak_ptr<GraphData>> graphs_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* LINEARSYSTEMGRAPHREGISTRY_H */
@@ -39,6 +39,7 @@ class MomentumEquationSystem;
 class ContinuityEquationSystem;
 class LinearSystem;
 class ProjectedNodalGradientEquationSystem;
+class MomentumEdgePecletAlg;
 class SurfaceForceAndMomentAlgorithmDriver;
 class MdotAlgDriver;
 class NgpAlgDriver;
@@ -228,6 +229,9 @@ public:
   std::unique_ptr<Algorithm> ablWallNodeMask_ {nullptr};
 
   CourantReAlgDriver cflReAlgDriver_;
+
+  //! The Peclet alg when it also provides the Courant/Reynolds maxima
+  MomentumEdgePecletAlg* fusedCflReAlg_{nullptr};
   std::unique_ptr<AMSAlgDriver> AMSAlgDriver_{nullptr};
 
   ProjectedNodalGradientEquationSystem *projectedNodalGradEqs_;
@@ -0,0 +1,201 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MasterElementGeometryCache_h
+#define MasterElementGeometryCache_h
+
+#include <KokkosInterface.h>
+#include <SimdInterface.h>
+#include <ElemDataRequests.h>
+#include <ElemDataRequestsGPU.h>
+#include <ScratchViews.h>
+
+#include <stk_mesh/base/Selector.hpp>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+/** Per-element store of master element geometry
+ *
+ *  Holds the SCS_AREAV, SCS_GRAD_OP and SCV_VOLUME results requested through
+ *  ElemDataRequests for the elements of one element block. The values live
+ *  in a device buffer with one row per element, addressed through an offset
+ *  for each selected bucket. The cache is shared by all the element
+ *  algorithms on the same parts (see Realm::shared_geometry_cache), and its
+ *  layout is the union of their requests.
+ *
+ *  Every request is tracked separately: the first assembly pass that needs
+ *  a stale request computes and stores it, and later passes of any algorithm
+ *  skip that master element call and load the stored values instead. With
+ *  mesh motion the momentum, continuity and scalar assemblies of a step thus
+ *  compute the geometry once between them.
+ *
+ *  The requests are stale when the epoch handed to update() changes, which
+ *  the Realm advances on mesh motion, or when the mesh is modified.
+ */
+class MasterElementGeometryCache
+{
+public:
+  using CacheView = Kokkos::View<double**, Kokkos::LayoutRight, MemSpace>;
+  using OffsetView = Kokkos::View<int*, Kokkos::LayoutRight, MemSpace>;
+
+  KOKKOS_DEFAULTED_FUNCTION MasterElementGeometryCache() = default;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  MasterElementGeometryCache(const MasterElementGeometryCache&) = default;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  MasterElementGeometryCache&
+  operator=(const MasterElementGeometryCache&) = default;
+
+  KOKKOS_DEFAULTED_FUNCTION ~MasterElementGeometryCache() = default;
+
+  /** Prepare the cache for the next assembly pass of an algorithm
+   *
+   *  Widens the layout, and reallocates the buffer, when the algorithm makes
+   *  a cacheable request not seen before or when the mesh changed. Selects
+   *  the requests of this pass to serve from the buffer and to store.
+   */
+  void update(
+    const stk::mesh::BulkData& bulk,
+    const stk::mesh::Selector& selector,
+    const ElemDataRequestsGPU& dataNeeded,
+    int nDim,
+    unsigned epoch);
+
+  //! Mark the values stored by the last pass as current
+  void set_current()
+  {
+    for (int c = 0; c < MAX_COORDS_TYPES; ++c)
+      currentMask_[c] |= storeMask_[c];
+  }
+
+  //! True if any of the master element calls of the last update is cached
+  KOKKOS_FUNCTION bool is_active() const
+  {
+    unsigned mask = 0u;
+    for (int c = 0; c < MAX_COORDS_TYPES; ++c)
+      mask |= serveMask_[c] | storeMask_[c];
+    return mask != 0u;
+  }
+
+  /** Fill the master element views for a SIMD group of elements
+   *
+   *  The current requests are skipped and loaded from the buffer; the other
+   *  requests are computed and the cached ones among them stored.
+   */
+  template <typename ELEMDATAREQUESTSTYPE, typename SCRATCHVIEWSTYPE>
+  KOKKOS_FUNCTION void fill_master_element_views(
+    const ELEMDATAREQUESTSTYPE& dataNeeded,
+    SCRATCHVIEWSTYPE& prereqData,
+    unsigned bucketId,
+    unsigned bucketOrdinal,
+    int numSimdElems) const
+  {
+    MasterElement* meFC = dataNeeded.get_cvfem_face_me();
+    MasterElement* meSCS = dataNeeded.get_cvfem_surface_me();
+    MasterElement* meSCV = dataNeeded.get_cvfem_volume_me();
+    MasterElement* meFEM = dataNeeded.get_fem_volume_me();
+
+    const int firstRow = bucketOffsets_(bucketId) + bucketOrdinal;
+
+    const auto& coordsTypes = dataNeeded.get_coordinates_types();
+    const auto& coordsFields = dataNeeded.get_coordinates_fields();
+    for (unsigned i = 0; i < coordsTypes.size(); ++i) {
+      const auto cType = coordsTypes(i);
+      const auto& dataEnums = dataNeeded.get_data_enums(cType);
+      const typename ELEMDATAREQUESTSTYPE::FieldType coordField =
+        coordsFields(i);
+      auto* coordsView =
+        &prereqData.get_scratch_view_2D(coordField.get_ordinal());
+      auto& meData = prereqData.get_me_views(cType);
+
+      meData.fill_master_element_views_new_me(
+        dataEnums, coordsView, meFC, meSCS, meSCV, meFEM, 0,
+        serveMask_[cType]);
+
+      transfer(meData.scs_areav, firstRow, cType, SCS_AREAV, numSimdElems);
+      transfer(meData.dndx, firstRow, cType, SCS_GRAD_OP, numSimdElems);
+      transfer(meData.scv_volume, firstRow, cType, SCV_VOLUME, numSimdElems);
+    }
+  }
+
+private:
+  template <typename ViewType>
+  KOKKOS_FUNCTION void transfer(
+    ViewType& view,
+    int firstRow,
+    COORDS_TYPES cType,
+    ELEM_DATA_NEEDED data,
+    int numSimdElems) const
+  {
+    const bool serve = (serveMask_[cType] & (1u << data)) != 0u;
+    const bool store = (storeMask_[cType] & (1u << data)) != 0u;
+    if (!serve && !store)
+      return;
+
+    const int offset = offsets_[cType][data];
+
+    auto* data = view.data();
+    const int len = view.size();
+    for (int s = 0; s < numSimdElems; ++s) {
+      double* row = &values_(firstRow + s, offset);
+      if (serve) {
+        for (int k = 0; k < len; ++k)
+          stk::simd::set_data(data[k], s, row[k]);
+      } else {
+        for (int k = 0; k < len; ++k)
+          row[k] = stk::simd::get_data(data[k], s);
+      }
+    }
+
+    // padded lanes match the zero coordinates of copy_and_interleave
+    if (serve) {
+      for (int s = numSimdElems; s < simdLen; ++s)
+        for (int k = 0; k < len; ++k)
+          stk::simd::set_data(data[k], s, 0.0);
+    }
+  }
+
+  //! Size the buffer for the selected elements and the current layout
+  void allocate(
+    const stk::mesh::BulkData& bulk, const stk::mesh::Selector& selector);
+
+  CacheView values_;
+  OffsetView bucketOffsets_;
+
+  //! Column offset of each cached request within an element row, -1 if absent
+  int offsets_[MAX_COORDS_TYPES][END_FEM + 1];
+  unsigned cachedMask_[MAX_COORDS_TYPES]{0u, 0u};
+  int numScalars_{0};
+
+  //! Row length of each request in the layout
+  int lengths_[MAX_COORDS_TYPES][END_FEM + 1];
+
+  //! Stored requests that are up to date
+  unsigned currentMask_[MAX_COORDS_TYPES]{0u, 0u};
+
+  //! Requests of the pass being assembled, loaded from and written to buffer
+  unsigned serveMask_[MAX_COORDS_TYPES]{0u, 0u};
+  unsigned storeMask_[MAX_COORDS_TYPES]{0u, 0u};
+
+  unsigned epoch_{0};
+  size_t syncCount_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -29,6 +29,8 @@ struct topology;
 namespace sierra {
 namespace nalu {
 
+class TpetraLinearSystem;
+
 class MatrixFreeHeatCondEquationSystem final : public EquationSystem
 {
 public:
@@ -60,6 +62,8 @@ private:
     static constexpr auto tpetra_gid = "tpet_global_id";
     static constexpr auto qbc = "temperature_bc";
     static constexpr auto flux = "heat_flux_bc";
+    static constexpr auto htc = "heat_transfer_coefficient";
+    static constexpr auto qref = "reference_temperature";
     static constexpr auto volume_weight = "volumetric_heat_capacity";
     static constexpr auto thermal_conductivity = "thermal_conductivity";
     static constexpr auto density = "density";
@@ -70,6 +74,9 @@ private:
   void initialize_solve_and_update();
   void sync_field_on_periodic_nodes(std::string name, int len) const;
   void compute_volumetric_heat_capacity() const;
+  void update_boundary_data();
+  std::string get_muelu_xml_file_name();
+  void setup_and_compute_coarse_preconditioner(double gamma);
 
   const int polynomial_order_{1};
   stk::mesh::MetaData& meta_;
@@ -77,10 +84,14 @@ private:
   stk::mesh::Selector interior_selector_;
   stk::mesh::Selector dirichlet_selector_;
   stk::mesh::Selector flux_selector_;
+  stk::mesh::Selector convection_selector_;
 
   std::unique_ptr<matrix_free::EquationUpdate> update_;
   std::unique_ptr<matrix_free::GradientUpdate> grad_;
+  std::unique_ptr<TpetraLinearSystem> precond_linsys_;
 
+  bool use_pmultigrid_{false};
+  bool has_convection_bc_{false};
   bool initialized_{false};
 };
 
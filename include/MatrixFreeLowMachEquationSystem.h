@@ -13,6 +13,8 @@
 #include "EquationSystem.h"
 #include "Kokkos_Array.hpp"
 
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/NgpMesh.hpp"
 #include "stk_mesh/base/Selector.hpp"
 
 #include <iosfwd>
@@ -33,6 +35,8 @@ struct topology;
 namespace sierra {
 namespace nalu {
 
+class ABLVectorInterpolator;
+class CoriolisSrc;
 class EquationSystems;
 class TpetraLinearSystem;
 
@@ -144,6 +148,8 @@ private:
   void setup_and_compute_continuity_preconditioner();
   void compute_courant_reynolds();
   void check_part_is_valid(const stk::mesh::Part*);
+  void register_momentum_sources();
+  bool time_dependent_body_force() const { return ablForcing_ || coriolis_; }
   void
   register_copy_state_algorithm(std::string, int dim, stk::mesh::Part& part);
 
@@ -156,8 +162,31 @@ private:
   std::unique_ptr<matrix_free::LowMachEquationUpdate> update_;
   std::unique_ptr<TpetraLinearSystem> precond_linsys_;
   bool initialized_{false};
+
+  // time-dependent momentum sources folded into the body force
+  bool ablForcing_{false};
+  bool coriolis_{false};
 };
 
+/** Nodal momentum body force of the matrix-free low-Mach system
+ *
+ *  Sum of the constant force, the ABL source per unit volume interpolated at
+ *  the nodal height (when `ablSrc` is given) and the Coriolis force at the
+ *  nodal velocity and density (when `corSrc` is given). The matrix-free
+ *  operator integrates it with the lumped nodal volume, like the assembled
+ *  MomentumABLForceNodeKernel and MomentumCoriolisNodeKernel sources.
+ */
+void compute_matrix_free_body_force(
+  const stk::mesh::NgpMesh& mesh,
+  const stk::mesh::Selector& sel,
+  const Kokkos::Array<double, 3>& constant_force,
+  const ABLVectorInterpolator* ablSrc,
+  const CoriolisSrc* corSrc,
+  stk::mesh::NgpField<double> coords,
+  stk::mesh::NgpField<double> vel,
+  stk::mesh::NgpField<double> rho,
+  stk::mesh::NgpField<double> force);
+
 } // namespace nalu
 } // namespace sierra
 #endif
@@ -0,0 +1,96 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MixedPrecisionPreconditioner_h
+#define MixedPrecisionPreconditioner_h
+
+#include <LinearSolverTypes.h>
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <TpetraCore_config.h>
+
+#include <string>
+
+namespace sierra {
+namespace nalu {
+
+/** Ifpack2 preconditioner built and applied in single precision
+ *
+ *  Holds a float copy of the matrix values on the graph of the double
+ *  precision linear system and an Ifpack2 preconditioner created on that
+ *  copy. The operator itself acts on double precision vectors so it can be
+ *  handed to Belos as the right preconditioner; the vectors are converted on
+ *  every application while the Krylov vectors and residuals stay in double.
+ *
+ *  Requires Tpetra to be instantiated for `float` (HAVE_TPETRA_INST_FLOAT).
+ */
+class MixedPrecisionPreconditioner : public LinSys::Operator
+{
+public:
+  MixedPrecisionPreconditioner(
+    Teuchos::RCP<const LinSys::Matrix> matrix,
+    const std::string& precondType,
+    const Teuchos::ParameterList& params);
+
+  virtual ~MixedPrecisionPreconditioner() = default;
+
+  //! Symbolic setup of the single precision preconditioner
+  void initialize();
+
+  //! Copy the current matrix values to single precision and compute
+  void compute();
+
+  bool isComputed() const { return isComputed_; }
+
+  Teuchos::RCP<const LinSys::Map> getDomainMap() const final;
+  Teuchos::RCP<const LinSys::Map> getRangeMap() const final;
+
+  //! Y = beta * Y + alpha * M^{-1} X
+  void apply(
+    const LinSys::MultiVector& X,
+    LinSys::MultiVector& Y,
+    Teuchos::ETransp mode = Teuchos::NO_TRANS,
+    LinSys::Scalar alpha = Teuchos::ScalarTraits<LinSys::Scalar>::one(),
+    LinSys::Scalar beta = Teuchos::ScalarTraits<LinSys::Scalar>::zero())
+    const final;
+
+private:
+#ifdef HAVE_TPETRA_INST_FLOAT
+  using FloatMatrix = Tpetra::
+    CrsMatrix<float, LinSys::LocalOrdinal, LinSys::GlobalOrdinal, LinSys::Node>;
+  using FloatMultiVector = Tpetra::MultiVector<
+    float,
+    LinSys::LocalOrdinal,
+    LinSys::GlobalOrdinal,
+    LinSys::Node>;
+  using FloatPreconditioner = Ifpack2::Preconditioner<
+    float,
+    LinSys::LocalOrdinal,
+    LinSys::GlobalOrdinal,
+    LinSys::Node>;
+
+  Teuchos::RCP<FloatMatrix> floatMatrix_;
+  Teuchos::RCP<FloatPreconditioner> preconditioner_;
+
+  // work vectors, resized to the number of vectors of the last apply
+  mutable Teuchos::RCP<FloatMultiVector> floatX_;
+  mutable Teuchos::RCP<FloatMultiVector> floatY_;
+  mutable Teuchos::RCP<LinSys::MultiVector> doubleY_;
+#endif
+
+  Teuchos::RCP<const LinSys::Matrix> matrix_;
+  const std::string precondType_;
+  bool isComputed_{false};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -0,0 +1,123 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MixedPrecisionRefinement_h
+#define MixedPrecisionRefinement_h
+
+#include <LinearSolverTypes.h>
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <TpetraCore_config.h>
+
+#include <string>
+
+namespace sierra {
+namespace nalu {
+
+/** Iterative refinement around a single precision Krylov solve
+ *
+ *  The residual and the solution are updated in double precision while the
+ *  correction equation, A d = r, is solved to a loose tolerance by a Belos
+ *  solver on a float copy of the matrix, preconditioned by MueLu or Ifpack2
+ *  in float. The single precision matrix shares the graph of the double
+ *  precision one, so the preconditioner hierarchy and the Krylov vectors take
+ *  half of the memory and bandwidth of the double precision solve.
+ *
+ *  Requires Tpetra to be instantiated for `float` (HAVE_TPETRA_INST_FLOAT);
+ *  the MueLu preconditioner also requires the float instantiation of MueLu.
+ */
+class MixedPrecisionRefinement
+{
+public:
+  /**
+   *  @param[in] matrix The fill complete double precision matrix
+   *  @param[in] method Belos solver of the correction equation
+   *  @param[in] params Belos parameters of the correction solve
+   *  @param[in] precondType Ifpack2 preconditioner type, or "MueLu"
+   *  @param[in] paramsPrecond Ifpack2 or MueLu parameters
+   *  @param[in] coords Nodal coordinates for MueLu, may be null
+   */
+  MixedPrecisionRefinement(
+    Teuchos::RCP<const LinSys::Matrix> matrix,
+    const std::string& method,
+    const Teuchos::ParameterList& params,
+    const std::string& precondType,
+    const Teuchos::ParameterList& paramsPrecond,
+    Teuchos::RCP<const LinSys::MultiVector> coords);
+
+  ~MixedPrecisionRefinement() = default;
+
+  //! Copy the current matrix values to single precision and set up the
+  //! preconditioner
+  void compute();
+
+  bool isComputed() const { return isComputed_; }
+
+  /** Refine the solution until the relative residual drops below tolerance
+   *
+   *  @param[inout] sln Initial guess and solution
+   *  @param[in] rhs The right hand side
+   *  @param[in] tolerance Relative residual of the double precision solution
+   *  @param[in] maxCycles Maximum refinement cycles
+   *  @param[in] innerTolerance Relative residual of the correction solves
+   *  @return The Krylov iterations of all correction solves
+   */
+  int solve(
+    LinSys::MultiVector& sln,
+    const LinSys::MultiVector& rhs,
+    const double tolerance,
+    const int maxCycles,
+    const double innerTolerance);
+
+  //! Refinement cycles of the last solve
+  int num_cycles() const { return numCycles_; }
+
+private:
+#ifdef HAVE_TPETRA_INST_FLOAT
+  using FloatMatrix = Tpetra::
+    CrsMatrix<float, LinSys::LocalOrdinal, LinSys::GlobalOrdinal, LinSys::Node>;
+  using FloatMultiVector = Tpetra::MultiVector<
+    float,
+    LinSys::LocalOrdinal,
+    LinSys::GlobalOrdinal,
+    LinSys::Node>;
+  using FloatOperator = Tpetra::
+    Operator<float, LinSys::LocalOrdinal, LinSys::GlobalOrdinal, LinSys::Node>;
+  using FloatProblem =
+    Belos::LinearProblem<float, FloatMultiVector, FloatOperator>;
+  using FloatSolver =
+    Belos::SolverManager<float, FloatMultiVector, FloatOperator>;
+
+  Teuchos::RCP<FloatMatrix> floatMatrix_;
+  Teuchos::RCP<FloatOperator> preconditioner_;
+  Teuchos::RCP<FloatMultiVector> floatCoords_;
+  Teuchos::RCP<FloatProblem> problem_;
+  Teuchos::RCP<FloatSolver> solver_;
+
+  // work vectors, resized to the number of vectors of the last solve
+  Teuchos::RCP<FloatMultiVector> floatResid_;
+  Teuchos::RCP<FloatMultiVector> floatCorr_;
+  Teuchos::RCP<LinSys::MultiVector> resid_;
+  Teuchos::RCP<LinSys::MultiVector> corr_;
+#endif
+
+  Teuchos::RCP<const LinSys::Matrix> matrix_;
+  const std::string method_;
+  Teuchos::RCP<Teuchos::ParameterList> params_;
+  const std::string precondType_;
+  Teuchos::ParameterList paramsPrecond_;
+  bool isComputed_{false};
+  int numCycles_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
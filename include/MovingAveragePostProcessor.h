@@ -12,8 +12,11 @@
 #define MovingAveragePostProcessor_h
 
 #include <FieldTypeDef.h>
+#include <KokkosInterface.h>
 
 #include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace stk { namespace mesh { class BulkData; } }
@@ -30,7 +33,12 @@ class ExponentialMovingAverager
 public:
   ExponentialMovingAverager(double timeScale = 0.0, bool isInit = false, double alpha = -1.);
 
-  double compute_updated_average(double oldAvg, double newVal);
+  KOKKOS_INLINE_FUNCTION
+  double compute_updated_average(double oldAvg, double newVal) const
+  {
+    return (alpha_ * newVal  + (1 -  alpha_) * oldAvg);
+  }
+
   void compute_and_set_alpha(double dt);
   void init_state(bool init);
 private:
@@ -39,10 +47,19 @@ private:
   double alpha_;
 };
 
-
+/** Exponential moving averages of node fields
+ *
+ *  Every registered (field, average) pair is updated in one fused device
+ *  sweep over the nodes where the averages are defined. A field may be
+ *  averaged over several time scales by registering several averages of it,
+ *  and an average may be declared as a float field to halve its storage; the
+ *  update itself is always carried out in double precision.
+ */
 class MovingAveragePostProcessor
 {
 public:
+  //! Maximum number of averages updated by one processor
+  static constexpr int maxAverages = 16;
 
   // Field naming rule
   static std::string filtered_field_name(std::string unfilteredFieldName)
@@ -58,20 +75,36 @@ public:
 
   void execute();
 
+  //! Average each field into the field named filtered_field_name(field)
   void add_fields(std::vector<std::string> fieldName);
+
+  //! Average `fieldName` into `averageName` with its own time scale
+  void add_average(
+    const std::string& fieldName,
+    const std::string& averageName,
+    double timeScale);
+
+  //! Time scale of the average filtered_field_name(fieldName)
   void set_time_scale(std::string fieldName, double timeScale);
+
+  //! Time scale of every average registered so far
   void set_time_scale(double timeScale);
 
-  std::map<stk::mesh::FieldBase*, stk::mesh::FieldBase*>& get_field_map()
+  //! (field, average) pairs in the order they were registered
+  std::vector<std::pair<stk::mesh::FieldBase*, stk::mesh::FieldBase*>>& get_field_map()
   {
     return fieldMap_;
   }
 
 private:
+  void add_pair(stk::mesh::FieldBase* field, const std::string& averageName);
+
   stk::mesh::BulkData& bulk_;
   TimeIntegrator& timeIntegrator_;
   bool isRestarted_;
-  std::map<stk::mesh::FieldBase*, stk::mesh::FieldBase*> fieldMap_;
+  std::vector<std::pair<stk::mesh::FieldBase*, stk::mesh::FieldBase*>> fieldMap_;
+
+  // keyed by the name of the average field
   std::map<std::string, ExponentialMovingAverager> averagers_;
 };
 
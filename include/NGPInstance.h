@@ -13,7 +13,9 @@
 
 #include "KokkosInterface.h"
 
+#include <string>
 #include <type_traits>
+#include <vector>
 
 namespace sierra {
 namespace nalu {
@@ -60,6 +62,24 @@ inline T* create(Args&&... args)
   return obj;
 }
 
+/** Copy a host object into an existing device instance
+ *
+ *  The instance is destroyed and copy constructed in place within a single
+ *  kernel launch, so the device memory and the pointers to it are reused.
+ */
+template<class T>
+inline void update(T* obj, const T& hostObj)
+{
+  const std::string debuggingName(typeid(T).name());
+
+  // Create local copy for capture on device
+  const T hostCopy(hostObj);
+  Kokkos::parallel_for(debuggingName, 1, KOKKOS_LAMBDA(const int) {
+      obj->~T();
+      new (obj) T(hostCopy);
+    });
+}
+
 template<typename T>
 inline void destroy(T* obj)
 {
@@ -128,6 +148,45 @@ create_ngp_view(const Container& hostVec)
   return ngpVec;
 }
 
+/** Kokkos::View of device instances kept between algorithm executions
+ *
+ *  Every update refreshes the device instances of the host objects; the view
+ *  itself is only reallocated and copied when the instances change, e.g.,
+ *  when the first update creates them.
+ */
+template<typename T>
+class NGPInstanceView
+{
+public:
+  using NGPInfo = NGPCopyHolder<T>;
+  using NGPInfoView = Kokkos::View<NGPInfo*, Kokkos::LayoutRight, MemSpace>;
+
+  template<typename Container>
+  const NGPInfoView& update(const Container& hostVec)
+  {
+    const size_t numObjects = hostVec.size();
+    std::vector<T*> instances(numObjects);
+    for (size_t i=0; i < numObjects; ++i)
+      instances[i] = hostVec[i]->create_on_device();
+
+    if (instances != instances_) {
+      const std::string clsName(typeid(T).name());
+      ngpVec_ = NGPInfoView("NGP" + clsName + "View", numObjects);
+      typename NGPInfoView::HostMirror hostNgpView =
+        Kokkos::create_mirror_view(ngpVec_);
+      for (size_t i=0; i < numObjects; ++i)
+        hostNgpView(i) = NGPInfo(instances[i]);
+      Kokkos::deep_copy(ngpVec_, hostNgpView);
+      instances_.swap(instances);
+    }
+    return ngpVec_;
+  }
+
+private:
+  NGPInfoView ngpVec_;
+  std::vector<T*> instances_;
+};
+
 } // nalu_ngp
 
 }  // nalu
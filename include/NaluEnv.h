@@ -14,10 +14,13 @@
 
 #include <mpi.h>
 #include <fstream>
+#include <memory>
 #include <streambuf>
 
 namespace sierra{
 namespace nalu{
+
+  class NaluBufferedStreamBuffer;
   
   class NaluEmptyStreamBuffer : public std::filebuf {
   public:
@@ -45,10 +48,22 @@ class NaluEnv
   std::filebuf naluStreamBuffer_;
   std::filebuf naluParallelStreamBuffer_;
 
+  // batching buffers in front of the log files, if requested
+  std::unique_ptr<NaluBufferedStreamBuffer> naluBufferedStream_;
+  std::unique_ptr<NaluBufferedStreamBuffer> naluBufferedParallelStream_;
+
   std::ostream & naluOutputP0();
   std::ostream & naluOutput();
 
   MPI_Comm parallel_comm();
+
+  /** Replace the communicator of the Nalu ranks
+   *
+   *  Used by ensemble runs, where each group of ranks runs its own input
+   *  decks. The log file stream must be (re)set afterwards, since rank 0 of
+   *  the new communicator writes it.
+   */
+  void set_parallel_comm(MPI_Comm comm);
   int parallel_size();
   int parallel_rank();
 
@@ -60,12 +75,19 @@ class NaluEnv
    *
    *  \param capture_cout If true, `std::cout` is redirected to log file
    *
+   *  \param buffered If true, log output is batched in memory and written
+   *  by a background thread; stream flushes no longer reach the file system
+   *
    */
   void set_log_file_stream(
     std::string naluLogName,
     bool pprint = false,
-    const bool capture_cout = false);
+    const bool capture_cout = false,
+    const bool buffered = false);
   void close_log_file_stream();
+
+  //! Write the buffered log output to the log files
+  void flush_log_file_stream();
   double nalu_time();
 };
 
@@ -0,0 +1,76 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NALULOGBUFFER_H
+#define NALULOGBUFFER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+namespace sierra {
+namespace nalu {
+
+/** Stream buffer batching log output for a background writer thread
+ *
+ *  Characters are appended to an in-memory buffer. Flushes of the owning
+ *  stream (std::endl, std::flush) do not reach the file system; a writer
+ *  thread swaps the buffer out and writes it to the sink when it holds
+ *  `capacity` bytes or every `flushInterval` seconds, whichever comes first.
+ *  The main thread only blocks when the buffer doubles its capacity before
+ *  the writer has caught up. Output still buffered when the process aborts
+ *  is lost; call flush() before operations that may not return.
+ */
+class NaluBufferedStreamBuffer : public std::streambuf
+{
+public:
+  NaluBufferedStreamBuffer(
+    std::streambuf* sink,
+    const size_t capacity = 1 << 16,
+    const double flushInterval = 1.0);
+
+  ~NaluBufferedStreamBuffer();
+
+  NaluBufferedStreamBuffer(const NaluBufferedStreamBuffer&) = delete;
+  NaluBufferedStreamBuffer& operator=(const NaluBufferedStreamBuffer&) = delete;
+
+  //! Write all buffered output to the sink and flush it
+  void flush();
+
+protected:
+  virtual int_type overflow(int_type c) override;
+  virtual std::streamsize xsputn(const char* s, std::streamsize n) override;
+  virtual int sync() override;
+
+private:
+  void append(const char* s, const size_t n);
+  void write_loop();
+  void write_pending(std::unique_lock<std::mutex>& lock);
+
+  std::streambuf* sink_;
+  const size_t capacity_;
+  const double flushInterval_;
+
+  std::string front_;
+  std::string back_;
+  bool writing_{false};
+  bool shutdown_{false};
+
+  std::mutex mutex_;
+  std::condition_variable writeCond_;
+  std::condition_variable doneCond_;
+  std::thread writer_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NALULOGBUFFER_H */
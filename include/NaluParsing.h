@@ -164,6 +164,18 @@ struct OversetUserData : public UserData {
   /// List of part names for the interior meshes
   std::vector<std::string> oversetBlockVec_;
 
+  /// Native connectivity: part names of the background mesh
+  std::vector<std::string> backgroundBlockVec_;
+
+  /// Native connectivity: exterior boundaries of the interior meshes
+  std::vector<std::string> oversetSurfaceVec_;
+
+  /// Native connectivity: covered background node layers kept active
+  int numOverlapLayers_;
+
+  /// Native connectivity: background fringe node layers around the hole
+  int numFringeLayers_;
+
 #ifdef NALU_USES_TIOGA
   YAML::Node oversetBlocks_;
 #endif
@@ -176,7 +188,9 @@ struct OversetUserData : public UserData {
       backgroundBlock_("na"),
       backgroundSurface_("na"),
       backgroundCutBlock_("na"),
-      oversetSurface_("na")
+      oversetSurface_("na"),
+      numOverlapLayers_(2),
+      numFringeLayers_(1)
   {}
 };
 
@@ -204,6 +218,9 @@ struct ABLTopUserData : public UserData {
   std::vector<int> horiz_bcs_;
   double z_sample_;
 
+  //! Keep the plane distributed over the ranks for the transforms
+  bool distributedFFT_{false};
+
   bool normalTemperatureGradientSpec_;
 
   ABLTopUserData()
@@ -231,9 +248,11 @@ struct NonConformalUserData : public UserData {
   bool clipIsoParametricCoords_;
   double searchTolerance_;
   bool dynamicSearchTolAlg_;
+  double searchDriftTolerance_;
   NonConformalUserData()
     : UserData(),
-    searchMethodName_("na"), expandBoxPercentage_(0.0), clipIsoParametricCoords_(false), searchTolerance_(1.0e-16), dynamicSearchTolAlg_(false)
+    searchMethodName_("na"), expandBoxPercentage_(0.0), clipIsoParametricCoords_(false), searchTolerance_(1.0e-16), dynamicSearchTolAlg_(false),
+    searchDriftTolerance_(0.0)
   {}
 };
 
@@ -255,7 +274,8 @@ struct OpenBoundaryConditionData : public BoundaryCondition {
 struct OversetBoundaryConditionData : public BoundaryCondition {
   enum OversetAPI {
     TPL_TIOGA     = 0, ///< Overset connectivity using TIOGA
-    OVERSET_NONE  = 1  ///< Guard for error messages
+    NATIVE        = 1, ///< Overset connectivity without a third-party library
+    OVERSET_NONE  = 2  ///< Guard for error messages
   };
 
   OversetBoundaryConditionData(BoundaryConditions& bcs) : BoundaryCondition(bcs){};
@@ -423,6 +443,15 @@ void operator >> (const YAML::Node& node, std::map<std::string,std::vector<doubl
 
 bool case_insensitive_compare(std::string s1, std::string s2);
 
+/** Read and parse a YAML file on one rank and broadcast it
+ *
+ *  The root rank loads the file and broadcasts the document in compact flow
+ *  form; the other ranks parse that string instead of reading the file. A
+ *  missing file or a syntax error throws on all ranks.
+ */
+YAML::Node load_yaml_file_collective(
+  const std::string& fileName, MPI_Comm comm, int root = 0);
+
 
 } // namespace nalu
 } // namespace Sierra
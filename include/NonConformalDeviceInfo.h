@@ -0,0 +1,242 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NONCONFORMALDEVICEINFO_H
+#define NONCONFORMALDEVICEINFO_H
+
+#include "FieldTypeDef.h"
+#include "KokkosInterface.h"
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+class NonConformalInfo;
+
+/** Flattened DgInfo data of all the non-conformal interfaces of a realm
+ *
+ *  Each DgInfo Gauss point of the interfaces is one row of the views. The
+ *  geometry that only changes with the search or with mesh motion is
+ *  evaluated once on host through the master elements: the face shape
+ *  functions at the current and opposing points, the shape function
+ *  gradients of the current and opposing elements at those points and the
+ *  opposing face normal. The device algorithms then only gather the nodal
+ *  fields of the connected nodes, the current element nodes followed by the
+ *  opposing element nodes.
+ */
+class NonConformalDeviceInfo
+{
+public:
+  template <typename T>
+  using DeviceView = Kokkos::View<T, Kokkos::LayoutRight, MemSpace>;
+
+  //! Rebuild the views from the DgInfo of the interfaces after a search
+  void update(
+    const stk::mesh::BulkData& bulk,
+    const VectorFieldType& coordinates,
+    const std::vector<NonConformalInfo*>& infoVec);
+
+  size_t num_points() const { return numPoints_; }
+
+  //! Largest number of connected nodes of a point
+  int max_connected_nodes() const { return maxConnectedNodes_; }
+
+  KOKKOS_INLINE_FUNCTION
+  int num_connected_nodes(const int pt) const
+  {
+    return numCurrentElemNodes_(pt) + numOpposingElemNodes_(pt);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  stk::mesh::Entity current_elem_node(const int pt, const int k) const
+  {
+    return connectedNodes_(pt, k);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  stk::mesh::Entity opposing_elem_node(const int pt, const int k) const
+  {
+    return connectedNodes_(pt, numCurrentElemNodes_(pt) + k);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  stk::mesh::Entity current_face_node(const int pt, const int k) const
+  {
+    return connectedNodes_(pt, currentFaceNodes_(pt, k));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  stk::mesh::Entity opposing_face_node(const int pt, const int k) const
+  {
+    return connectedNodes_(
+      pt, numCurrentElemNodes_(pt) + opposingFaceNodes_(pt, k));
+  }
+
+  //! Interpolate f(node) on the current face to the point
+  template <typename Function>
+  KOKKOS_INLINE_FUNCTION double
+  interpolate_current(const int pt, const Function& f) const
+  {
+    double value = 0.0;
+    for (int k = 0; k < numCurrentFaceNodes_(pt); ++k)
+      value += currentShapeFcn_(pt, k) * f(current_face_node(pt, k));
+    return value;
+  }
+
+  //! Interpolate f(node) on the opposing face to the point
+  template <typename Function>
+  KOKKOS_INLINE_FUNCTION double
+  interpolate_opposing(const int pt, const Function& f) const
+  {
+    double value = 0.0;
+    for (int k = 0; k < numOpposingFaceNodes_(pt); ++k)
+      value += opposingShapeFcn_(pt, k) * f(opposing_face_node(pt, k));
+    return value;
+  }
+
+  int nDim_{3};
+
+  DeviceView<stk::mesh::Entity*> currentFace_;
+  DeviceView<int*> currentGaussPointId_;
+
+  //! Element node of the current element the point assembles to
+  DeviceView<int*> currentIpNode_;
+
+  DeviceView<int*> numCurrentElemNodes_;
+  DeviceView<int*> numOpposingElemNodes_;
+  DeviceView<int*> numCurrentFaceNodes_;
+  DeviceView<int*> numOpposingFaceNodes_;
+
+  //! Current element nodes followed by the opposing element nodes
+  DeviceView<stk::mesh::Entity**> connectedNodes_;
+
+  //! Element index of the face nodes, in the order of the face relations
+  DeviceView<int**> currentFaceNodes_;
+  DeviceView<int**> opposingFaceNodes_;
+
+  //! Element index of the face nodes, from the side node ordinals
+  DeviceView<int**> currentFaceOrdinals_;
+  DeviceView<int**> opposingFaceOrdinals_;
+
+  //! Face iso-parametric coordinates (-1:1) of the points
+  DeviceView<double**> currentIsoParCoords_;
+  DeviceView<double**> opposingIsoParCoords_;
+
+  //! Face shape functions at the points
+  DeviceView<double**> currentShapeFcn_;
+  DeviceView<double**> opposingShapeFcn_;
+
+  //! Element shape function gradients at the points
+  DeviceView<double***> currentDndx_;
+  DeviceView<double***> opposingDndx_;
+
+  //! Normal of the opposing face at the opposing point
+  DeviceView<double**> opposingNormal_;
+
+private:
+  size_t numPoints_{0};
+  int maxConnectedNodes_{0};
+};
+
+/** Scratch of the linear system contributions of one DgInfo point
+ *
+ *  The views are sized per point on top of buffers sized for the largest
+ *  point, so that the coefficient applier sees contiguous views of exactly
+ *  the number of rows of the point.
+ */
+template <typename TEAMHANDLETYPE, typename SHMEM>
+struct SharedMemData_NonConformal
+{
+  KOKKOS_FUNCTION
+  SharedMemData_NonConformal(const TEAMHANDLETYPE& team, const int maxRows)
+  {
+    buffer = get_shmem_view_1D<double, TEAMHANDLETYPE, SHMEM>(
+      team, maxRows * (maxRows + 1));
+    scratchIds = get_shmem_view_1D<int, TEAMHANDLETYPE, SHMEM>(team, maxRows);
+    sortPermutation =
+      get_shmem_view_1D<int, TEAMHANDLETYPE, SHMEM>(team, maxRows);
+  }
+
+  //! Size and zero the rhs and lhs views for a point
+  KOKKOS_INLINE_FUNCTION
+  void reset(const int numRows)
+  {
+    rhs = SharedMemView<double*, SHMEM>(buffer.data(), numRows);
+    lhs =
+      SharedMemView<double**, SHMEM>(buffer.data() + numRows, numRows, numRows);
+    set_vals(rhs, 0.0);
+    set_vals(lhs, 0.0);
+  }
+
+  SharedMemView<double*, SHMEM> buffer;
+  SharedMemView<double*, SHMEM> rhs;
+  SharedMemView<double**, SHMEM> lhs;
+  SharedMemView<int*, SHMEM> scratchIds;
+  SharedMemView<int*, SHMEM> sortPermutation;
+};
+
+/** Run an assembly functor over all the points of the interfaces
+ *
+ *  The functor is called as func(pt, smdata) with the scratch of the team
+ *  thread; it fills smdata.rhs and smdata.lhs after calling
+ *  smdata.reset(numRows) and hands them to the coefficient applier.
+ */
+template <typename AssembleFunc>
+void
+assemble_nonconformal_points(
+  const NonConformalDeviceInfo& info,
+  const int numDof,
+  const AssembleFunc& func)
+{
+  using ShmemDataType =
+    SharedMemData_NonConformal<DeviceTeamHandleType, DeviceShmem>;
+
+  const int numPoints = info.num_points();
+  if (numPoints == 0)
+    return;
+
+  const int maxRows = info.max_connected_nodes() * numDof;
+  const int bytes_per_team = 0;
+  const int bytes_per_thread =
+    (maxRows * (maxRows + 1)) * sizeof(double) + 2 * maxRows * sizeof(int);
+
+  constexpr int pointsPerTeam = 32;
+  const int numChunks = (numPoints + pointsPerTeam - 1) / pointsPerTeam;
+  auto team_exec =
+    get_device_team_policy(numChunks, bytes_per_team, bytes_per_thread);
+
+  Kokkos::parallel_for(
+    team_exec, KOKKOS_LAMBDA(const DeviceTeamHandleType& team) {
+      ShmemDataType smdata(team, maxRows);
+
+      const int chunkBegin = team.league_rank() * pointsPerTeam;
+      const int chunkLen = (chunkBegin + pointsPerTeam < numPoints)
+                             ? pointsPerTeam
+                             : numPoints - chunkBegin;
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, chunkLen),
+        [&](const int& k) { func(chunkBegin + k, smdata); });
+    });
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NONCONFORMALDEVICEINFO_H */
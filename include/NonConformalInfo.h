@@ -17,6 +17,8 @@
 //==============================================================================
 
 #include <master_element/MasterElement.h>
+#include <DgInfo.h>
+#include <FieldTypeDef.h>
 
 // stk
 #include <stk_mesh/base/Part.hpp>
@@ -39,7 +41,6 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
-class DgInfo;
 
 typedef stk::search::IdentProc<uint64_t,int>  theKey;
 typedef stk::search::Point<double> Point;
@@ -75,6 +76,7 @@ class NonConformalInfo {
     const bool clipIsoParametricCoords,
     const double searchTolerance,
     const bool   dynamicSearchTolAlg,
+    const double searchDriftTolerance,
     const std::string debugName);
 
   ~NonConformalInfo();
@@ -117,6 +119,12 @@ class NonConformalInfo {
   /* allow for dynamic search tolerance algorithm where search tolerance is used as point radius from isInElem */
   const bool dynamicSearchTolAlg_;
 
+  /* relative gauss point motion below which the previous opposing candidates are reused */
+  const double searchDriftTolerance_;
+
+  /* does any gauss point on any rank require the coarse search */
+  bool searchIsRequired_;
+
   /* does the realm have mesh motion */
   const bool meshMotion_;
 
@@ -127,13 +135,19 @@ class NonConformalInfo {
   std::vector<boundingSphere>     boundingSphereVec_;
   std::vector<boundingElementBox> boundingFaceElementBoxVec_;
 
-  /* vector of DgInfo */
+  /* DgInfo of all the gauss points, stored contiguously in face order */
+  std::vector<DgInfo> dgInfoStorage_;
+
+  /* vector of DgInfo; points into dgInfoStorage_ */
   std::vector<std::vector<DgInfo *> > dgInfoVec_;
 
   /* save off product of search */
   std::vector<std::pair<theKey, theKey> > searchKeyPair_;
 
   private :
+  bool within_drift_tolerance(const DgInfo *dgInfo, const VectorFieldType *coordinates) const;
+  void opposing_point(const DgInfo *dgInfo, const VectorFieldType *coordinates, double *opposingPoint) const;
+  void retain_cached_search(const std::vector<std::pair<theKey,theKey>> &previousKeyPair);
   void delete_range_points_found(std::vector<boundingSphere>                 &boundingSphereVec,
                                  const std::vector<std::pair<theKey,theKey>> &searchKeyPair) const;
   void repeat_search_if_needed  (const std::vector<boundingSphere>           &boundingSphereVec,
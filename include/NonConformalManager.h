@@ -16,6 +16,8 @@
 // Includes and forwards
 //==============================================================================
 
+#include <NonConformalDeviceInfo.h>
+
 // stk
 #include <stk_mesh/base/Part.hpp>
 #include <stk_mesh/base/Ghosting.hpp>
@@ -57,6 +59,10 @@ class NonConformalManager {
 
   void initialize();
 
+  /* communicate the device values of the fields over the ghosting */
+  void ngp_communicate_field_data(
+    const std::vector<const stk::mesh::FieldBase*>& fieldVec) const;
+
   Realm &realm_;
   const bool ncAlgDetailedOutput_;
   const bool ncAlgCoincidentNodesErrorCheck_;
@@ -69,6 +75,9 @@ class NonConformalManager {
 
   std::vector<int> ghostCommProcs_;
 
+  /* DgInfo of all the interfaces, flattened for the device algorithms */
+  NonConformalDeviceInfo deviceInfo_;
+
   private:
 
   void manage_ghosting(std::vector<stk::mesh::EntityKey>& recvGhostsToRemove);
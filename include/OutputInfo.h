@@ -39,6 +39,12 @@ public:
   
   int get_restart_compression();
   bool get_restart_shuffle();
+
+  // restart written to a single file through parallel I/O
+  bool composed_restart() const { return restartIOMode_ == "composed"; }
+
+  // restart files staged on node-local storage
+  bool staged_restart() const { return !restartStagingPath_.empty(); }
   
   std::string outputDBName_;
   
@@ -63,8 +69,17 @@ public:
   bool restartNodeSet_;
   int outputCompressionLevel_;
   bool outputCompressionShuffle_;
+  std::string outputPrecision_;
+  int outputSignificantDigits_;
+  std::string outputCompressionMethod_;
   int restartCompressionLevel_;
   bool restartCompressionShuffle_;
+  std::string restartIOMode_;
+  std::string restartParallelIOMode_;
+  std::string restartStagingPath_;
+  std::string promotedOutputType_;
+  bool promotedComposed_;
+  std::string promotedParallelIOMode_;
 
   std::pair<bool, double> userWallTimeResults_;
   std::pair<bool, double> userWallTimeRestart_;
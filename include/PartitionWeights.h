@@ -0,0 +1,129 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PARTITIONWEIGHTS_H
+#define PARTITIONWEIGHTS_H
+
+#include "FieldTypeDef.h"
+
+#include <stk_balance/balanceUtils.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Element weights of the initial decomposition
+ *
+ *  Every element starts with a weight of one. Subsystems whose work is
+ *  concentrated in part of the mesh register regions with a weight before
+ *  the mesh is balanced: the actuator source regions, the overset fringe
+ *  and donor zones and the elements along wall-function surfaces. The
+ *  weights of overlapping regions multiply. Users add their own regions
+ *  over element blocks or boxes in `rebalance_weights`.
+ */
+class PartitionWeights
+{
+public:
+  PartitionWeights(Realm& realm, const YAML::Node& node);
+
+  void load(const YAML::Node& node);
+
+  //! Declare the weight field on the element blocks of the realm
+  void setup();
+
+  //! Elements of the element blocks
+  void add_part_weight(const stk::mesh::PartVector& parts, const double weight);
+
+  //! Elements with a node on the side parts
+  void add_surface_weight(
+    const stk::mesh::PartVector& sideParts, const double weight);
+
+  //! Elements with their centroid inside the box
+  void add_box_weight(
+    const std::array<double, 3>& boxMin,
+    const std::array<double, 3>& boxMax,
+    const double weight);
+
+  //! Fill the weight field of the locally owned elements
+  void compute();
+
+  const ScalarFieldType& weight_field() const { return *weightField_; }
+
+  // weights of the subsystem regions; one disables a subsystem
+  double actuatorWeight_{4.0};
+  double oversetWeight_{2.0};
+  double wallFunctionWeight_{1.5};
+
+private:
+  struct PartRegion
+  {
+    stk::mesh::PartVector parts_;
+    double weight_;
+  };
+
+  struct BoxRegion
+  {
+    std::array<double, 3> min_;
+    std::array<double, 3> max_;
+    double weight_;
+  };
+
+  void part_names_to_parts(
+    const std::vector<std::string>& names, stk::mesh::PartVector& parts) const;
+
+  Realm& realm_;
+  ScalarFieldType* weightField_{nullptr};
+
+  //! User regions, resolved to parts in setup()
+  std::vector<std::pair<std::vector<std::string>, double>> userParts_;
+
+  std::vector<PartRegion> partRegions_;
+  std::vector<PartRegion> surfaceRegions_;
+  std::vector<BoxRegion> boxRegions_;
+};
+
+/** Balance settings reading the element weights from the weight field
+ *
+ *  Elements without the field keep a weight of one.
+ */
+class PartitionWeightSettings : public stk::balance::GraphCreationSettings
+{
+public:
+  explicit PartitionWeightSettings(const ScalarFieldType& weightField)
+    : weightField_(weightField)
+  {}
+
+  using stk::balance::GraphCreationSettings::getGraphVertexWeight;
+
+  virtual bool areVertexWeightsProvidedViaFields() const override
+  {
+    return true;
+  }
+
+  virtual double getGraphVertexWeight(
+    stk::mesh::Entity entity, int criteria_index = 0) const override;
+
+private:
+  const ScalarFieldType& weightField_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* PARTITIONWEIGHTS_H */
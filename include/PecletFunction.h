@@ -13,6 +13,7 @@
 #define PecletFunction_h
 
 #include "KokkosInterface.h"
+#include "SimdInterface.h"
 
 namespace sierra{
 namespace nalu{
@@ -55,6 +56,75 @@ public:
   T c2_; // width of the transtion
 };
 
+enum class PecletFunctionForm { CLASSIC = 0, TANH = 1, TANH_TABLE = 2 };
+
+/** Peclet blending function evaluated without virtual dispatch
+ *
+ *  A copyable value type captured by the edge algorithm lambdas. The form is
+ *  fixed when the algorithm is constructed, so the branch in execute() is
+ *  uniform across the kernel and the blending is inlined in the edge loop.
+ *  The tanh form can be tabulated on construction, in which case execute()
+ *  interpolates linearly between the table entries instead of calling tanh.
+ */
+template<typename T>
+class NgpPecletFunction
+{
+public:
+  using TableType = Kokkos::View<double*, MemSpace>;
+
+  KOKKOS_DEFAULTED_FUNCTION NgpPecletFunction() = default;
+
+  /**
+   *  @param form Classic or tanh blending
+   *  @param p1 Hybrid factor (classic) or transition Peclet number (tanh)
+   *  @param p2 Width of the transition (tanh only)
+   *  @param tableSize Entries of the tanh table, no table when less than two
+   */
+  NgpPecletFunction(
+    PecletFunctionForm form, double p1, double p2, int tableSize = 0);
+
+  KOKKOS_FORCEINLINE_FUNCTION T execute(const T indVar) const
+  {
+    if (form_ == PecletFunctionForm::CLASSIC) {
+      const T modPeclet = p1_ * indVar;
+      return modPeclet * modPeclet / (5.0 + modPeclet * modPeclet);
+    }
+    if (form_ == PecletFunctionForm::TANH_TABLE)
+      return interpolate(indVar);
+    return 0.50 * (1.0 + stk::math::tanh((indVar - p1_) / p2_));
+  }
+
+  PecletFunctionForm form() const { return form_; }
+
+private:
+  KOKKOS_FORCEINLINE_FUNCTION double interpolate(const double x) const
+  {
+    const int last = static_cast<int>(table_.extent(0)) - 1;
+    const double s = (x - xmin_) * invDx_;
+    if (!(s > 0.0)) return table_(0);
+    if (s >= last) return table_(last);
+    const int i = static_cast<int>(s);
+    const double w = s - i;
+    return table_(i) + w * (table_(i + 1) - table_(i));
+  }
+
+  template<typename U>
+  KOKKOS_FORCEINLINE_FUNCTION U interpolate(const U& x) const
+  {
+    U result;
+    for (int n = 0; n < stk::simd::ndoubles; ++n)
+      stk::simd::set_data(result, n, interpolate(stk::simd::get_data(x, n)));
+    return result;
+  }
+
+  PecletFunctionForm form_{PecletFunctionForm::CLASSIC};
+  double p1_{0.0};
+  double p2_{1.0};
+  double xmin_{0.0};
+  double invDx_{0.0};
+  TableType table_;
+};
+
 } // namespace nalu
 } // namespace Sierra
 
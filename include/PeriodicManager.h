@@ -27,6 +27,7 @@
 #include <stk_search/CoarseSearch.hpp>
 #include <stk_search/IdentProc.hpp>
 
+#include <cstdint>
 #include <vector>
 #include <list>
 #include <map>
@@ -61,6 +62,9 @@ class PeriodicManager {
 
   void build_constraints();
 
+  //! Per rank file of the master/slave pairs, read instead of searching
+  void set_pair_cache(const std::string& fileName) { pairCacheName_ = fileName; }
+
   // holder for master += slave; slave = master
   void apply_constraints(
     stk::mesh::FieldBase *,
@@ -115,6 +119,14 @@ class PeriodicManager {
     std::vector<double> &translationVector,
     const stk::search::SearchMethod searchMethod);
 
+  /* match slave nodes translated onto the master plane by their quantized
+     coordinates; returns the pairs held by this rank */
+  void match_translated_coordinates(
+    stk::mesh::Selector masterSelector,
+    stk::mesh::Selector slaveSelector,
+    std::vector<double> &translationVector,
+    std::vector<std::pair<theEntityKey, theEntityKey> > &searchKeyPair);
+
   void error_check();
 
   void update_global_id_field();
@@ -158,6 +170,7 @@ class PeriodicManager {
   typedef std::pair<stk::mesh::Selector, stk::mesh::Selector> SelectorPair;
   typedef std::vector<std::pair<theEntityKey,theEntityKey> > SearchKeyVector;
   typedef Kokkos::View<KokkosEntityPair*, Kokkos::LayoutRight, MemSpace> KokkosEntityPairView;
+  typedef Kokkos::View<stk::mesh::FastMeshIndex*, Kokkos::LayoutRight, MemSpace> MeshIndexView;
 
   std::vector<int> ghostCommProcs_;
 
@@ -186,18 +199,32 @@ class PeriodicManager {
   // vector of search types
   std::vector<stk::search::SearchMethod> searchMethodVec_;
 
+  // match by coordinate keys before searching (search_method: coordinate_hash)
+  bool useCoordinateHash_{false};
+
   // translation and rotation
   std::vector<std::vector<double> > translationVector_;
   std::vector<std::vector<double> > rotationVector_;
 
   // vector of masterEntity:slaveEntity
   std::vector<EntityPair> masterSlaveCommunicator_;
-  KokkosEntityPairView deviceMasterSlaves_;
-  KokkosEntityPairView::HostMirror hostMasterSlaves_;
+  // bucket locations of the master and slave of each pair, flattened once so
+  // the ngp constraints are a single gather/scatter; rebuilt on mesh changes
+  mutable MeshIndexView deviceMasterIndex_;
+  mutable MeshIndexView deviceSlaveIndex_;
+  mutable size_t meshIndexSyncCount_{0};
+
+  void update_mesh_index_views() const;
 
   // culmination of all searches
   SearchKeyVector searchKeyVector_;
 
+  // pairs cached from an earlier run on the same mesh and decomposition
+  std::string pairCacheName_;
+  uint64_t pairCacheChecksum_{0};
+  bool pairCacheRead_{false};
+  bool pairCacheHit_{false};
+
   void add_slave_to_master(
     stk::mesh::FieldBase *theField,
     const unsigned &sizeOfField,
@@ -78,6 +78,12 @@ public:
     const stk::topology &theTopo,
     const SymmetryBoundaryConditionData &symmetryBCData);
 
+  // device kernels when the topology allows, the host algorithm otherwise
+  void register_boundary_solver_alg(
+    stk::mesh::Part *part,
+    const AlgorithmType algType,
+    const std::string &fieldName);
+
   // not supported
   void register_non_conformal_bc(
     stk::mesh::Part *part,
@@ -24,10 +24,12 @@
 #include <Teuchos_RCP.hpp>
 #endif
 
+#include <LinearSystemGraphRegistry.h>
 #include <ngp_utils/NgpFieldManager.h>
 #include "ngp_utils/NgpMeshInfo.h"
 
 #include "stk_mesh/base/NgpMesh.hpp"
+#include "stk_util/parallel/Parallel.hpp"
 
 // standard c++
 #include <map>
@@ -65,6 +67,8 @@ class ErrorIndicatorAlgorithmDriver;
 class EquationSystems;
 class OutputInfo;
 class OversetManager;
+struct OversetFieldData;
+struct TpetraGraphData;
 class PostProcessingInfo;
 class PeriodicManager;
 class Realms;
@@ -74,11 +78,22 @@ class TimeIntegrator;
 class MasterElement;
 class PropertyEvaluator;
 class Transfer;
+class LocalTimeStepAlg;
 class MeshMotionAlg;
+class RefinementIndicatorAlg;
+class GclFactorAlg;
 class MeshTransformationAlg;
 
 class SolutionNormPostProcessing;
 class SideWriterContainer;
+class InSituExtraction;
+class BoundaryPlaneWriter;
+class BoundaryPlaneReader;
+class ABLMeshGenerator;
+class PartitionWeights;
+class ElementSearchTreeCache;
+class MasterElementGeometryCache;
+class RestartStager;
 class TurbulenceAveragingPostProcessing;
 class DataProbePostProcessing;
 struct ActuatorModel;
@@ -88,6 +103,7 @@ class BdyLayerStatistics;
 class TensorProductQuadratureRule;
 class LagrangeBasis;
 class PromotedElementIO;
+struct MemoryRecord;
 
 /** Representation of a computational domain and physics equations solved on
  * this domain.
@@ -120,6 +136,15 @@ class Realm {
   void provide_memory_summary();
   std::string convert_bytes(double bytes);
 
+  /// predict the memory per rank from the input mesh counts before the
+  /// mesh and field data are allocated
+  void plan_memory();
+
+  /// print records sorted by their maximum over the ranks; returns the
+  /// maximum over the ranks of the record sum
+  double report_memory_records(
+    const std::string& title, const std::vector<MemoryRecord>& records);
+
   void create_mesh();
 
   void setup_nodal_fields();
@@ -146,10 +171,25 @@ class Realm {
 
   void balance_nodes();
 
+  // report the measured imbalance of assembly and solve across the ranks;
+  // reporting only, the mesh is not repartitioned during the run
+  void monitor_load_balance();
+
+  //! Write the decomposed mesh, one file per rank, after any rebalancing
+  void write_decomposed_mesh();
+
   void create_output_mesh();
   void create_restart_mesh();
   void input_variables_from_mesh();
 
+  /** Return true if a diagnostic field is needed by this realm
+   *
+   *  A field is needed when it is listed in the output variables or named
+   *  anywhere in the realm input (probes, averaging, side writers, ...).
+   *  Always true when prune_output_only_fields is disabled.
+   */
+  bool field_is_requested(const std::string& fieldName) const;
+
   void augment_output_variable_list(
       const std::string fieldName);
   
@@ -157,6 +197,41 @@ class Realm {
       std::string restartFieldName);
 
   void create_edges();
+
+  /** Greedy coloring of the locally owned edges such that no two edges of
+   *  the same color share a node; indexed by the edge local offset
+   */
+  void compute_edge_coloring();
+  const std::vector<int>& edge_colors();
+  int num_edge_colors() const { return numEdgeColors_; }
+
+  //! Colored, atomic-free edge assembly is requested and safe for this mesh
+  bool use_edge_coloring() const { return edgeColoring_ && !hasPeriodic_; }
+
+  /** Place the edges and elements touching a shared node in the halo part
+   *  used by split-phase assembly
+   */
+  void mark_halo_adjacent_entities();
+
+  //! Split-phase assembly with overlapped parallel sums is active
+  bool split_phase_halo_exchange() const
+  {
+    return splitPhaseHaloExchange_ && haloAdjacentPart_ != nullptr;
+  }
+
+  void set_assembly_phase(AssemblyPhase phase) { assemblyPhase_ = phase; }
+
+  //! Entities visited by split-phase capable algorithms in the current phase
+  stk::mesh::Selector assembly_phase_selector() const;
+
+  //! Reorder nodes and elements within their buckets for memory locality
+  void sort_entities_for_locality();
+
+  //! Local row numbering follows the bucket order instead of the entity ids
+  bool has_local_entity_ordering() const
+  {
+    return localEntityOrdering_ != LocalityOrdering::NONE;
+  }
   void provide_entity_count();
   void delete_edges();
   void commit();
@@ -181,6 +256,15 @@ class Realm {
 
   void compute_geometry();
   void compute_vrtm(const std::string& = "velocity");
+
+  //! Nodal pseudo-time steps of the steady-state local time stepping
+  void compute_local_time_step();
+
+  //! Error indicator of a solution-adaptive refinement
+  void compute_refinement_indicator();
+
+  //! GCL factor of a deforming mesh, shared by the equations of a step
+  void compute_gcl_factor();
   void compute_l2_scaling();
   void output_converged_results();
   void provide_output();
@@ -234,6 +318,14 @@ class Realm {
   void setup_overset_bc(
     const OversetBoundaryConditionData &oversetBCData);
 
+  /** Copy the owned values of a nodal field to the shared nodes and to the
+   *  ghosted nodes of the aura, overset, non-conformal and periodic ghostings
+   *
+   *  The aura is only communicated when it is active; the algorithms that
+   *  need off-rank data rely on the explicit ghostings of the managers.
+   */
+  void communicate_ghosted_field(stk::mesh::FieldBase* theField);
+
   void periodic_field_update(
     stk::mesh::FieldBase *theField,
     const unsigned &sizeOfTheField,
@@ -260,6 +352,9 @@ class Realm {
     const unsigned nCols,
     const bool doFinalSyncToDevice = true);
 
+  //! Update the fringe values of several fields in one exchange
+  void overset_fields_update(const std::vector<OversetFieldData>& fields);
+
   virtual void populate_initial_condition();
   virtual void populate_boundary_data();
   virtual void boundary_data_to_state_data();
@@ -289,7 +384,13 @@ class Realm {
   /// check job for fitting in memory
   void check_job(bool get_node_count);
 
+  /// conservative number of matrix entries per row and dof squared
+  unsigned matrix_bandwidth_factor() const;
+
   void dump_simulation_time();
+
+  //! Add wall time to a named phase of the startup report
+  void add_startup_phase_time(const std::string& phase, const double time);
   double provide_mean_norm();
 
   double get_hybrid_factor(
@@ -325,6 +426,8 @@ class Realm {
     const std::string dofname);
   double get_tanh_width(
     const std::string dofname);
+  int get_tanh_table_size(
+    const std::string dofname);
 
   // consistent mass matrix for projected nodal gradient
   bool get_consistent_mass_matrix_png(
@@ -368,6 +471,11 @@ class Realm {
   stk::mesh::MetaData & meta_data();
   const stk::mesh::MetaData & meta_data() const;
 
+  // communicator of the realm's mesh and of the realm-wide reductions in
+  // Realm.C; always the job communicator, since every realm spans all ranks
+  // and the realms advance one after the other
+  stk::ParallelMachine parallel_comm() const;
+
   inline NgpMeshInfo& mesh_info()
   {
     if ((meshModCount_ != bulkData_->synchronized_count()) ||
@@ -404,6 +512,7 @@ class Realm {
   std::string name_;
   std::string type_;
   std::string inputDBName_;
+  std::unique_ptr<ABLMeshGenerator> ablMeshGenerator_;
   unsigned spatialDimension_;
 
   bool realmUsesEdges_;
@@ -418,6 +527,10 @@ class Realm {
   stk::mesh::BulkData *bulkData_;
   stk::io::StkMeshIoBroker *ioBroker_;
   std::unique_ptr<SideWriterContainer> sideWriters_;
+  std::unique_ptr<InSituExtraction> inSituExtraction_;
+  std::unique_ptr<BoundaryPlaneWriter> boundaryPlaneWriter_;
+  std::unique_ptr<BoundaryPlaneReader> boundaryPlaneReader_;
+  std::unique_ptr<RestartStager> restartStager_;
 
   size_t resultsFileIndex_;
   size_t restartFileIndex_;
@@ -455,6 +568,9 @@ class Realm {
   BdyLayerStatistics* bdyLayerStats_{nullptr};
   std::unique_ptr<MeshMotionAlg> meshMotionAlg_;
   std::unique_ptr<MeshTransformationAlg> meshTransformationAlg_;
+  std::unique_ptr<LocalTimeStepAlg> localTimeStepAlg_;
+  std::unique_ptr<RefinementIndicatorAlg> refinementIndicatorAlg_;
+  std::unique_ptr<GclFactorAlg> gclFactorAlg_;
 
   std::vector<Algorithm *> propertyAlg_;
   std::map<PropertyIdentifier, ScalarFieldType *> propertyMap_;
@@ -463,6 +579,7 @@ class Realm {
   SizeType nodeCount_;
   bool estimateMemoryOnly_;
   double availableMemoryPerCoreGB_;
+  bool memoryPlan_{false};
   double timerActuator_{0};
   double timerCreateMesh_;
   double timerPopulateMesh_;
@@ -478,6 +595,9 @@ class Realm {
   double timerPromoteMesh_;
   double timerSortExposedFace_;
 
+  //! Accumulated wall time of every startup phase, in the order first seen
+  std::vector<std::pair<std::string, double>> startupPhaseTimes_;
+
   NonConformalManager *nonConformalManager_;
   OversetManager *oversetManager_;
   bool hasNonConformal_;
@@ -490,6 +610,10 @@ class Realm {
   bool hasIoTransfer_;
   bool hasExternalDataTransfer_;
 
+  // the mesh and the realm-wide reductions of Realm.C use this communicator;
+  // it is set to the job communicator and not split per realm
+  stk::ParallelMachine realmComm_;
+
   PeriodicManager *periodicManager_;
   bool hasPeriodic_;
   bool hasFluids_;
@@ -523,6 +647,35 @@ class Realm {
   bool rebalanceMesh_{false};
   
   std::string rebalanceMethod_;
+
+  // element weights of the rebalance; nullptr balances elements equally
+  std::unique_ptr<PartitionWeights> partitionWeights_;
+
+  // file name of the decomposed mesh to write after rebalancing
+  std::string decomposedMeshName_;
+
+  // per rank file of the element edge ids, read instead of creating edges
+  std::string edgeCacheName_;
+
+  // per rank file of the static geometry data, read instead of searching
+  std::string geometryCacheName_;
+
+  // split-phase assembly overlapping the parallel sums with interior work
+  bool splitPhaseHaloExchange_{false};
+
+  // pass device buffers to MPI in the split-phase exchanges
+  bool deviceAwareMpi_{false};
+
+  // sum with ranks on the same node through MPI-3 shared memory windows
+  bool sharedMemoryHaloExchange_{false};
+
+  // only allocate output-only diagnostic fields that are requested
+  bool pruneOutputOnlyFields_{true};
+  stk::mesh::Part* haloAdjacentPart_{nullptr};
+  AssemblyPhase assemblyPhase_{AssemblyPhase::ALL};
+
+  // locality ordering of nodes and elements within their buckets
+  LocalityOrdering localEntityOrdering_{LocalityOrdering::NONE};
    
   // allow aura to be optional
   bool activateAura_;
@@ -530,6 +683,14 @@ class Realm {
   // allow detailed output (memory) to be provided
   bool activateMemoryDiagnostic_;
 
+  // count the host/device field transfers of every step
+  bool activateSyncAudit_{false};
+
+  // measured assembly and solve time of this rank, checked every so many steps
+  int loadBalanceMonitorFreq_{0};
+  double loadImbalanceThreshold_{1.25};
+  double lastRankCost_{0.0};
+
   // sometimes restarts can be missing states or dofs
   bool supportInconsistentRestart_;
 
@@ -577,6 +738,7 @@ class Realm {
   std::vector<Transfer *> initializationTransferVec_;
   std::vector<Transfer *> ioTransferVec_;
   std::vector<Transfer *> externalDataTransferVec_;
+  std::vector<Transfer *> boundaryPlaneTransferVec_;
   void augment_transfer_vector(Transfer *transfer, const std::string transferObjective, Realm *toRealm);
   void process_multi_physics_transfer();
   void process_initialization_transfer();
@@ -592,6 +754,7 @@ class Realm {
   double get_gamma1();
   double get_gamma2();
   double get_gamma3();
+  double get_predictor_extrapolation();
   int get_time_step_count() const;
   double get_time_step_from_file();
   bool get_is_fixed_time_step();
@@ -637,6 +800,53 @@ class Realm {
   bool matrix_free() const;
   bool matrixFree_{false};
 
+  //! Assemble edge algorithms one conflict-free color at a time
+  bool edgeColoring_{false};
+  std::vector<int> edgeColors_;
+  int numEdgeColors_{0};
+  size_t edgeColoringSyncCount_{0};
+
+  //! Reuse master element geometry in element assembly between mesh motions
+  bool cacheMasterElementGeometry_{false};
+
+  //! Flatten the buckets of each element assembly into one entity list
+  bool coalesceElementBuckets_{false};
+
+  //! Flatten the node buckets of the node kernel assembly
+  bool coalesceNodeBuckets_{false};
+
+  //! Entities per team of the coalesced element and node assembly
+  int coalescedChunkSize_{512};
+
+  //! Time the element assemblies and report entities per second
+  bool reportAssemblyThroughput_{false};
+
+  //! Print the per-thread scratch bytes of every element assembly once
+  bool reportScratchUsage_{false};
+
+  //! Advanced whenever the mesh moves so cached geometry is recomputed
+  unsigned geometry_cache_epoch() const { return geometryCacheEpoch_; }
+  void invalidate_geometry_cache() { ++geometryCacheEpoch_; }
+  unsigned geometryCacheEpoch_{0};
+
+  /** Geometry cache shared by the element algorithms on the same parts
+   *
+   *  Keyed by the entity rank and the sorted ordinals of the parts, so that
+   *  the momentum, continuity and scalar assemblies of a block reuse the
+   *  master element geometry computed by the first of them.
+   */
+  std::shared_ptr<MasterElementGeometryCache> shared_geometry_cache(
+    stk::mesh::EntityRank rank, const stk::mesh::PartVector& parts);
+  std::map<std::string, std::shared_ptr<MasterElementGeometryCache>>
+    sharedGeometryCaches_;
+
+  //! Element search trees shared by the actuator and data probe searches
+  ElementSearchTreeCache& element_search_trees();
+  std::shared_ptr<ElementSearchTreeCache> elementSearchTrees_;
+
+  //! Rotate area vectors of rigid body frames instead of recomputing geometry
+  bool rigidBodyGeometryUpdate_{false};
+
   Teuchos::ParameterList solver_parameters(std::string) const;
 
   stk::mesh::PartVector allPeriodicInteractingParts_;
@@ -678,6 +888,11 @@ class Realm {
   HypreIDFieldType* hypreGlobalId_{nullptr};
   TpetIDFieldType* tpetGlobalId_{nullptr};
 
+  //! Graphs of the Tpetra linear systems, shared by identical stencils
+  LinearSystemGraphRegistry<TpetraGraphData> tpetraGraphRegistry_;
+  //! The same graphs, keyed by the graph builds that produced them
+  LinearSystemGraphRegistry<TpetraGraphData> tpetraStencilRegistry_;
+
   /** Flag indicating whether Hypre solver is being used for any of the equation
    * systems.
    */
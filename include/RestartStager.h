@@ -0,0 +1,89 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef RESTARTSTAGER_H
+#define RESTARTSTAGER_H
+
+#include <mpi.h>
+
+#include <exception>
+#include <string>
+#include <thread>
+
+namespace sierra {
+namespace nalu {
+
+/** Staging of the per-rank restart files on node-local storage
+ *
+ *  The restart database is written to `stagingPath`, typically a node-local
+ *  NVMe or burst buffer mount, so that a checkpoint only stalls the solver
+ *  for the local write. After each checkpoint a background thread per rank
+ *  copies the staged file of the rank next to the destination database on
+ *  the parallel file system, through a temporary name and a rename.
+ *
+ *  Once every rank has drained a checkpoint, rank 0 writes the marker file
+ *  `<destination>.complete` holding the time step count and time of the
+ *  checkpoint. The marker is removed before the destination files are
+ *  replaced, so that a present marker always describes a complete set of
+ *  files on the parallel file system.
+ */
+class RestartStager
+{
+public:
+  RestartStager(
+    const std::string& stagingPath,
+    const std::string& destination,
+    MPI_Comm comm);
+
+  //! Waits for the pending drain and writes its marker
+  ~RestartStager();
+
+  RestartStager(const RestartStager&) = delete;
+  RestartStager& operator=(const RestartStager&) = delete;
+
+  //! Name of the restart database to write, inside the staging directory
+  const std::string& staged_name() const { return stagedName_; }
+
+  /** Wait for the drain of the previous checkpoint and write its marker
+   *
+   *  Collective; must be called before the staged database is written
+   *  again. Throws if the copy failed on any rank.
+   */
+  void wait();
+
+  /** Start draining the checkpoint just written and flushed to disk
+   *
+   *  Collective; the copy runs in the background until the next wait().
+   */
+  void drain(const int timeStepCount, const double time);
+
+  //! Name of the completion marker of the destination database
+  static std::string marker_name(const std::string& destination);
+
+private:
+  void copy_staged_file();
+
+  MPI_Comm comm_;
+  int rank_{0};
+  int numRanks_{1};
+  std::string destination_;
+  std::string stagedName_;
+
+  // checkpoint being drained
+  std::thread drainThread_;
+  bool draining_{false};
+  int drainStep_{0};
+  double drainTime_{0.0};
+  std::exception_ptr drainError_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* RESTARTSTAGER_H */
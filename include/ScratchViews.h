@@ -118,7 +118,8 @@ public:
     MasterElement* meSCS,
     MasterElement* meSCV,
     MasterElement* meFEM,
-    int faceOrdinal = 0);
+    int faceOrdinal = 0,
+    unsigned skipMask = 0u);
 
   SharedMemView<T**, SHMEM> fc_areav;
   SharedMemView<T**, SHMEM> scs_areav;
@@ -209,11 +210,19 @@ class ScratchViews
 public:
   typedef T value_type;
 
+  /** Allocate the gathered field views and, unless createMasterElementViews
+   *  is false, the master element views of the requests
+   *
+   *  Per-lane gather buffers whose contents are interleaved into a SIMD
+   *  instance skip the master element views, which are only computed on the
+   *  SIMD instance.
+   */
   KOKKOS_FUNCTION
   ScratchViews(const TEAMHANDLETYPE& team,
                unsigned nDim,
                int nodesPerEntity,
-               const ElemDataRequestsGPU& dataNeeded);
+               const ElemDataRequestsGPU& dataNeeded,
+               bool createMasterElementViews = true);
 
   KOKKOS_DEFAULTED_FUNCTION
   ~ScratchViews() = default;
@@ -686,10 +695,14 @@ void MasterElementViews<T, TEAMHANDLETYPE, SHMEM>::fill_master_element_views_new
   MasterElement* meSCS,
   MasterElement* meSCV,
   MasterElement* meFEM,
-  int faceOrdinal
+  int faceOrdinal,
+  unsigned skipMask
   )
 {
   for(unsigned i=0; i<dataEnums.size(); ++i) {
+    // requests already provided by the caller, e.g. from a geometry cache
+    if (skipMask & (1u << dataEnums(i))) continue;
+
     switch(dataEnums(i))
     {
       case FC_AREAV:
@@ -770,10 +783,12 @@ template<typename T,typename TEAMHANDLETYPE,typename SHMEM>
 ScratchViews<T,TEAMHANDLETYPE,SHMEM>::ScratchViews(const TEAMHANDLETYPE& team,
              unsigned nDim,
              int nodalGatherSize,
-             const ElemDataRequestsGPU& dataNeeded)
+             const ElemDataRequestsGPU& dataNeeded,
+             bool createMasterElementViews)
   : fieldViews(team, dataNeeded.get_total_num_fields(), count_needed_field_views(dataNeeded.get_fields()))
 {
   num_bytes_required = create_needed_field_views<T,SHMEM>(team, dataNeeded, nodalGatherSize, fieldViews) * sizeof(T);
+  if (!createMasterElementViews) return;
 
   /* master elements are allowed to be null if they are not required */
   MasterElement *meFC = dataNeeded.get_cvfem_face_me();
@@ -839,6 +854,9 @@ int get_num_scalars_pre_req_data(
   const ElemDataRequestsGPU& dataNeededBySuppAlgs, int nDim,
   const ElemReqType reqType);
 
+//! Scalars of the gathered field views alone, without master element data
+int get_num_scalars_gathered_fields(const ElemDataRequestsGPU& dataNeeded);
+
 template<typename T>
 KOKKOS_FUNCTION
 void fill_pre_req_data(const ElemDataRequestsGPU& dataNeeded,
@@ -881,6 +899,85 @@ int get_num_bytes_pre_req_data(
   return sizeof(T) * get_num_scalars_pre_req_data(dataNeededBySuppAlgs, nDim, reqType);
 }
 
+/** Upper bound on the bytes lost when every view of one ScratchViews
+ *  instance is shifted up to the SIMD alignment boundary
+ */
+template <typename ELEMDATAREQUESTSTYPE>
+int get_num_bytes_simd_alignment_padding(
+  const ELEMDATAREQUESTSTYPE& dataNeededBySuppAlgs)
+{
+#ifndef KOKKOS_ENABLE_CUDA
+  const NumNeededViews numViews =
+    count_needed_field_views(dataNeededBySuppAlgs.get_host_fields());
+  // gij and the shifted variants allocate at most two views per request
+  constexpr int maxMasterElementViews = 2 * (END_FEM + 1) * MAX_COORDS_TYPES;
+  const int numFieldViews = numViews.num1DViews + numViews.num2DViews +
+                            numViews.num3DViews + numViews.num4DViews;
+  return (numFieldViews + maxMasterElementViews) * simdAlignment;
+#else
+  (void)dataNeededBySuppAlgs;
+  return 0;
+#endif
+}
+
+/** Per-thread scratch memory of the SharedMemData of one team thread
+ *
+ *  Only views that are live at the same time are counted separately. The
+ *  SIMD views hold the gathered fields and master element data of a whole
+ *  SIMD group. On the host, one lane gather buffer without master element
+ *  views is reused for every entity of the group, as it is interleaved into
+ *  its lane before the next entity is gathered. The SIMD and single lane
+ *  lhs/rhs and the scatter ids are needed by the kernels and the scatter.
+ */
+struct ElemScratchPlan
+{
+  int simdViewBytes{0};
+  int laneGatherBytes{0};
+  int assemblyBytes{0};
+  int paddingBytes{0};
+
+  int total_bytes() const
+  {
+    return simdViewBytes + laneGatherBytes + assemblyBytes + paddingBytes;
+  }
+};
+
+template <typename ELEMDATAREQUESTSTYPE>
+inline ElemScratchPlan
+plan_elem_scratch(
+  int lhsSize,
+  int rhsSize,
+  int scratchIdsSize,
+  int nDim,
+  const ELEMDATAREQUESTSTYPE& dataNeededByKernels,
+  const ElemReqType reqType = ElemReqType::ELEM)
+{
+  const auto numViews =
+    count_needed_field_views(dataNeededByKernels.get_host_fields());
+  const unsigned numFields = dataNeededByKernels.get_total_num_fields();
+
+  ElemScratchPlan plan;
+  plan.simdViewBytes =
+    get_num_bytes_pre_req_data<DoubleType>(dataNeededByKernels, nDim, reqType) +
+    MultiDimViews<DoubleType>::bytes_needed(numFields, numViews);
+#ifndef KOKKOS_ENABLE_CUDA
+  // keeps the 64 byte margin of get_num_scalars_pre_req_data
+  plan.laneGatherBytes =
+    (get_num_scalars_gathered_fields(dataNeededByKernels) + 8) *
+      sizeof(double) +
+    MultiDimViews<double>::bytes_needed(numFields, numViews);
+#endif
+  plan.assemblyBytes =
+    (rhsSize + lhsSize) * (sizeof(DoubleType) + sizeof(double)) +
+    (2 * scratchIdsSize) * sizeof(int);
+
+  // both ScratchViews instances and the six lhs/rhs/id views
+  plan.paddingBytes =
+    2 * get_num_bytes_simd_alignment_padding(dataNeededByKernels) +
+    6 * simdAlignment;
+  return plan;
+}
+
 template <typename ELEMDATAREQUESTSTYPE>
 inline int
 calculate_shared_mem_bytes_per_thread(
@@ -891,15 +988,9 @@ calculate_shared_mem_bytes_per_thread(
   const ELEMDATAREQUESTSTYPE& dataNeededByKernels,
   const ElemReqType reqType = ElemReqType::ELEM)
 {
-  int bytes_per_thread =
-    (rhsSize + lhsSize) * sizeof(double) + (2 * scratchIdsSize) * sizeof(int) +
-    get_num_bytes_pre_req_data<double>(dataNeededByKernels, nDim, reqType) +
-    MultiDimViews<double>::bytes_needed(
-      dataNeededByKernels.get_total_num_fields(),
-      count_needed_field_views(dataNeededByKernels.get_host_fields()));
-
-  bytes_per_thread *= 2 * simdLen;
-  return bytes_per_thread;
+  return plan_elem_scratch(
+           lhsSize, rhsSize, scratchIdsSize, nDim, dataNeededByKernels, reqType)
+    .total_bytes();
 }
 
 inline
@@ -929,6 +1020,8 @@ calculate_shared_mem_bytes_per_thread(
       faceDataNeeded, nDim, ElemReqType::FACE) +
     sierra::nalu::get_num_bytes_pre_req_data<double>(
       elemDataNeeded, nDim, ElemReqType::FACE_ELEM) +
+    get_num_bytes_simd_alignment_padding(faceDataNeeded) +
+    get_num_bytes_simd_alignment_padding(elemDataNeeded) +
     MultiDimViews<double>::bytes_needed(
       faceDataNeeded.get_total_num_fields(),
       count_needed_field_views(faceDataNeeded.get_host_fields())) +
@@ -34,9 +34,10 @@ struct SharedMemData {
      : simdPrereqData(team, nDim, nodesPerEntity, dataNeededByKernels)
     {
 #ifndef KOKKOS_ENABLE_CUDA
-        for(int simdIndex=0; simdIndex<simdLen; ++simdIndex) {
-          prereqData[simdIndex] = std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM> >(new ScratchViews<double,TEAMHANDLETYPE,SHMEM>(team, nDim, nodesPerEntity, dataNeededByKernels));
-        }
+        // a single gather buffer, interleaved into its SIMD lane before the
+        // next entity is gathered; master element data lives only in the
+        // SIMD views
+        prereqData[0] = std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM> >(new ScratchViews<double,TEAMHANDLETYPE,SHMEM>(team, nDim, nodesPerEntity, dataNeededByKernels, false));
 #else
         prereqData[0] = &simdPrereqData;
 #endif
@@ -59,7 +60,7 @@ struct SharedMemData {
 #ifdef KOKKOS_ENABLE_CUDA
     ScratchViews<DoubleType,TEAMHANDLETYPE,SHMEM>* prereqData[1];
 #else
-    std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM>> prereqData[simdLen];
+    std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM>> prereqData[1];
 #endif
     ScratchViews<DoubleType,TEAMHANDLETYPE,SHMEM> simdPrereqData;
     SharedMemView<DoubleType*,SHMEM> simdrhs;
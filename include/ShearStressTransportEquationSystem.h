@@ -14,6 +14,8 @@
 #include <FieldTypeDef.h>
 #include <NaluParsedTypes.h>
 
+#include <memory>
+
 namespace stk {
 struct topology;
 namespace mesh {
@@ -29,6 +31,8 @@ class AlgorithmDriver;
 class TurbKineticEnergyEquationSystem;
 class SpecificDissipationRateEquationSystem;
 class GammaEquationSystem;
+class FusedNodalGradDriver;
+class Algorithm;
 
 class ShearStressTransportEquationSystem : public EquationSystem
 {
@@ -58,9 +62,13 @@ public:
   void pre_iter_work() final;
 
   void clip_min_distance_to_wall();
+  //! F1 blending and the k, omega and gamma effective viscosities
   void compute_f_one_blending();
   void update_and_clip();
   void update_and_clip_gamma();
+
+  //! Nodal gradients of tke, sdr and gamma; fused when requested
+  void compute_nodal_gradients();
   void clip_sst(
     const stk::mesh::NgpMesh& ngpMesh,
     const stk::mesh::Selector& sel,
@@ -80,11 +88,18 @@ public:
   ScalarFieldType* gamma_;
   ScalarFieldType* minDistanceToWall_;
   ScalarFieldType* fOneBlending_;
-  ScalarFieldType* maxLengthScale_;
+  stk::mesh::FieldBase* maxLengthScale_;
+  GenericFieldType* strainVorticity_;
 
   bool isInit_;
   AlgorithmDriver* sstMaxLengthScaleAlgDriver_;
 
+  //! Shared sweep for the tke, sdr and gamma nodal gradients
+  std::unique_ptr<FusedNodalGradDriver> fusedNodalGradDriver_;
+
+  //! Node pass computing F1 and the effective viscosities
+  std::unique_ptr<Algorithm> closureAlg_;
+
   // saved of mesh parts that are for wall bcs
   std::vector<stk::mesh::Part*> wallBcPart_;
 
@@ -10,11 +10,13 @@
 #ifndef SIDEWRITER_H
 #define SIDEWRITER_H
 
-#include <set>
+#include <map>
 #include <vector>
 #include <string>
 #include <memory>
 
+#include <mpi.h>
+
 namespace Ioss {
 class Region;
 } // namespace Ioss
@@ -34,6 +36,26 @@ class Part;
 namespace sierra {
 namespace nalu {
 
+struct SideWriterOptions
+{
+  //! Ranks whose faces are gathered to and written by one rank; 1 writes
+  //! from every rank
+  int ranksPerWriter{1};
+
+  //! Store coordinates and fields as 32-bit reals in the database
+  bool singlePrecision{false};
+
+  //! Components to output for a field, by field name; all when absent
+  std::map<std::string, std::vector<int>> components;
+};
+
+/** Output of node fields on a set of sides to an Exodus-II database
+ *
+ *  With SideWriterOptions::ranksPerWriter greater than one, the ranks are
+ *  split into consecutive groups and the first rank of every group gathers
+ *  the locally owned faces of the group, removes duplicate nodes and writes
+ *  them, so that only one file per group is opened and written.
+ */
 class SideWriter
 {
 public:
@@ -41,15 +63,47 @@ public:
     const stk::mesh::BulkData& bulk,
     std::vector<const stk::mesh::Part*> sides,
     std::vector<const stk::mesh::FieldBase*> fields,
-    std::string fname);
+    std::string fname,
+    SideWriterOptions options = SideWriterOptions());
+
+  ~SideWriter();
+
+  SideWriter(const SideWriter&) = delete;
+  SideWriter& operator=(const SideWriter&) = delete;
 
   void write_database_data(double time);
 
+  //! True if this rank writes to a database
+  bool is_writer() const { return output_ != nullptr; }
+
 private:
   void add_fields(std::vector<const stk::mesh::FieldBase*> fields);
+
+  void construct_aggregated(
+    const std::vector<const stk::mesh::Part*>& sides, const std::string& fname);
+  void write_aggregated_data();
+
+  const std::vector<int>& components(const stk::mesh::FieldBase& field) const;
+
   const stk::mesh::BulkData& bulk_;
+  const SideWriterOptions options_;
   std::unique_ptr<Ioss::Region> output_;
-  std::set<const stk::mesh::FieldBase*> fields_;
+
+  //! Fields in the order given, which is the same on all ranks
+  std::vector<const stk::mesh::FieldBase*> fields_;
+  std::map<const stk::mesh::FieldBase*, std::vector<int>> components_;
+
+  //! Aggregated output: ranks of a group and the writers of all groups
+  MPI_Comm groupComm_{MPI_COMM_NULL};
+  MPI_Comm writerComm_{MPI_COMM_NULL};
+
+  //! Aggregated output: sides nodes on this rank
+  std::vector<int64_t> localNodeIds_;
+
+  //! Aggregated output, writer only: position in the written node block of
+  //! every node gathered from the group
+  std::vector<int> gatheredToWritten_;
+  size_t numWrittenNodes_{0};
 };
 
 class SideWriterContainer
@@ -63,9 +117,10 @@ public:
   inline int number_of_writers() { return outputFileNames_.size(); };
 
 private:
-  std::vector<SideWriter> sideWriters_;
+  std::vector<std::unique_ptr<SideWriter>> sideWriters_;
   std::vector<std::string> outputFileNames_;
   std::vector<int> outputFrequency_;
+  std::vector<SideWriterOptions> options_;
   std::vector<std::vector<std::string>> sideNames_;
   std::vector<std::vector<std::string>> fieldNames_;
 };
@@ -37,6 +37,15 @@ using ScalarAlignedVector = AlignedVector<DoubleType>;
 
 static constexpr int simdLen = stk::simd::ndoubles;
 
+#ifdef NALU_SIMD_WIDTH
+static_assert(
+  simdLen == NALU_SIMD_WIDTH,
+  "stk::simd width does not match NALU_SIMD_WIDTH, check the compiler flags");
+#endif
+
+//! Alignment of one SIMD batch; scratch views are padded to this boundary
+static constexpr size_t simdAlignment = alignof(SimdDouble);
+
 KOKKOS_INLINE_FUNCTION
 size_t get_num_simd_groups(size_t length)
 {
@@ -17,6 +17,8 @@
 
 #include <KokkosInterface.h>
 
+#include <string>
+
 namespace YAML {
 class Node;
 }
@@ -42,6 +44,10 @@ public:
   void init_epilog();
   void run();
   void high_level_banner();
+  //! Reduce the TimerTree across ranks and write it to timerTreeFile_; collective
+  void write_timer_tree();
+  //! Write the tuned team sizes to teamSizeCacheFile_; collective
+  void write_team_size_cache();
   Simulation *root() { return this; }
   Simulation *parent() { return 0; }
   bool debug() { return debug_; }
@@ -59,6 +65,9 @@ public:
 
   static bool debug_;
   int serializedIOGroupSize_;
+  std::string timerTreeFile_;
+  std::string teamSizeCacheFile_{"nalu_team_size_cache.dat"};
+  bool teamSizeAutotune_{false};
 private:
 #ifdef KOKKOS_ENABLE_CUDA
   size_t    default_stack_size;
@@ -25,6 +25,7 @@ namespace stk {
     class FieldBase;
     class MetaData;
     class Part;
+    class Selector;
     typedef std::vector<Part*> PartVector;
   }
 }
@@ -32,7 +33,7 @@ namespace stk {
 namespace sierra{
 namespace nalu{
 
-class AuxFunctionAlgorithm;
+class Algorithm;
 class Realm;
 
 class SolutionNormPostProcessing
@@ -60,6 +61,16 @@ public:
   // populate nodal field and output norms (if appropriate)
   void execute();
 
+  // accumulate count, L1, L2 and Loo of components [begin, begin+n) on device
+  void compute_local_norms(
+    const stk::mesh::Selector& sel,
+    const int begin,
+    const int n,
+    double* count,
+    double* l1,
+    double* l2,
+    double* loo);
+
   // hold the realm
   Realm &realm_;
 
@@ -90,8 +101,9 @@ public:
   // vector of parts for post processing
   stk::mesh::PartVector partVec_;
 
-  // vector of algorithms that process the analytical field
-  std::vector<AuxFunctionAlgorithm *> populateExactNodalFieldAlg_;
+  // vector of algorithms that process the analytical field; on device when
+  // the user function provides a device functor
+  std::vector<Algorithm *> populateExactNodalFieldAlg_;
 };
 
 } // namespace nalu
@@ -92,13 +92,16 @@ public:
   bool get_skew_symmetric(const std::string&) const;
 
   std::vector<double> get_gravity_vector(const unsigned nDim) const;
+
+  //! True if the field is listed in reduced_precision_fields
+  bool reduced_precision(const std::string& fieldName) const;
  
   double get_turb_model_constant(
     TurbulenceModelConstant turbModelEnum) const;
   
   bool get_noc_usage(const std::string &dofName) const;
 
-  bool has_set_boussinesq_time_scale();
+  bool has_set_boussinesq_time_scale() const;
 
   double hybridDefault_;
   double alphaDefault_;
@@ -115,6 +118,7 @@ public:
   std::string tanhFormDefault_;
   double tanhTransDefault_;
   double tanhWidthDefault_;
+  int tanhTableSizeDefault_;
   double referenceDensity_;
   double referenceTemperature_;
   double thermalExpansionCoeff_;
@@ -154,6 +158,43 @@ public:
   bool transition_model_;
   bool gammaEqActive_;
 
+  //! Assemble the SST k and omega edge terms in a single fused edge sweep
+  bool sstFusedEdgeAssembly_{false};
+
+  //! Compute the SST scalar nodal gradients in shared edge sweeps
+  bool sstFusedNodalGradient_{false};
+
+  //! Reduce the CFL/Reynolds maxima in the last momentum Peclet sweep
+  bool fusedCourantReynolds_{false};
+
+  //! Assemble the SST k, omega (and gamma) systems before solving any of them
+  bool sstGroupedAssembly_{false};
+
+  //! Replace the common nodal source kernel combinations by fused packs
+  bool fusedNodeKernelPacks_{true};
+
+  //! Read the momentum edge node vectors from structure-of-arrays mirrors
+  bool soaVectorFields_{false};
+
+  //! Precompute the edge length vector, asq and 1/axdx in the geometry pass
+  bool edgeMetricsCache_{false};
+
+  //! Store the pre-solve mdot from the continuity edge assembly
+  bool fusedMdotContinuity_{false};
+
+  //! Pseudo-transient local time stepping of steady-state solves
+  bool localTimeStepping_{false};
+  double localTimeStepCfl_{1.0};
+  double localTimeStepMaxCfl_{100.0};
+  double localTimeStepRampExponent_{1.0};
+
+  //! Vorticity based error indicator of a solution-adaptive refinement
+  bool refinementIndicator_{false};
+  double refinementThreshold_{0.1};
+
+  //! Nodal fields stored in single precision
+  std::vector<std::string> reducedPrecisionFields_;
+
   // global mdot correction alg
   bool activateOpenMdotCorrection_;
   double mdotAlgOpenCorrection_;
@@ -172,6 +213,7 @@ public:
   std::map<std::string, std::string> tanhFormMap_;
   std::map<std::string, double> tanhTransMap_;
   std::map<std::string, double> tanhWidthMap_;
+  std::map<std::string, int> tanhTableSizeMap_;
   std::map<std::string, bool> consistentMassMatrixPngMap_;
   std::map<std::string, bool> skewSymmetricMap_;
 
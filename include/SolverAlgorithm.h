@@ -30,7 +30,7 @@ class Realm;
 
 struct NGPApplyCoeff
 {
-  NGPApplyCoeff(EquationSystem*);
+  NGPApplyCoeff(EquationSystem*, bool conflictFree = false);
 
   KOKKOS_DEFAULTED_FUNCTION
   NGPApplyCoeff() = default;
@@ -48,6 +48,19 @@ struct NGPApplyCoeff
     SharedMemView<double**,DeviceShmem> & lhs,
     const char *trace_tag) const;
 
+  //! Same as operator() for the two nodes of an edge, using the scatter map
+  //! of the linear system when there is one
+  KOKKOS_FUNCTION
+  void apply_edge(
+    const stk::mesh::Entity edge,
+    unsigned numMeshobjs,
+    const stk::mesh::NgpMesh::ConnectedNodes& symMeshobjs,
+    const SharedMemView<int*,DeviceShmem> & scratchIds,
+    const SharedMemView<int*,DeviceShmem> & sortPermutation,
+    SharedMemView<double*,DeviceShmem> & rhs,
+    SharedMemView<double**,DeviceShmem> & lhs,
+    const char *trace_tag) const;
+
   KOKKOS_FUNCTION
   void extract_diagonal(
     const unsigned nEntities,
@@ -88,8 +101,8 @@ public:
 
 protected:
 
-  NGPApplyCoeff coeff_applier()
-  { return NGPApplyCoeff(eqSystem_); }
+  NGPApplyCoeff coeff_applier(bool conflictFree = false)
+  { return NGPApplyCoeff(eqSystem_, conflictFree); }
 
   // Need to find out whether this ever gets called inside a modification cycle.
   void apply_coeff(
@@ -14,6 +14,7 @@
 
 #include<Algorithm.h>
 #include<FieldTypeDef.h>
+#include<SurfaceForceAndMomentAlgorithmDriver.h>
 
 // stk
 #include <stk_mesh/base/Part.hpp>
@@ -40,8 +41,14 @@ public:
 
   void pre_work();
 
-  void cross_product(
-    double *force, double *cross, double *rad);
+  //! one face/element topology pair on device; accumulates into forceMoment
+  template <typename BcAlgTraits>
+  void execute_part(
+    const stk::mesh::Part& part, SurfaceForceMomentType& forceMoment);
+
+  //! assembled area of the faces of one topology on device
+  template <typename FaceTraits>
+  void pre_work_part(const stk::mesh::Part& part);
 
   const std::string &outputFileName_;
   const int &frequency_;
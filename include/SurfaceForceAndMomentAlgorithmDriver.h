@@ -13,14 +13,25 @@
 #define SurfaceForceAndMomentAlgorithmDriver_h
 
 #include <AlgorithmDriver.h>
+#include <ngp_utils/NgpReducers.h>
 #include <string>
 #include <vector>
 
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
 namespace sierra{
 namespace nalu{
 
 class Realm;
 
+//! pressure force, viscous force and moment summed along with the y+ range
+using SurfaceForceMomentType = nalu_ngp::ArraySumMinMaxScalar<double, 9>;
+using SurfaceForceMomentReducer = nalu_ngp::ArraySumMinMax<double, 9>;
+
 class SurfaceForceAndMomentAlgorithmDriver : public AlgorithmDriver
 {
 public:
@@ -36,7 +47,14 @@ public:
   void zero_fields();
   void parallel_assemble_area();
   void parallel_assemble_fields();
-  
+
+  //! nodal fields assembled by the algorithms on device
+  std::vector<stk::mesh::FieldBase*> force_fields() const;
+  std::vector<stk::mesh::FieldBase*> area_fields() const;
+
+  //! parallel and periodic sum of device-modified nodal fields
+  void parallel_assemble(const std::vector<stk::mesh::FieldBase*>& fields);
+
 };
   
 
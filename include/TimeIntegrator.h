@@ -13,6 +13,7 @@
 #define TimeIntegrator_h
 
 #include <Enums.h>
+#include "utils/StepTelemetry.h"
 #include <vector>
 #include <string>
 #include <memory>
@@ -51,6 +52,33 @@ public:
   void pre_realm_advance_stage2();
   void post_realm_advance();
 
+  /** Advance the sub-cycled realms through the sub-steps of the current step
+   *
+   *  The realms that are not sub-cycled have completed the step; their
+   *  overset donor data is interpolated in time between states N and N+1.
+   */
+  void advance_sub_cycled_realms(const bool updateOverset);
+
+  //! The realm takes numSubSteps_ sub-steps per time step
+  bool is_sub_cycled(const Realm* realm) const;
+
+  /** Switch the time step, time and BDF2 weights to sub-step `subStep` of
+   *  the current step until end_sub_step()
+   *
+   *  Every query of the integrator, e.g., by the kernels of the sub-cycled
+   *  realm, sees the sub-step values in between.
+   */
+  void begin_sub_step(const int subStep);
+  void end_sub_step();
+
+  //! Cumulative timers and counters of every equation system
+  std::vector<StepTelemetry::Equation> telemetry_counters() const;
+  void write_step_telemetry(
+    const std::vector<StepTelemetry::Equation>& startCounters,
+    double preTime,
+    double nonlinearTime,
+    double postTime);
+
   Simulation* sim_{nullptr};
 
   double totalSimTime_;
@@ -64,6 +92,10 @@ public:
   int timeStepCount_;
   int maxTimeStepCount_;
   bool secondOrderTimeAccurate_;
+  // largest dtN/dtNm1 for which the variable-step BDF2 is used; no limit
+  // unless max_bdf2_step_ratio is given
+  double maxBDF2StepRatio_;
+  bool extrapolatePredictor_;
   bool adaptiveTimeStep_;
   bool terminateBasedOnTime_;
   int nonlinearIterations_;
@@ -74,12 +106,19 @@ public:
 
   std::vector<Realm*> realmVec_;
 
+  //! Realms that take numSubSteps_ sub-steps of each time step
+  std::vector<std::string> subCycledRealmNames_;
+  std::vector<Realm*> subCycledRealms_;
+  std::vector<Realm*> heldRealms_;
+  int numSubSteps_{1};
+
   double get_time_step(
   const NaluState &theState = NALU_STATE_N) const;
   double get_current_time() const;
   double get_gamma1() const;
   double get_gamma2() const;
   double get_gamma3() const;
+  double get_predictor_extrapolation() const;
   int get_time_step_count() const;
   double get_time_step_from_file();
   bool get_is_fixed_time_step();
@@ -89,6 +128,24 @@ public:
   void compute_gamma();
 
   std::unique_ptr<ExtOverset> overset_;
+
+  //! Optional JSON-lines stream of per time step performance data
+  std::string telemetryFile_;
+  std::unique_ptr<StepTelemetry> telemetry_;
+
+private:
+  //! Time state of the full step, saved while a sub-step is active
+  struct TimeState
+  {
+    double currentTime;
+    double timeStepN;
+    double timeStepNm1;
+    double gamma1;
+    double gamma2;
+    double gamma3;
+  };
+  TimeState savedState_;
+  bool inSubStep_{false};
 };
 
 } // namespace nalu
@@ -29,6 +29,8 @@
 #include <stk_mesh/base/Ngp.hpp>
 #include <stk_mesh/base/NgpMesh.hpp>
 
+#include <functional>
+#include <memory>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -49,6 +51,31 @@ typedef std::unordered_map<stk::mesh::EntityId, size_t>  MyLIDMapType;
 
 typedef std::pair<stk::mesh::Entity, stk::mesh::Entity> Connection;
 
+/** Graph data of a Tpetra linear system that only depends on its stencil
+ *
+ *  Shared through Realm::tpetraGraphRegistry_ by the linear systems with
+ *  identical connections, and through Realm::tpetraStencilRegistry_ by those
+ *  with identical graph builds; each system keeps its own matrices and
+ *  vectors.
+ */
+struct TpetraGraphData
+{
+  Teuchos::RCP<LinSys::Map> totalColsMap_;
+  Teuchos::RCP<LinSys::Map> ownedRowsMap_;
+  Teuchos::RCP<LinSys::Map> sharedNotOwnedRowsMap_;
+  Teuchos::RCP<LinSys::Map> ownedAndSharedRowsMap_;
+  Teuchos::RCP<LinSys::Graph> ownedGraph_;
+  Teuchos::RCP<LinSys::Graph> sharedNotOwnedGraph_;
+  Teuchos::RCP<LinSys::Export> exporter_;
+  LinSys::EntityToLIDView entityToLID_;
+  LinSys::EntityToLIDView entityToColLID_;
+  LinSys::EntityToLIDView edgeToScatterRow_;
+  LinSys::ScatterMapView edgeScatterMap_;
+  bool hasEdgeScatterMap_{false};
+  LinSys::LocalOrdinal maxOwnedRowId_{0};
+  LinSys::LocalOrdinal maxSharedNotOwnedRowId_{0};
+};
+
 
 class TpetraLinearSystem : public LinearSystem
 {
@@ -77,6 +104,7 @@ public:
   void finalizeLinearSystem();
 
   sierra::nalu::CoeffApplier* get_coeff_applier();
+  sierra::nalu::CoeffApplier* get_conflict_free_coeff_applier();
 
   // Matrix Assembly
   void zeroSystem();
@@ -129,17 +157,26 @@ public:
 
   // Solve
   int solve(stk::mesh::FieldBase * linearSolutionField);
+  void setInitialGuess(stk::mesh::FieldBase * guessField);
+  bool supports_fused_update() const { return true; }
   void loadComplete();
   void writeToFile(const char * filename, bool useOwned=true);
   void printInfo(bool useOwned=true);
   void writeSolutionToFile(const char * filename, bool useOwned=true);
+  size_t memory_bytes() const
+  {
+    return local_matrix_bytes(ownedLocalMatrix_)
+      + local_matrix_bytes(sharedNotOwnedLocalMatrix_);
+  }
   size_t lookup_myLID(MyLIDMapType& myLIDs, stk::mesh::EntityId entityId, const char* /* msg */ =nullptr, stk::mesh::Entity /* entity */ = stk::mesh::Entity())
   {
     return myLIDs[entityId];
   }
 
-  void copy_tpetra_to_stk(const Teuchos::RCP<LinSys::MultiVector> tpetraVector,
-                          stk::mesh::FieldBase * stkField);
+  //! Copy (or apply, in a fused update) the owned solution; returns the
+  //! local squared norm of the update
+  double copy_tpetra_to_stk(const Teuchos::RCP<LinSys::MultiVector> tpetraVector,
+                            stk::mesh::FieldBase * stkField);
 
   // This method copies a stk::mesh::field to a tpetra multivector. Each dof/node is written
   // into a different vector in the multivector.
@@ -176,7 +213,10 @@ public:
                              LinSys::LocalVector sharedNotOwnedLclRhs,
                              LinSys::EntityToLIDView entityLIDs,
                              LinSys::EntityToLIDView entityColLIDs,
-                             int maxOwnedRowId, int maxSharedNotOwnedRowId, unsigned numDof)
+                             int maxOwnedRowId, int maxSharedNotOwnedRowId, unsigned numDof,
+                             bool useAtomics = true,
+                             LinSys::EntityToLIDView edgeToScatterRow = LinSys::EntityToLIDView(),
+                             LinSys::ScatterMapView edgeScatterMap = LinSys::ScatterMapView())
     : ownedLocalMatrix_(ownedLclMatrix),
       sharedNotOwnedLocalMatrix_(sharedNotOwnedLclMatrix),
       ownedLocalRhs_(ownedLclRhs),
@@ -184,6 +224,9 @@ public:
       entityToLID_(entityLIDs),
       entityToColLID_(entityColLIDs),
       maxOwnedRowId_(maxOwnedRowId), maxSharedNotOwnedRowId_(maxSharedNotOwnedRowId), numDof_(numDof),
+      useAtomics_(useAtomics),
+      edgeToScatterRow_(edgeToScatterRow),
+      edgeScatterMap_(edgeScatterMap),
       devicePointer_(nullptr)
     {}
 
@@ -207,6 +250,12 @@ public:
                             const SharedMemView<const double**,DeviceShmem> & lhs,
                             const char * trace_tag);
 
+    KOKKOS_FUNCTION
+    virtual bool scatter_edge(const stk::mesh::Entity edge,
+                              const stk::mesh::NgpMesh::ConnectedNodes& entities,
+                              const SharedMemView<const double*,DeviceShmem> & rhs,
+                              const SharedMemView<const double**,DeviceShmem> & lhs);
+
     void free_device_pointer();
 
     sierra::nalu::CoeffApplier* device_pointer();
@@ -218,6 +267,10 @@ public:
     LinSys::EntityToLIDView entityToColLID_;
     int maxOwnedRowId_, maxSharedNotOwnedRowId_;
     unsigned numDof_;
+    //! false when the caller guarantees no two concurrent calls share a row
+    bool useAtomics_;
+    LinSys::EntityToLIDView edgeToScatterRow_;
+    LinSys::ScatterMapView edgeScatterMap_;
     TpetraLinSysCoeffApplier* devicePointer_;
   };
 
@@ -247,12 +300,68 @@ public:
   void fill_entity_to_row_LID_mapping();
   void fill_entity_to_col_LID_mapping();
 
+public:
+  /** Precompute the CSR value offsets of every locally owned edge
+   *
+   *  For the 2 numDof rows and columns of an edge the offset into the values
+   *  of the owned or shared-not-owned local matrix is stored once, so that
+   *  edge assembly becomes indexed adds without column searches. Called by
+   *  finalizeLinearSystem with `scatter_map_assembly`.
+   */
+  void buildEdgeScatterMap();
+
+private:
+
+  //! Build the maps and graphs from the connections, see finalizeLinearSystem
+  void construct_graph();
+
+  /** Hash of the rows and connections of the graph under construction
+   *
+   *  Covers the number of dofs, the owned and shared-not-owned rows and the
+   *  sorted connections, as well as the mesh modification count since the
+   *  row and column ids are indexed by entity offsets.
+   */
+  std::size_t compute_graph_signature() const;
+
+  //! Use the maps, graphs and id views of a registered graph
+  void adopt_graph(const TpetraGraphData& graph);
+
+  //! Kinds of graph builds, hashed into the stencil signature
+  enum class GraphBuild {
+    NODE,
+    EDGE,
+    FACE,
+    ELEM,
+    REDUCED_ELEM,
+    FACE_ELEM,
+    NON_CONFORMAL,
+    OVERSET,
+    SPARSIFIED_EDGE_ELEM
+  };
+
+  /** Record a graph build for finalizeLinearSystem
+   *
+   *  Returns true when the build was recorded and the caller should return;
+   *  false while finalizeLinearSystem replays the recorded builds. The kind
+   *  and parts of the build are hashed into stencilSignature_; builds whose
+   *  connections depend on more than the parts make the stencil
+   *  non-cacheable.
+   */
+  bool defer_graph_build(
+    GraphBuild kind,
+    const stk::mesh::PartVector& parts,
+    std::function<void()> build,
+    bool cacheable = true);
+
   int insert_connection(stk::mesh::Entity a, stk::mesh::Entity b);
   void addConnections(const stk::mesh::Entity* entities,const size_t&);
   void expand_unordered_map(unsigned newCapacityNeeded);
   void checkForNaN(bool useOwned);
   bool checkForZeroRow(bool useOwned, bool doThrow, bool doPrint=false);
 
+  //! Write the owned matrix, rhs and the coordinates used by MueLu
+  void capture_system();
+
   std::vector<stk::mesh::Entity> ownedAndSharedNodes_;
   std::vector<std::vector<stk::mesh::Entity> > connections_;
   std::vector<GlobalOrdinal> totalGids_;
@@ -290,14 +399,36 @@ public:
   Teuchos::RCP<LinSys::MultiVector> sln_;
   Teuchos::RCP<LinSys::MultiVector> globalSln_;
   Teuchos::RCP<LinSys::Export>      exporter_;
+  //! Parameters of the matrix fills of loadComplete
+  Teuchos::RCP<Teuchos::ParameterList> fillParams_;
 
   MyLIDMapType myLIDs_;
   LinSys::EntityToLIDView entityToColLID_;
   LinSys::EntityToLIDView entityToLID_;
+  //! Row of edgeScatterMap_ of every edge, -1 if none
+  LinSys::EntityToLIDView edgeToScatterRow_;
+  LinSys::ScatterMapView edgeScatterMap_;
   LocalOrdinal maxOwnedRowId_; // = num_owned_nodes * numDof_
   LocalOrdinal maxSharedNotOwnedRowId_; // = (num_owned_nodes + num_sharedNotOwned_nodes) * numDof_
 
   std::vector<int> sortPermutation_;
+
+  //! Graph shared with the linear systems of identical stencils
+  std::shared_ptr<TpetraGraphData> graphData_;
+
+  /** Graph builds recorded until finalizeLinearSystem
+   *
+   *  The connectivity traversals only run when no other linear system of the
+   *  realm has finalized the same builds on the current mesh; otherwise its
+   *  rows, maps and graphs are adopted without traversal or communication.
+   */
+  std::vector<std::function<void()>> pendingGraphBuilds_;
+  std::size_t stencilSignature_{0};
+  bool stencilCacheable_{true};
+  bool replayingGraphBuilds_{false};
+
+  std::unique_ptr<TpetraLinSysCoeffApplier> hostConflictFreeCoeffApplier_;
+  sierra::nalu::CoeffApplier* deviceConflictFreeCoeffApplier_{nullptr};
 };
 
 template<typename T1, typename T2>
@@ -130,6 +130,11 @@ public:
   void writeToFile(const char * filename, bool useOwned=true);
   void printInfo(bool useOwned=true);
   void writeSolutionToFile(const char * filename, bool useOwned=true);
+  size_t memory_bytes() const
+  {
+    return local_matrix_bytes(ownedLocalMatrix_)
+      + local_matrix_bytes(sharedNotOwnedLocalMatrix_);
+  }
   size_t lookup_myLID(MyLIDMapType& myLIDs, stk::mesh::EntityId entityId, const char* /* msg */ =nullptr, stk::mesh::Entity /* entity */ = stk::mesh::Entity())
   {
     return myLIDs[entityId];
@@ -274,6 +279,8 @@ private:
   Teuchos::RCP<LinSys::MultiVector> sln_;
   Teuchos::RCP<LinSys::MultiVector> globalSln_;
   Teuchos::RCP<LinSys::Export>      exporter_;
+  //! Parameters of the matrix fills of loadComplete
+  Teuchos::RCP<Teuchos::ParameterList> fillParams_;
 
   MyLIDMapType myLIDs_;
   LinSys::EntityToLIDView entityToColLID_;
@@ -30,6 +30,7 @@ class Realm;
 class LinearSystem;
 class EquationSystems;
 class ProjectedNodalGradientEquationSystem;
+class SpecificDissipationRateEquationSystem;
 
 class TurbKineticEnergyEquationSystem : public EquationSystem {
 
@@ -108,6 +109,10 @@ public:
 
   ProjectedNodalGradientEquationSystem *projectedNodalGradEqs_;
 
+  //! SDR equation system assembled together with TKE by the fused SST edge
+  //! algorithm; set by ShearStressTransportEquationSystem when requested
+  SpecificDissipationRateEquationSystem* fusedSdrEqSys_{nullptr};
+
   bool isInit_;
 
 };
@@ -79,6 +79,29 @@ public:
     stk::mesh::MetaData &metaData,
     stk::mesh::Part *part);
 
+  // float storage for single precision moving averages
+  void register_float_field_from_primitive(
+    const std::string primitiveName,
+    const std::string averagedName,
+    stk::mesh::MetaData &metaData,
+    stk::mesh::Part *part);
+
+  // float or double average of a primitive, following the specification
+  void register_average_field(
+    const AveragingInfo *avInfo,
+    const std::string primitiveName,
+    const std::string averagedName,
+    stk::mesh::MetaData &metaData,
+    stk::mesh::Part *part);
+
+  // name of the moving average of a primitive over one of the time scales
+  std::string moving_average_name(
+    const AveragingInfo *avInfo,
+    const std::string &primitiveName,
+    const size_t timeScaleIndex) const;
+
+  void create_moving_average_post_processor();
+
   void construct_pair(
     const std::string primitiveName,
     const std::string averagedName,
@@ -90,7 +113,8 @@ public:
     const std::string fieldName,
     const int fieldSize,
     stk::mesh::MetaData &metaData,
-    stk::mesh::Part *targetPart);
+    stk::mesh::Part *targetPart,
+    const bool singlePrecision = false);
 
   void review( 
     const AveragingInfo *avInfo);
@@ -98,6 +122,12 @@ public:
   // populate nodal field and output norms (if appropriate)
   void execute();
 
+  /** Write the averages of the time window that closed at `time` to the
+   *  window output database; only every `windowOutputFreq_`-th window is
+   *  written
+   */
+  void write_window_output(const double time);
+
   void compute_averages(
     AveragingInfo* avInfo,
     stk::mesh::Selector sel,
@@ -105,6 +135,17 @@ public:
     const double& zeroCurrent,
     const double& dt);
 
+  /** Single device pass over the nodes computing the averages together with
+   *  the tke, Reynolds/Favre/resolved stresses, vorticity, Q-criterion and
+   *  lambda-ci requested by `avInfo`
+   */
+  void compute_fused_statistics(
+    AveragingInfo* avInfo,
+    stk::mesh::Selector sel,
+    const double& oldTimeFilter,
+    const double& zeroCurrent,
+    const double& dt);
+
   // compute tke and stress for each type of operation
   void compute_tke(
     const bool isReynolds,
@@ -177,6 +218,18 @@ public:
 
   bool forcedReset_; /* allows forhard reset */
 
+  bool fusedStatistics_{true}; /* one node loop for all statistics */
+
+  // separate output of the averages at the end of each averaging window
+  bool windowOutput_{false};
+  std::string windowOutputName_{"averages.e"};
+  int windowOutputFreq_{1};
+  bool windowOutputSinglePrecision_{false};
+  std::vector<std::string> windowOutputFields_;
+  int windowCount_{0};
+  bool windowOutputCreated_{false};
+  size_t windowFileIndex_{0};
+
   AveragingType averagingType_{NALU_CLASSIC};
   std::unique_ptr<MovingAveragePostProcessor> movingAvgPP_;
 
@@ -15,6 +15,8 @@
 #include "FieldTypeDef.h"
 #include "ngp_algorithms/NodalGradAlgDriver.h"
 
+#include "stk_mesh/base/NgpField.hpp"
+
 #include <memory>
 
 namespace sierra {
@@ -77,7 +79,14 @@ public:
 
   void compute_wall_distance();
 
+  //! Exact distance to the nearest wall face, without the Poisson solve
+  void compute_nearest_wall_face_distance();
+
 private:
+  //! Parallel update of the wall distance at shared, ghosted and
+  //! periodic/non-conformal/overset nodes after it was computed on device
+  void communicate_wall_distance(stk::mesh::NgpField<double>& wdist);
+
   WallDistEquationSystem() = delete;
   WallDistEquationSystem(const WallDistEquationSystem&) = delete;
 
@@ -102,6 +111,14 @@ private:
 
   //! User option to force recomputation of wall distance on restart
   bool forceInitOnRestart_{false};
+
+  //! Compute the distance by a nearest wall face query instead of the
+  //! Poisson solve (``wall_distance_method: nearest_wall_face``)
+  bool useNearestWallFace_{false};
+
+  //! Wall parts with a Dirichlet condition on the Poisson problem; the
+  //! faces used by the nearest wall face method
+  stk::mesh::PartVector wallFaceParts_;
 };
 
 }  // nalu
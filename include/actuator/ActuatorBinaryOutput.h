@@ -0,0 +1,96 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ACTUATORBINARYOUTPUT_H_
+#define ACTUATORBINARYOUTPUT_H_
+
+#include <actuator/ActuatorBulk.h>
+
+#include <mpi.h>
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/*! \brief Integrated force and moment about the origin of a range of points
+ *
+ * The moment about any other point p follows as M_0 - p x F.
+ */
+template <typename PointView, typename ForceView>
+std::array<double, 6>
+actuator_turbine_loads(
+  const PointView& points, const ForceView& forces, int offset, int numPoints)
+{
+  std::array<double, 6> loads{{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}};
+  for (int i = offset; i < offset + numPoints; ++i) {
+    for (int j = 0; j < 3; ++j)
+      loads[j] += forces(i, j);
+    loads[3] += points(i, 1) * forces(i, 2) - points(i, 2) * forces(i, 1);
+    loads[4] += points(i, 2) * forces(i, 0) - points(i, 0) * forces(i, 2);
+    loads[5] += points(i, 0) * forces(i, 1) - points(i, 1) * forces(i, 0);
+  }
+  return loads;
+}
+
+/*! \brief Binary timeseries of the turbine loads
+ *
+ * Every call to sample() appends the integrated force and moment of the
+ * turbine of this rank and, optionally, the position, velocity and force of
+ * each of its points to a host buffer. The turbines are split into groups of
+ * consecutive ids; every flushFrequency samples the buffers of a group are
+ * gathered onto the rank of its first turbine, which appends them to the
+ * file of the group in one write.
+ *
+ * File `<name>_<group>.bin`, native endianness:
+ *   header: char[8] "NALUACT1", int32 number of turbines, then per turbine
+ *           int32 turbine id, int32 points written per record
+ *   chunks: int32 number of samples n, then for each turbine of the group
+ *           n records of int64 time step, double time, double force[3],
+ *           double moment[3] and per point double position[3],
+ *           velocity[3], force[3]
+ */
+class ActuatorBinaryOutput
+{
+public:
+  //! Collective over all ranks
+  ActuatorBinaryOutput(const ActuatorMeta& actMeta, const ActuatorBulk& actBulk);
+  //! Writes the buffered samples; collective over the turbine ranks
+  ~ActuatorBinaryOutput();
+
+  ActuatorBinaryOutput(const ActuatorBinaryOutput&) = delete;
+  ActuatorBinaryOutput& operator=(const ActuatorBinaryOutput&) = delete;
+
+  //! Buffer the current loads; collective over the turbine ranks
+  void sample(ActuatorBulk& actBulk, int timeStepCount, double time);
+
+  //! Write the buffered samples of every group; collective as sample()
+  void flush();
+
+  static std::string file_name(const std::string& baseName, int group);
+
+private:
+  const int turbineId_;
+  const int numPoints_;
+  const bool writePoints_;
+  const int flushFrequency_;
+  int numBuffered_{0};
+  MPI_Comm groupComm_{MPI_COMM_NULL};
+  std::ofstream file_;
+  std::vector<char> buffer_;
+  std::vector<char> gathered_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ACTUATORBINARYOUTPUT_H_ */
@@ -10,6 +10,7 @@
 #ifndef ACTUATORBLADEDISTRIBUTOR_H_
 #define ACTUATORBLADEDISTRIBUTOR_H_
 
+#include <cstddef>
 #include <vector>
 #include <utility>
 
@@ -52,6 +53,19 @@ std::vector<BladeDistributionInfo> compute_blade_distributions(const ActuatorMet
  */
 bool blade_belongs_on_this_rank(
   int totalNumBlades, int globBladeNum, int numRanks, int ranks);
+
+/**
+ * @brief assign every turbine to one of the least loaded ranks
+ *
+ * Ranks are taken in order of increasing load, ties broken by rank, so that
+ * spare ranks without mesh are used first and no rank gets two turbines.
+ *
+ * @param rankLoad the CFD load of every rank, e.g. its owned node count
+ * @param numTurbines the total number of turbines in the simulation
+ * @return std::vector<int> - the rank of every turbine
+ */
+std::vector<int> balanced_turbine_ranks(
+  const std::vector<size_t>& rankLoad, int numTurbines);
 }
 }
 
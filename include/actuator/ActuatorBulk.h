@@ -13,6 +13,12 @@
 #include <actuator/ActuatorTypes.h>
 #include <actuator/ActuatorSearch.h>
 #include <Enums.h>
+
+#include <mpi.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 namespace stk {
@@ -25,6 +31,8 @@ namespace sierra {
 namespace nalu {
 
 struct ActuatorInfoNGP;
+struct ActuatorNodeBins;
+struct ActuatorInterpCache;
 
 /*! \brief Meta data for working with actuator fields
  * This is an example of meta data that will be used to construct an actuator
@@ -46,12 +54,45 @@ struct ActuatorMeta
   bool isotropicGaussian_;
   std::vector<std::string> searchTargetNames_;
   stk::search::SearchMethod searchMethod_;
+  bool searchPersistentTree_ = true;
+  bool spreadOnDevice_ = false;
+  bool interpolateOnDevice_ = false;
   ActScalarIntDv numPointsTurbine_;
   bool useFLLC_ = false;
   ActVectorDblDv epsilonChord_;
   ActVectorDblDv epsilon_;
   ActFixScalarBool entityFLLC_;
   ActScalarIntDv numNearestPointsFllcInt_;
+  //! rank of every turbine, turbine t lives on rank t when empty
+  std::vector<int> turbineRank_;
+  //! binary load timeseries when not empty, see ActuatorBinaryOutput.h
+  std::string binaryOutputName_;
+  int binaryOutputFlushFrequency_ = 100;
+  int binaryOutputTurbinesPerFile_ = 1;
+  bool binaryOutputPoints_ = false;
+};
+
+/*! \brief Communicators of the ranks that touch the points of every turbine
+ *
+ * The members of a turbine are its rank, the ranks whose coarse search found
+ * one of its points and the ranks pinned as consumers of its point data, e.g.
+ * the FLLC blade owners. The communicators are only split again when the
+ * membership changes.
+ */
+struct ActuatorTurbineComms
+{
+  ActuatorTurbineComms() = default;
+  ActuatorTurbineComms(const ActuatorTurbineComms&) = delete;
+  ActuatorTurbineComms& operator=(const ActuatorTurbineComms&) = delete;
+  ~ActuatorTurbineComms();
+
+  void update(const std::vector<int>& member);
+
+  std::vector<MPI_Comm> comms_;
+  std::vector<int> member_;
+  // point range of every turbine
+  std::vector<int> offset_;
+  std::vector<int> numPoints_;
 };
 
 /*! \brief Where field data is stored and accessed for actuators
@@ -70,6 +111,41 @@ struct ActuatorBulk
   void zero_source_terms(stk::mesh::BulkData& stkBulk);
   void parallel_sum_source_term(stk::mesh::BulkData& stkBulk);
   void compute_offsets(const ActuatorMeta& actMeta);
+
+  //! Rebuild the turbine communicators from the coarse search results
+  void update_turbine_comms(const ActuatorMeta& actMeta);
+
+  //! Keep this rank in the communicator of the turbine holding a point
+  void pin_turbine_comm_member(int pointId);
+
+  /*! \brief Sum point data over the ranks of every turbine
+   *
+   * The data of the points of a turbine is complete on its communicator
+   * only; before the first search the reduction is over all ranks. The
+   * pointer may be a device pointer if MPI accepts those.
+   */
+  void
+  reduce_point_data(double* data, int numPoints, int valuesPerPoint) const;
+
+  template <typename T>
+  void reduce_point_view(T view) const
+  {
+    static_assert(
+      std::is_same<typename T::value_type, double>::value,
+      "point data reductions are for doubles");
+    const int numPoints = view.extent_int(0);
+    if (numPoints > 0)
+      reduce_point_data(view.data(), numPoints, view.size() / numPoints);
+  }
+
+  /*! \brief Sum point data last modified on device over every turbine
+   *
+   * Reduces the device view when MPI accepts device buffers and the host
+   * view otherwise; the reduced side is marked modified.
+   */
+  void reduce_point_dual_view(ActScalarDblDv dualView) const;
+  void reduce_point_dual_view(ActVectorDblDv dualView) const;
+
   Kokkos::RangePolicy<ActuatorFixedExecutionSpace>
   local_range_policy(const ActuatorMeta& actMeta);
 
@@ -97,6 +173,26 @@ struct ActuatorBulk
   ActFixScalarInt localParallelRedundancy_;
   ActFixElemIds elemContainingPoint_;
 
+  // element search tree reused until the mesh is modified
+  std::shared_ptr<const ActuatorElementTree> elemTree_;
+  size_t elemTreeSyncCount_ = 0;
+
+  // trees of the realm, shared with the other point searches; optional
+  std::shared_ptr<ElementSearchTreeCache> searchTreeCache_;
+
+  // incremented by every stk_search_act_pnts
+  size_t searchCount_ = 0;
+
+  // node grids of the device force spreading, see ActuatorNodeSpreading.h
+  std::shared_ptr<ActuatorNodeBins> nodeBins_;
+
+  // device velocity sampling, see ActuatorInterpNgp.h
+  std::shared_ptr<ActuatorInterpCache> interpCache_;
+
+  // set by the first search
+  std::shared_ptr<ActuatorTurbineComms> turbineComms_;
+  std::vector<int> pinnedPoints_;
+
   const int localTurbineId_;
 };
 
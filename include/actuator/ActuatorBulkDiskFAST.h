@@ -24,10 +24,34 @@ public:
   ActFixArrayInt numSweptOffset_;
   void spread_forces_over_disk(const ActuatorMetaFAST& actMeta);
 
+  /** Move the points of the rotors with the hub and shaft of OpenFAST
+   *
+   * The blade, hub and swept points are fixed in the rotor coordinates taken
+   * at construction and are rotated on device whenever a hub moves or a
+   * shaft turns, e.g. under yaw control. Disk points do not follow the blade
+   * azimuth.
+   *
+   * \return true if any point moved and the points must be searched again
+   */
+  bool update_rotor_points(const ActuatorMetaFAST& actMeta);
+
+  // offset of every point from its hub at construction, device resident
+  ActVectorDblDv rotorCoords_;
+  // turbine of every rotor point, -1 for the tower points
+  ActScalarIntDv rotorTurbine_;
+
+  // hub and shaft of every turbine at construction and at the last placement
+  ActFixVectorDbl hubInitial_;
+  ActFixVectorDbl shaftInitial_;
+  ActFixVectorDbl hubPlaced_;
+  ActFixVectorDbl shaftPlaced_;
+
 private:
   void compute_swept_point_count(ActuatorMetaFAST& actMeta);
   void resize_arrays(const ActuatorMetaFAST& actMeta);
   void initialize_swept_points(const ActuatorMetaFAST& actMeta);
+  void initialize_rotor_coordinates(const ActuatorMetaFAST& actMeta);
+  void get_hub_frames(ActFixVectorDbl hub, ActFixVectorDbl shaft);
 };
 
 } /* namespace nalu */
@@ -13,6 +13,8 @@
 #include <actuator/ActuatorBulk.h>
 #include "OpenFAST.H"
 
+#include <future>
+
 namespace sierra {
 namespace nalu {
 
@@ -38,8 +40,21 @@ struct ActuatorMetaFAST : public ActuatorMeta
   ActFixScalarBool useUniformAziSampling_;
   ActFixScalarInt nPointsSwept_;
   ActFixScalarInt nBlades_;
+  // advance OpenFAST concurrently with the fluid solve, lagging one step
+  bool laggedCoupling_ = false;
+  // place the turbines on the ranks owning the fewest nodes
+  bool loadBalanceTurbines_ = false;
 };
 
+/**
+ * @brief Assign the turbines to the ranks that own the fewest mesh nodes
+ *
+ * Fills ActuatorMeta::turbineRank_ before the bulk data is created, so that
+ * OpenFAST and the turbine points are placed on the selected ranks.
+ */
+void assign_fast_turbine_ranks(
+  ActuatorMetaFAST& actMeta, const stk::mesh::BulkData& stkBulk);
+
 struct ActuatorBulkFAST : public ActuatorBulk
 {
   ActuatorBulkFAST(const ActuatorMetaFAST& actMeta, double naluTimeStep);
@@ -48,8 +63,14 @@ struct ActuatorBulkFAST : public ActuatorBulk
 
   void interpolate_velocities_to_fast();
   void step_fast();
+  //! launch the OpenFAST steps for the next time step in the background
+  void step_fast_async();
+  //! block until the background OpenFAST steps have completed
+  void wait_fast();
   bool fast_is_time_zero();
   void output_torque_info(stk::mesh::BulkData& stkBulk);
+  //! print the time spent in OpenFAST by the rank of every turbine
+  void output_fast_timing();
   void
   init_openfast(const ActuatorMetaFAST& actMeta, const double naluTimeStep);
   void init_epsilon(const ActuatorMetaFAST& actMeta);
@@ -67,6 +88,9 @@ struct ActuatorBulkFAST : public ActuatorBulk
 
   fast::OpenFAST openFast_;
   const int tStepRatio_;
+  bool laggedCoupling_;
+  std::future<void> fastStep_;
+  double fastTime_{0.0};
   ActDualViewHelper<ActuatorMemSpace> dvHelper_;
 };
 
@@ -23,9 +23,9 @@ struct ActuatorMeta;
 
 class FilteredLiftingLineCorrection {
 public:
-using exec_space = ActuatorFixedExecutionSpace;
-using mem_space = ActuatorFixedMemSpace;
-using mem_layout = ActuatorFixedMemLayout;
+using exec_space = ActuatorExecutionSpace;
+using mem_space = ActuatorMemSpace;
+using mem_layout = ActuatorMemLayout;
 
 FilteredLiftingLineCorrection(const ActuatorMeta& actMeta, ActuatorBulk& actBulk);
 FilteredLiftingLineCorrection() = delete;
@@ -62,6 +62,15 @@ ActuatorBulk& actBulk_;
 const ActuatorMeta& actMeta_;
 std::vector<BladeDistributionInfo> bladeDistInfo_;
 
+// the points of all local blades packed back to back, so that every stage is
+// one kernel over all blades of all turbines
+int numPackedPoints_{0};
+ActScalarInt pointId_;
+ActScalarInt pointBlade_;
+ActScalarInt bladeOffset_;
+ActScalarInt bladeNumPoints_;
+ActScalarInt bladeNumNeighbors_;
+
 };
 } // namespace nalu
 } // namespace sierra
@@ -43,7 +43,7 @@ void RunInterpActuatorVel(ActuatorBulk& actBulk, stk::mesh::BulkData& stkBulk)
   Kokkos::deep_copy(actBulk.velocity_.view_host(), 0.0);
   actBulk.velocity_.modify_host();
   Kokkos::parallel_for("InterpActVel", actBulk.velocity_.extent(0), InterpActuatorVel(actBulk, stkBulk));
-  actuator_utils::reduce_view_on_host(actBulk.velocity_.view_host());
+  actBulk.reduce_point_view(actBulk.velocity_.view_host());
 }
 
 struct SpreadForceInnerLoop
@@ -77,7 +77,7 @@ void RunActFastComputeForce(ActuatorBulkFAST& actBulk)
   Kokkos::deep_copy(actBulk.actuatorForce_.view_host(),0.0);
   actBulk.actuatorForce_.modify_host();
   Kokkos::parallel_for("ActFastComputeForce", actBulk.local_range_policy(), ActFastComputeForce(actBulk));
-  actuator_utils::reduce_view_on_host(actBulk.actuatorForce_.view_host());
+  actBulk.reduce_point_view(actBulk.actuatorForce_.view_host());
 }
 
 struct ActFastSetUpThrustCalc
@@ -112,7 +112,7 @@ void RunActFastStashOrientVecs(ActuatorBulkFAST& actBulk)
   Kokkos::deep_copy(actBulk.orientationTensor_.view_host(),0.0);
   actBulk.orientationTensor_.modify_host();
   Kokkos::parallel_for("ActFastStashOrientations", actBulk.local_range_policy(), ActFastStashOrientationVectors(actBulk));
-  actuator_utils::reduce_view_on_host(actBulk.orientationTensor_.view_host());
+  actBulk.reduce_point_view(actBulk.orientationTensor_.view_host());
 }
 
 struct ActFastComputeThrustInnerLoop
@@ -0,0 +1,68 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ACTUATORINTERPNGP_H_
+#define ACTUATORINTERPNGP_H_
+
+#include <actuator/ActuatorTypes.h>
+#include <stk_mesh/base/Types.hpp>
+
+#include <cstddef>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+struct ActuatorMeta;
+struct ActuatorBulk;
+
+/*! \brief Interpolation stencils of the actuator points found on this rank
+ *
+ * The nodes of the element containing each point and their shape function
+ * values at the isoparametric coordinates of the fine search, divided by the
+ * parallel redundancy of the point. Built on host after every search and
+ * copied to device; points found on other ranks have no nodes.
+ */
+struct ActuatorInterpCache
+{
+  static constexpr int maxNodes = 27;
+
+  void build(const ActuatorBulk& actBulk, const stk::mesh::BulkData& stkBulk);
+
+  Kokkos::View<stk::mesh::FastMeshIndex* [maxNodes], ActuatorMemLayout, ActuatorMemSpace>
+    nodes_;
+  Kokkos::View<double* [maxNodes], ActuatorMemLayout, ActuatorMemSpace> weights_;
+  ActScalarInt numNodes_;
+  size_t searchCount_{0};
+  bool built_{false};
+};
+
+/*! \brief Sample the velocity at the actuator points on device
+ *
+ * One kernel evaluates the cached stencils of all points, then one allreduce
+ * per turbine over its communicator sums the contributions, on device
+ * buffers when MPI accepts them. The velocities are complete on the ranks of
+ * the turbine communicator only, see ActuatorBulk::reduce_point_data.
+ *
+ * Replaces `RunInterpActuatorVel`.
+ */
+void RunInterpActuatorVelNgp(
+  const ActuatorMeta& actMeta,
+  ActuatorBulk& actBulk,
+  stk::mesh::BulkData& stkBulk);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ACTUATORINTERPNGP_H_ */
@@ -15,6 +15,7 @@
 #include <actuator/ActuatorExecutor.h>
 #include <actuator/ActuatorFLLC.h>
 #include <actuator/ActuatorBulk.h>
+#include <actuator/ActuatorBinaryOutput.h>
 
 namespace YAML {
 class Node;
@@ -38,6 +39,8 @@ namespace dcast{
 namespace sierra{
 namespace nalu{
 
+class PartitionWeights;
+
 /**
  * @brief This is the interface class for running all the kokkos based actuator models
  *
@@ -49,6 +52,7 @@ struct ActuatorModel{
 std::shared_ptr<ActuatorMeta> actMeta_;
 std::shared_ptr<ActuatorBulk> actBulk_;
 std::shared_ptr<ActuatorExecutor> actExec_;
+std::unique_ptr<ActuatorBinaryOutput> binaryOutput_;
 
 ActuatorModel() =default;
 virtual ~ActuatorModel(){};
@@ -56,7 +60,15 @@ virtual ~ActuatorModel(){};
 void parse(const YAML::Node& actuatorNode);
 void setup(double timeStep, stk::mesh::BulkData& stkBulk);
 void execute(double& timer);
+//! buffer the loads of this step for the binary output, if requested
+void output_binary(int timeStepCount, double time);
 void init(stk::mesh::BulkData& stkBulk);
+//! search the elements through the trees of the realm; call after setup
+void set_search_tree_cache(std::shared_ptr<ElementSearchTreeCache> cache);
+//! register the source regions known before the mesh is balanced
+void add_partition_weights(PartitionWeights& weights, double weight) const;
+//! collective, prints the model specific timers
+void output_timing();
 inline 
 bool is_active(){
   return actMeta_!=nullptr;
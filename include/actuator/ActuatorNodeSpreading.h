@@ -0,0 +1,94 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ACTUATORNODESPREADING_H_
+#define ACTUATORNODESPREADING_H_
+
+#include <actuator/ActuatorTypes.h>
+#include <stk_mesh/base/Types.hpp>
+
+#include <cstddef>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+struct ActuatorMeta;
+struct ActuatorBulk;
+
+/*! \brief Uniform grids of the mesh nodes around every turbine
+ *
+ * Each turbine gets a cube centred on the mean of its points that holds the
+ * spheres of all of its points for any rotation about that centre. The
+ * locally owned nodes of the search target parts inside the cube are sorted
+ * into cubic bins whose edge is the largest search radius of the turbine, so
+ * that a point only visits the 27 bins around it. The bins are built on host
+ * and copied to device once, and rebuilt only when the mesh is modified or a
+ * point leaves its cube.
+ */
+struct ActuatorNodeBins
+{
+  void build(
+    const ActuatorMeta& actMeta,
+    const ActuatorBulk& actBulk,
+    const stk::mesh::BulkData& stkBulk);
+
+  bool is_current(
+    const ActuatorMeta& actMeta,
+    const ActuatorBulk& actBulk,
+    const stk::mesh::BulkData& stkBulk) const;
+
+  // per turbine grid: lower corner, bin edge, bins per direction, first bin
+  ActVectorDbl gridLower_;
+  ActScalarDbl gridBinSize_;
+  Kokkos::View<int* [3], ActuatorMemLayout, ActuatorMemSpace> gridNumBins_;
+  ActScalarInt gridBinStart_;
+
+  // CSR of the binned nodes over all grids
+  ActScalarInt binOffsets_;
+  Kokkos::View<stk::mesh::FastMeshIndex*, ActuatorMemLayout, ActuatorMemSpace>
+    binNodes_;
+
+  //! turbine of every actuator point
+  ActScalarInt pointTurbine_;
+
+  // host copies of the grid cubes to check the points against
+  ActFixVectorDbl hostCenter_;
+  ActFixScalarDbl hostHalfWidth_;
+  ActFixScalarDbl hostBinSize_;
+  size_t syncCount_{0};
+  bool built_{false};
+};
+
+/*! \brief Spread the actuator forces on device into `actuator_source`
+ *
+ * Every node within the search radius of a point receives the Gaussian of
+ * its distance times the point force; nodes further away are skipped. With
+ * an orientation tensor the distance is first rotated into the point frame,
+ * i.e. the anisotropic Gaussian. The binned nodes are locally owned only so
+ * the final parallel sum copies the owned values onto the shared nodes.
+ *
+ * Replaces the `SpreadActuatorForce` loop over the coarse search results and
+ * the following `ActuatorBulk::parallel_sum_source_term`.
+ */
+void spread_actuator_force_on_device(
+  const ActuatorMeta& actMeta,
+  ActuatorBulk& actBulk,
+  stk::mesh::BulkData& stkBulk,
+  ActTensorDblDv* orientation = nullptr);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ACTUATORNODESPREADING_H_ */
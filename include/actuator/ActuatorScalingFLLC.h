@@ -15,25 +15,37 @@
 #ifdef NALU_USES_OPENFAST
 #include <actuator/ActuatorBulkFAST.h>
 #endif
+#include <stk_math/StkMath.hpp>
 #include <stdexcept>
 
 namespace sierra{
 namespace nalu{
 namespace FLLC{
 
-template <typename range_type, typename helper_type>
+/**
+ * @brief Scale the lift force of the packed points of all local blades
+ *
+ * @param pointId point index of every packed point
+ * @param pointBlade local blade of every packed point
+ * @param bladeOffset first point index of every local blade
+ * @param bladeNumPoints number of points along every local blade
+ */
+template <typename range_type, typename helper_type, typename index_type>
 void
 scale_lift_force(
   ActuatorBulk& actBulk,
   const ActuatorMeta& actMeta,
   range_type& rangePolicy,
   helper_type& helper,
-  const int offset,
-  const int nPoints)
+  const index_type pointId,
+  const index_type pointBlade,
+  const index_type bladeOffset,
+  const index_type bladeNumPoints)
 {
   // suppress compiler warnings for unused variables when compiling w/o openfast
-  (void)offset;
-  (void)nPoints;
+  (void)pointBlade;
+  (void)bladeOffset;
+  (void)bladeNumPoints;
 
   switch (actMeta.actuatorType_) {
   case (ActuatorType::ActLineSimpleNGP): {
@@ -46,7 +58,8 @@ scale_lift_force(
     double dR = actMetaSimple.dR_.h_view(turbId);
 
     Kokkos::parallel_for(
-      "scale G", rangePolicy, ACTUATOR_LAMBDA(int i) {
+      "scale G", rangePolicy, KOKKOS_LAMBDA(int k) {
+        const int i = pointId(k);
         const double denom = rho(i) * dR;
         for (int j = 0; j < 3; ++j) {
           G(i, j) /= denom;
@@ -65,23 +78,30 @@ scale_lift_force(
     auto G = helper.get_local_view(actBulk.liftForceDistribution_);
     auto point = helper.get_local_view(actBulk.pointCentroid_);
     Kokkos::parallel_for(
-      "scale G FAST outputs", rangePolicy, ACTUATOR_LAMBDA(int i) {
+      "scale G FAST outputs", rangePolicy, KOKKOS_LAMBDA(int k) {
+        const int i = pointId(k);
+        const int offset = bladeOffset(pointBlade(k));
+        const int nPoints = bladeNumPoints(pointBlade(k));
         double dr = 0;
+        double dx = 0;
         if (i == offset) {
           for (int j = 0; j < 3; ++j) {
-            dr += std::pow(point(i, j) - point(i + 1, j), 2.0);
+            dx = point(i, j) - point(i + 1, j);
+            dr += dx * dx;
           }
         } else if (i == offset + nPoints - 1) {
           for (int j = 0; j < 3; ++j) {
-            dr += std::pow(point(i, j) - point(i - 1, j), 2.0);
+            dx = point(i, j) - point(i - 1, j);
+            dr += dx * dx;
           }
         } else {
           for (int j = 0; j < 3; ++j) {
-            dr += std::pow(point(i - 1, j) - point(i + 1, j), 2.0);
+            dx = point(i - 1, j) - point(i + 1, j);
+            dr += dx * dx;
           }
         }
         // dr is computed using central difference
-        dr = 0.5 * std::sqrt(dr);
+        dr = 0.5 * stk::math::sqrt(dr);
         for (int j = 0; j < 3; ++j) {
           G(i, j) /= dr;
         }
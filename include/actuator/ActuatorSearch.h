@@ -16,6 +16,7 @@
 #include <stk_search/BoundingBox.hpp>
 #include <stk_search/IdentProc.hpp>
 #include <stk_search/SearchMethod.hpp>
+#include <utils/ElementSearchTree.h>
 
 // common type defs
 using theKey = stk::search::IdentProc<uint64_t, int>;
@@ -38,6 +39,9 @@ CreateBoundingSpheres(ActFixVectorDbl points, ActFixScalarDbl searchRadius);
 VecBoundElemBox CreateElementBoxes(
   stk::mesh::BulkData& stkBulk, std::vector<std::string> partNameList);
 
+//! Element tree reused over the searches of a static background mesh
+using ActuatorElementTree = ElementSearchTree;
+
 void ExecuteCoarseSearch(
   VecBoundSphere& spheres,
   VecBoundElemBox& elemBoxes,
@@ -45,6 +49,12 @@ void ExecuteCoarseSearch(
   ActScalarU64Dv& coarseElemIds,
   stk::search::SearchMethod searchMethod);
 
+void ExecuteCoarseSearch(
+  VecBoundSphere& spheres,
+  const ActuatorElementTree& elemTree,
+  ActScalarU64Dv& coarsePointIds,
+  ActScalarU64Dv& coarseElemIds);
+
 void ExecuteFineSearch(
   stk::mesh::BulkData& stkBulk,
   ActScalarU64Dv coarsePointIds,
@@ -53,7 +63,8 @@ void ExecuteFineSearch(
   ActFixElemIds matchElemIds,
   ActFixVectorDbl localCoords,
   ActFixScalarBool isLocalPoint,
-  ActFixScalarInt localParallelRedundancy);
+  ActFixScalarInt localParallelRedundancy,
+  const bool warmStart = false);
 
 } // namespace nalu
 } // namespace sierra
@@ -27,6 +27,8 @@
 #include <OpenFAST.H>
 #endif
 
+#include <cmath>
+
 namespace sierra {
 namespace nalu {
 
@@ -146,6 +148,44 @@ void compute_distance(
   const double* elemCentroid,
   const double* pointCentroid,
   double* distance);
+
+/** Smallest rotation that turns the unit vector a0 into the unit vector a
+ *
+ * Stored row major in R. Carries the points fixed relative to a rotor along
+ * with its shaft; the roll about the shaft is left out.
+ */
+KOKKOS_INLINE_FUNCTION void
+shaft_rotation(const double* a0, const double* a, double* R)
+{
+  const double v[3] = {
+    a0[1] * a[2] - a0[2] * a[1], a0[2] * a[0] - a0[0] * a[2],
+    a0[0] * a[1] - a0[1] * a[0]};
+  const double c = a0[0] * a[0] + a0[1] * a[1] + a0[2] * a[2];
+
+  if (1.0 + c < 1.0e-12) {
+    // reversed shaft: half turn about an axis normal to a0
+    const int k = (std::abs(a0[0]) < 0.9) ? 0 : 1;
+    double n[3] = {-a0[k] * a0[0], -a0[k] * a0[1], -a0[k] * a0[2]};
+    n[k] += 1.0;
+    const double nMag = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 3; ++j)
+        R[3 * i + j] = 2.0 * n[i] * n[j] / (nMag * nMag) - (i == j ? 1.0 : 0.0);
+    return;
+  }
+
+  // Rodrigues: R = I + [v]x + [v]x^2 / (1 + c)
+  const double vx[9] = {0.0, -v[2], v[1], v[2], 0.0, -v[0], -v[1], v[0], 0.0};
+  const double f = 1.0 / (1.0 + c);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      double vx2 = 0.0;
+      for (int k = 0; k < 3; ++k)
+        vx2 += vx[3 * i + k] * vx[3 * k + j];
+      R[3 * i + j] = (i == j ? 1.0 : 0.0) + vx[3 * i + j] + f * vx2;
+    }
+  }
+}
 } // namespace actuator_utils
 } // namespace nalu
 } // namespace sierra
@@ -41,7 +41,7 @@ private:
   const double eps_{1.0e-16};
   const double pecScale_;
   const int nDim_;
-  PecletFunction<DblType>* pecletFunction_{nullptr};
+  NgpPecletFunction<DblType> pecletFunction_;
 };
 
 } // namespace nalu
@@ -12,6 +12,7 @@
 #define ASSEMBLEEDGEKERNEL_H
 
 #include "AssembleEdgeSolverAlgorithm.h"
+#include "NGPInstance.h"
 
 #include <vector>
 #include <memory>
@@ -42,6 +43,9 @@ public:
 
 protected:
   EdgeKernelVecType edgeKernels_;
+
+  //! Device instances of the edge kernels, refreshed in place
+  nalu_ngp::NGPInstanceView<EdgeKernel> ngpKernels_;
 };
 
 } // namespace nalu
@@ -37,6 +37,8 @@ private:
   unsigned edgeAreaVec_ {stk::mesh::InvalidOrdinal};
   unsigned edgeFaceVelMag_{stk::mesh::InvalidOrdinal}; 
   unsigned Udiag_ {stk::mesh::InvalidOrdinal};
+  unsigned edgeMetrics_ {stk::mesh::InvalidOrdinal};
+  unsigned massFlowRate_ {stk::mesh::InvalidOrdinal};
 };
 
 }  // nalu
@@ -78,8 +78,10 @@ public:
 
   virtual EdgeKernel* create_on_device() final
   {
-    free_on_device();
-    deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    if (deviceCopy_ == nullptr)
+      deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    else
+      nalu_ngp::update<T>(deviceCopy_, *dynamic_cast<T*>(this));
     return deviceCopy_;
   }
 
@@ -13,6 +13,8 @@
 
 #include "SimdInterface.h"
 
+#include "stk_mesh/base/Types.hpp"
+
 namespace sierra {
 namespace nalu {
 
@@ -24,6 +26,46 @@ T van_leer(const T& dqm, const T& dqp, const T& eps)
          ((dqm + dqp) * (dqm + dqp) + eps);
 }
 
+/** Edge length vector, squared area magnitude and inverse of A.dx of an edge
+ *
+ *  Read from the `edge_metrics` field when the cache is in use, see the
+ *  `edge_metrics_cache` solution option; computed from the nodal coordinates
+ *  and the edge area vector otherwise. The field stores `ndim` components of
+ *  the length vector followed by `asq` and `inv_axdx`.
+ */
+template<typename EdgeFieldType, typename NodeFieldType, typename T>
+KOKKOS_FORCEINLINE_FUNCTION
+void edge_metrics(
+  const bool useCache,
+  const EdgeFieldType& edgeMetrics,
+  const NodeFieldType& coordinates,
+  const stk::mesh::FastMeshIndex& edge,
+  const stk::mesh::FastMeshIndex& nodeL,
+  const stk::mesh::FastMeshIndex& nodeR,
+  const int ndim,
+  const T* av,
+  T* dx,
+  T& asq,
+  T& inv_axdx)
+{
+  if (useCache) {
+    for (int d=0; d < ndim; ++d)
+      dx[d] = edgeMetrics.get(edge, d);
+    asq = edgeMetrics.get(edge, ndim);
+    inv_axdx = edgeMetrics.get(edge, ndim + 1);
+    return;
+  }
+
+  T axdx = 0.0;
+  asq = 0.0;
+  for (int d=0; d < ndim; ++d) {
+    dx[d] = coordinates.get(nodeR, d) - coordinates.get(nodeL, d);
+    asq += av[d] * av[d];
+    axdx += av[d] * dx[d];
+  }
+  inv_axdx = 1.0 / axdx;
+}
+
 }  // nalu
 }  // sierra
 
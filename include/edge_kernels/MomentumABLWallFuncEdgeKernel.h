@@ -51,7 +51,7 @@ private:
   unsigned density_        {stk::mesh::InvalidOrdinal};
   unsigned bcHeatFlux_     {stk::mesh::InvalidOrdinal};
   unsigned specificHeat_   {stk::mesh::InvalidOrdinal};
-  unsigned exposedAreaVec_ {stk::mesh::InvalidOrdinal};
+  unsigned wallFaceGeom_   {stk::mesh::InvalidOrdinal};
   unsigned wallFricVel_    {stk::mesh::InvalidOrdinal};
   unsigned wallNormDist_   {stk::mesh::InvalidOrdinal};
 
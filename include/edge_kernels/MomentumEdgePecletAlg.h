@@ -19,6 +19,7 @@ namespace nalu{
 
 class Realm;
 class EquationSystem;
+class CourantReAlgDriver;
 
 class MomentumEdgePecletAlg: public Algorithm{
 public:
@@ -28,8 +29,17 @@ public:
   virtual ~MomentumEdgePecletAlg() = default;
   void execute() override;
 
-  
+  /** Compute the Peclet factor and the maximum Courant and Reynolds numbers
+   *
+   *  The edge Courant and Reynolds numbers use the same edge data as the
+   *  Peclet number; the maxima are handed to the driver, which does the
+   *  parallel reduction in place of running its element algorithms.
+   */
+  void execute_with_courant_reynolds(CourantReAlgDriver& cflReDriver);
+
 private:
+  void run_edges(const bool withCflRe, double& maxCFL, double& maxRe);
+
   unsigned pecletNumber_{stk::mesh::InvalidOrdinal};
   unsigned pecletFactor_ {stk::mesh::InvalidOrdinal};
   unsigned density_ {stk::mesh::InvalidOrdinal};
@@ -39,7 +49,7 @@ private:
   unsigned edgeAreaVec_ {stk::mesh::InvalidOrdinal};
   const double eps_{1.0e-16};
   const int nDim_;
-  PecletFunction<DblType>* pecletFunction_{nullptr};
+  NgpPecletFunction<DblType> pecletFunction_;
 };
 
 void determine_max_peclet_factor(stk::mesh::BulkData& bulk, const stk::mesh::MetaData& meta);
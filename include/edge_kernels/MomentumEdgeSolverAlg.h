@@ -29,6 +29,17 @@ public:
 
   virtual void execute();
 
+  /** Assemble with the node vector fields read through the given accessors
+   *
+   *  Either the STK device fields or their structure-of-arrays mirrors, see
+   *  the `soa_vector_fields` solution option.
+   */
+  template <typename NodeVectorField>
+  void execute_with(
+    const NodeVectorField& coordinates,
+    const NodeVectorField& vel,
+    const NodeVectorField& dudx);
+
 private:
   unsigned coordinates_ {stk::mesh::InvalidOrdinal};
   unsigned velocityRTM_ {stk::mesh::InvalidOrdinal};
@@ -39,6 +50,7 @@ private:
   unsigned viscosity_ {stk::mesh::InvalidOrdinal};
   unsigned pecletFactor_ {stk::mesh::InvalidOrdinal};
   unsigned maskNodeField_ {stk::mesh::InvalidOrdinal};
+  unsigned edgeMetrics_ {stk::mesh::InvalidOrdinal};
 };
 
 }  // nalu
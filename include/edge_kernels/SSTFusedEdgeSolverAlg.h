@@ -0,0 +1,99 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef SSTFUSEDEDGESOLVERALG_H
+#define SSTFUSEDEDGESOLVERALG_H
+
+#include "AssembleEdgeSolverAlgorithm.h"
+#include "PecletFunction.h"
+
+namespace sierra {
+namespace nalu {
+
+/** Fused edge assembly for the SST turbulent kinetic energy and specific
+ *  dissipation rate equations
+ *
+ *  Walks the edges once, gathers the shared geometry, velocity, density and
+ *  mass flow rate fields, and scatters the advection-diffusion contributions
+ *  into both the TKE and SDR linear systems. The algorithm is owned by the TKE
+ *  equation system; the SDR equation system registers an EdgeGraphSolverAlg
+ *  so that its linear system graph is still built during (re)initialization.
+ *
+ *  The SDR linear system must be zeroed before this algorithm executes, see
+ *  ShearStressTransportEquationSystem::solve_and_update.
+ */
+class SSTFusedEdgeSolverAlg : public AssembleEdgeSolverAlgorithm
+{
+public:
+  SSTFusedEdgeSolverAlg(
+    Realm&,
+    stk::mesh::Part*,
+    EquationSystem* tkeEqSys,
+    EquationSystem* sdrEqSys,
+    ScalarFieldType* tke,
+    ScalarFieldType* sdr,
+    VectorFieldType* dkdx,
+    VectorFieldType* dwdx,
+    ScalarFieldType* tkeDiffFluxCoeff,
+    ScalarFieldType* sdrDiffFluxCoeff,
+    const bool = false);
+
+  virtual ~SSTFusedEdgeSolverAlg() = default;
+
+  virtual void execute();
+
+private:
+  EquationSystem* sdrEqSys_{nullptr};
+
+  unsigned coordinates_ {stk::mesh::InvalidOrdinal};
+  unsigned velocityRTM_ {stk::mesh::InvalidOrdinal};
+  unsigned density_ {stk::mesh::InvalidOrdinal};
+  unsigned edgeAreaVec_ {stk::mesh::InvalidOrdinal};
+  unsigned massFlowRate_ {stk::mesh::InvalidOrdinal};
+
+  unsigned tke_ {stk::mesh::InvalidOrdinal};
+  unsigned sdr_ {stk::mesh::InvalidOrdinal};
+  unsigned dkdx_ {stk::mesh::InvalidOrdinal};
+  unsigned dwdx_ {stk::mesh::InvalidOrdinal};
+  unsigned tkeDiffFluxCoeff_ {stk::mesh::InvalidOrdinal};
+  unsigned sdrDiffFluxCoeff_ {stk::mesh::InvalidOrdinal};
+
+  NgpPecletFunction<AssembleEdgeSolverAlgorithm::DblType> tkePecletFunction_;
+  NgpPecletFunction<AssembleEdgeSolverAlgorithm::DblType> sdrPecletFunction_;
+
+  std::string tkeName_;
+  std::string sdrName_;
+};
+
+/** Edge solver algorithm that only contributes the edge graph
+ *
+ *  Used by an equation system whose edge contributions are assembled by a
+ *  fused algorithm owned by another equation system.
+ */
+class EdgeGraphSolverAlg : public AssembleEdgeSolverAlgorithm
+{
+public:
+  EdgeGraphSolverAlg(
+    Realm& realm,
+    stk::mesh::Part* part,
+    EquationSystem* eqSystem)
+    : AssembleEdgeSolverAlgorithm(realm, part, eqSystem)
+  {}
+
+  virtual ~EdgeGraphSolverAlg() = default;
+
+  virtual void execute() {}
+};
+
+}  // nalu
+}  // sierra
+
+
+#endif /* SSTFUSEDEDGESOLVERALG_H */
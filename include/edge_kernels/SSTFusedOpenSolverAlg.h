@@ -0,0 +1,90 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef SSTFUSEDOPENSOLVERALG_H
+#define SSTFUSEDOPENSOLVERALG_H
+
+#include "SolverAlgorithm.h"
+#include "FieldTypeDef.h"
+
+#include <string>
+
+namespace sierra {
+namespace nalu {
+
+/** Fused open boundary assembly for the SST turbulent kinetic energy and
+ *  specific dissipation rate equations
+ *
+ *  Walks the open faces once, reads the open mass flow rate once per face and
+ *  scatters the upwinded outflow and entrainment terms of ScalarOpenEdgeKernel
+ *  into both the TKE and SDR linear systems. The algorithm is owned by the TKE
+ *  equation system; the SDR equation system registers a FaceGraphSolverAlg
+ *  so that its linear system graph is still built during (re)initialization.
+ *
+ *  Only the linear faces of the edge-based discretization are supported, for
+ *  which the face integration points sit at the face nodes. As with
+ *  SSTFusedEdgeSolverAlg, the SDR linear system must be zeroed before this
+ *  algorithm executes.
+ */
+class SSTFusedOpenSolverAlg : public SolverAlgorithm
+{
+public:
+  SSTFusedOpenSolverAlg(
+    Realm&,
+    stk::mesh::Part*,
+    EquationSystem* tkeEqSys,
+    EquationSystem* sdrEqSys,
+    ScalarFieldType* tke,
+    ScalarFieldType* sdr);
+
+  virtual ~SSTFusedOpenSolverAlg() = default;
+
+  virtual void initialize_connectivity();
+
+  virtual void execute();
+
+private:
+  EquationSystem* sdrEqSys_{nullptr};
+
+  unsigned tke_ {stk::mesh::InvalidOrdinal};
+  unsigned sdr_ {stk::mesh::InvalidOrdinal};
+  unsigned openMassFlowRate_ {stk::mesh::InvalidOrdinal};
+
+  std::string tkeName_;
+  std::string sdrName_;
+};
+
+/** Face solver algorithm that only contributes the face graph
+ *
+ *  Used by an equation system whose boundary contributions are assembled by a
+ *  fused algorithm owned by another equation system.
+ */
+class FaceGraphSolverAlg : public SolverAlgorithm
+{
+public:
+  FaceGraphSolverAlg(
+    Realm& realm,
+    stk::mesh::Part* part,
+    EquationSystem* eqSystem)
+    : SolverAlgorithm(realm, part, eqSystem)
+  {}
+
+  virtual ~FaceGraphSolverAlg() = default;
+
+  virtual void initialize_connectivity();
+
+  virtual void execute() {}
+};
+
+}  // nalu
+}  // sierra
+
+
+#endif /* SSTFUSEDOPENSOLVERALG_H */
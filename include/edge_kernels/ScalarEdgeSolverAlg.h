@@ -42,8 +42,9 @@ private:
   unsigned edgeAreaVec_ {stk::mesh::InvalidOrdinal};
   unsigned massFlowRate_ {stk::mesh::InvalidOrdinal};
   unsigned diffFluxCoeff_ {stk::mesh::InvalidOrdinal};
+  unsigned edgeMetrics_ {stk::mesh::InvalidOrdinal};
 
-  PecletFunction<AssembleEdgeSolverAlgorithm::DblType>* pecletFunction_{nullptr};
+  NgpPecletFunction<AssembleEdgeSolverAlgorithm::DblType> pecletFunction_;
 
   std::string dofName_;
 };
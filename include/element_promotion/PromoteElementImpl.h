@@ -14,11 +14,14 @@
 #include <stk_mesh/base/FieldBase.hpp>
 #include <stk_mesh/base/CoordinateSystems.hpp>
 
+#include <limits>
 #include <vector>
 #include <tuple>
 #include <unordered_map>
 
 #include <stk_topology/topology.hpp>
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_util/util/ReportHandler.hpp>
 
 namespace stk { namespace mesh { class Part; } }
 namespace stk { namespace mesh { class BulkData; } }
@@ -36,7 +39,45 @@ namespace nalu {
 
 namespace impl {
 
-using ConnectivityMap = std::unordered_map<stk::mesh::Entity, stk::mesh::EntityIdVector>;
+/** New node ids of the parent entities of one rank
+ *
+ *  The ids of the k-th parent are stored contiguously at
+ *  ids[k * nodesPerParent], and parents are looked up through a table indexed
+ *  by the local offset of the entity instead of a hash map.
+ */
+struct ConnectivityMap
+{
+  static constexpr unsigned invalidIndex = std::numeric_limits<unsigned>::max();
+
+  bool empty() const { return parents.empty(); }
+  size_t size() const { return parents.size(); }
+
+  unsigned index(stk::mesh::Entity parent) const
+  {
+    const auto offset = parent.local_offset();
+    return offset < parentIndex.size() ? parentIndex[offset] : invalidIndex;
+  }
+
+  stk::mesh::EntityId* nodes(stk::mesh::Entity parent)
+  {
+    const unsigned k = index(parent);
+    ThrowAssert(k != invalidIndex);
+    return &ids[k * nodesPerParent];
+  }
+
+  const stk::mesh::EntityId* nodes(stk::mesh::Entity parent) const
+  {
+    const unsigned k = index(parent);
+    ThrowAssert(k != invalidIndex);
+    return &ids[k * nodesPerParent];
+  }
+
+  stk::topology::rank_t rank{stk::topology::INVALID_RANK};
+  int nodesPerParent{0};
+  stk::mesh::EntityVector parents;
+  std::vector<unsigned> parentIndex;
+  stk::mesh::EntityIdVector ids;
+};
 
 struct EntityIdVectorHash
 {
@@ -73,28 +114,28 @@ void add_base_nodes_to_elem_connectivity(
   const stk::mesh::BulkData& bulk,
   const HexNElementDescription& desc,
   const stk::mesh::Entity elem,
-  stk::mesh::EntityIdVector& allNodes);
+  stk::mesh::EntityId* allNodes);
 
 void add_edge_nodes_to_elem_connectivity(
   const stk::mesh::BulkData& bulk,
   const HexNElementDescription& desc,
   const ConnectivityMap& edgeConnectivity,
   const stk::mesh::Entity elem,
-  stk::mesh::EntityIdVector& allNodes);
+  stk::mesh::EntityId* allNodes);
 
 void add_face_nodes_to_elem_connectivity(
   const stk::mesh::BulkData& bulk,
   const HexNElementDescription& desc,
   const ConnectivityMap& faceConnectivity,
   const stk::mesh::Entity elem,
-  stk::mesh::EntityIdVector& allNodes);
+  stk::mesh::EntityId* allNodes);
 
 void add_volume_nodes_to_elem_connectivity(
   const stk::mesh::BulkData& bulk,
   const HexNElementDescription& desc,
   const ConnectivityMap& volumeConnectivity,
   const stk::mesh::Entity elem,
-  stk::mesh::EntityIdVector& allNodes);
+  stk::mesh::EntityId* allNodes);
 
 void create_nodes_for_connectivity_map(stk::mesh::BulkData& bulk, const ConnectivityMap& edgeConnectivity);
 
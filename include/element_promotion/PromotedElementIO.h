@@ -57,6 +57,20 @@ namespace stk {
 namespace sierra {
 namespace nalu {
 
+/** How the promoted elements are written
+ *
+ *  ``subdivided`` splits every element into its p^3 linear sub-elements,
+ *  ``linear`` keeps only the corner nodes of every element and ``native``
+ *  writes the elements as HEX27 (p = 2 only). ``composed`` writes one file
+ *  from all ranks through parallel I/O instead of one file per rank.
+ */
+struct PromotedOutputOptions
+{
+  std::string type{"subdivided"};
+  bool composed{false};
+  std::string parallelIOMode{"hdf5"};
+};
+
 class PromotedElementIO
 {
 
@@ -67,7 +81,8 @@ public:
     stk::mesh::BulkData& bulkData,
     const stk::mesh::PartVector& baseParts,
     const std::string& fileName,
-    const VectorFieldType& coordField
+    const VectorFieldType& coordField,
+    const PromotedOutputOptions& options = PromotedOutputOptions()
   );
 
   virtual ~PromotedElementIO() = default;
@@ -83,8 +98,13 @@ private:
   void write_element_connectivity(
     const stk::mesh::PartVector& baseParts,
     const std::vector<stk::mesh::EntityId>& entityIds);
+  void write_element_connectivity_whole(
+    const stk::mesh::Part& part,
+    const stk::mesh::BucketVector& elemBuckets);
 
   size_t sub_element_global_id() const;
+  void collect_output_nodes(const stk::mesh::PartVector& superElemParts);
+  size_t num_output_elements(const stk::mesh::BucketVector& buckets) const;
   void write_node_block_definitions(
       const stk::mesh::PartVector& superElemParts);
   void write_elem_block_definitions(const stk::mesh::PartVector& baseParts);
@@ -94,8 +114,7 @@ private:
   put_data_on_node_block(
     Ioss::NodeBlock& nodeBlock,
     const std::vector<int64_t>& ids,
-    const stk::mesh::FieldBase& field,
-    const stk::mesh::BucketVector& buckets) const;
+    const stk::mesh::FieldBase& field) const;
 
   std::string storage_name(const stk::mesh::FieldBase& field) const;
 
@@ -106,7 +125,9 @@ private:
   const std::string& fileName_;
   const VectorFieldType& coordinates_;
   const unsigned nDim_;
+  const PromotedOutputOptions options_;
   stk::mesh::PartVector superElemParts_;
+  stk::mesh::EntityVector outputNodes_;
 
   std::map<const std::string, const stk::mesh::FieldBase*> fields_;
   std::map<const stk::mesh::Part*, Ioss::ElementBlock*> elementBlockPointers_;
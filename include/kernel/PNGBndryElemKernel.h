@@ -0,0 +1,67 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef PNGBNDRYELEMKERNEL_H
+#define PNGBNDRYELEMKERNEL_H
+
+#include "kernel/Kernel.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/MetaData.hpp"
+#include "stk_mesh/base/Entity.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class ElemDataRequests;
+class MasterElement;
+
+/** Boundary contribution to the projected nodal gradient of a scalar
+ *
+ *  Closes the divergence theorem with the boundary value of the scalar on
+ *  the exposed faces; the device equivalent of
+ *  AssemblePNGBoundarySolverAlgorithm.
+ */
+template <typename BcAlgTraits>
+class PNGBndryElemKernel : public NGPKernel<PNGBndryElemKernel<BcAlgTraits>>
+{
+public:
+  PNGBndryElemKernel(
+    const stk::mesh::BulkData&,
+    const std::string&,
+    const std::string&,
+    ElemDataRequests&);
+
+  KOKKOS_DEFAULTED_FUNCTION
+  PNGBndryElemKernel() = default;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~PNGBndryElemKernel() = default;
+
+  using Kernel::execute;
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    SharedMemView<DoubleType**, DeviceShmem>&,
+    SharedMemView<DoubleType*, DeviceShmem>&,
+    ScratchViews<DoubleType, DeviceTeamHandleType, DeviceShmem>&);
+
+private:
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned scalarQ_{stk::mesh::InvalidOrdinal};
+  unsigned exposedAreaVec_{stk::mesh::InvalidOrdinal};
+
+  MasterElement* meFC_{nullptr};
+};
+
+}  // nalu
+}  // sierra
+
+#endif /* PNGBNDRYELEMKERNEL_H */
@@ -0,0 +1,69 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef PNGELEMKERNEL_H
+#define PNGELEMKERNEL_H
+
+#include "kernel/Kernel.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/MetaData.hpp"
+#include "stk_mesh/base/Entity.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class ElemDataRequests;
+class MasterElement;
+
+/** Interior contribution to the projected nodal gradient of a scalar
+ *
+ *  Assembles the lumped-at-ip SCV mass matrix for every gradient component
+ *  and the residual of the Gauss divergence theorem over the subcontrol
+ *  surfaces; the device equivalent of AssemblePNGElemSolverAlgorithm.
+ */
+template <typename AlgTraits>
+class PNGElemKernel : public NGPKernel<PNGElemKernel<AlgTraits>>
+{
+public:
+  PNGElemKernel(
+    const stk::mesh::BulkData&,
+    const std::string&,
+    const std::string&,
+    const std::string&,
+    ElemDataRequests&);
+
+  KOKKOS_DEFAULTED_FUNCTION
+  PNGElemKernel() = default;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~PNGElemKernel() = default;
+
+  using Kernel::execute;
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    SharedMemView<DoubleType**, DeviceShmem>&,
+    SharedMemView<DoubleType*, DeviceShmem>&,
+    ScratchViews<DoubleType, DeviceTeamHandleType, DeviceShmem>&);
+
+private:
+  unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  unsigned scalarQ_{stk::mesh::InvalidOrdinal};
+  unsigned dqdx_{stk::mesh::InvalidOrdinal};
+
+  MasterElement* meSCS_{nullptr};
+  MasterElement* meSCV_{nullptr};
+};
+
+}  // nalu
+}  // sierra
+
+#endif /* PNGELEMKERNEL_H */
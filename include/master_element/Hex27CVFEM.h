@@ -193,7 +193,20 @@ protected:
 
   const double scsDist_ = std::sqrt(3.0)/3.0;
   const double scsEndLoc_[4] =  { -1.0, -scsDist_, scsDist_, 1.0 };
- 
+
+  // the ips are tensor products of 1D points: the six Gauss points of the
+  // three sub-intervals (or their shifted counterparts) and the two scs
+  // locations. Quadratic Lagrange basis and derivative at those points
+  static constexpr int numGauss1D_ = nodes1D_ * numQuad_; // 6
+  static constexpr int numScs1D_ = nodes1D_ - 1; // 2
+  static constexpr int ipsPerDirection_ = numIntPoints_ / nDim_; // 72
+  double gaussBasis1D_[numGauss1D_][nodes1D_];
+  double gaussDeriv1D_[numGauss1D_][nodes1D_];
+  double shiftBasis1D_[numGauss1D_][nodes1D_];
+  double shiftDeriv1D_[numGauss1D_][nodes1D_];
+  double scsBasis1D_[numScs1D_][nodes1D_];
+  double scsDeriv1D_[numScs1D_][nodes1D_];
+
   double intgExpFace_        [numFaceIps_*nDim_]; // size = 648
   double expFaceShapeDerivs_ [numFaceIps_*nodesPerElement_*nDim_];
   double shapeFunctions_     [numIntPoints_*nodesPerElement_];
@@ -230,7 +243,120 @@ protected:
     double* shape_fcn
   ) const;
 
+  static void quadratic_lagrange_1d(double x, double* basis, double* deriv);
+
+  /** Jacobians at a tensor product of 1D points by sum factorization
+   *
+   *  The nodal coordinates are contracted with the 1D basis one direction at
+   *  a time, O(p^4) work instead of the O(p^6) of looping over every node at
+   *  every ip. Calls f(c, b, a, jac) at the point (s_a, t_b, u_c) with
+   *  jac[i][j] = dx_i/ds_j, the layout of `generic_grad_op`.
+   */
+  template <
+    int ns, int nt, int nu,
+    typename CoordViewType, typename Func>
+  KOKKOS_FUNCTION void tensor_jacobians(
+    const double (&basisS)[ns][nodes1D_], const double (&derivS)[ns][nodes1D_],
+    const double (&basisT)[nt][nodes1D_], const double (&derivT)[nt][nodes1D_],
+    const double (&basisU)[nu][nodes1D_], const double (&derivU)[nu][nodes1D_],
+    const CoordViewType& coords,
+    Func&& f) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    static_assert(CoordViewType::Rank == 2, "Coordinate view assumed to be 2D");
+    constexpr int n1 = nodes1D_;
+
+    // interpolate / differentiate in s
+    NALU_ALIGNED ftype xB[n1][n1][ns][3];
+    NALU_ALIGNED ftype xD[n1][n1][ns][3];
+    for (int k = 0; k < n1; ++k) {
+      for (int j = 0; j < n1; ++j) {
+        for (int a = 0; a < ns; ++a) {
+          for (int d = 0; d < 3; ++d) {
+            xB[k][j][a][d] = 0.0;
+            xD[k][j][a][d] = 0.0;
+          }
+          for (int i = 0; i < n1; ++i) {
+            const int node = stkNodeMap_[k][j][i];
+            for (int d = 0; d < 3; ++d) {
+              xB[k][j][a][d] += basisS[a][i] * coords(node, d);
+              xD[k][j][a][d] += derivS[a][i] * coords(node, d);
+            }
+          }
+        }
+      }
+    }
+
+    // then in t: interpolated, d/ds and d/dt
+    NALU_ALIGNED ftype xBB[n1][nt][ns][3];
+    NALU_ALIGNED ftype xDB[n1][nt][ns][3];
+    NALU_ALIGNED ftype xBD[n1][nt][ns][3];
+    for (int k = 0; k < n1; ++k) {
+      for (int b = 0; b < nt; ++b) {
+        for (int a = 0; a < ns; ++a) {
+          for (int d = 0; d < 3; ++d) {
+            xBB[k][b][a][d] = 0.0;
+            xDB[k][b][a][d] = 0.0;
+            xBD[k][b][a][d] = 0.0;
+            for (int j = 0; j < n1; ++j) {
+              xBB[k][b][a][d] += basisT[b][j] * xB[k][j][a][d];
+              xDB[k][b][a][d] += basisT[b][j] * xD[k][j][a][d];
+              xBD[k][b][a][d] += derivT[b][j] * xB[k][j][a][d];
+            }
+          }
+        }
+      }
+    }
 
+    // and finally in u, one point at a time
+    for (int c = 0; c < nu; ++c) {
+      for (int b = 0; b < nt; ++b) {
+        for (int a = 0; a < ns; ++a) {
+          NALU_ALIGNED ftype jac[3][3];
+          for (int d = 0; d < 3; ++d) {
+            jac[d][0] = 0.0;
+            jac[d][1] = 0.0;
+            jac[d][2] = 0.0;
+            for (int k = 0; k < n1; ++k) {
+              jac[d][0] += basisU[c][k] * xDB[k][b][a][d];
+              jac[d][1] += basisU[c][k] * xBD[k][b][a][d];
+              jac[d][2] += derivU[c][k] * xBB[k][b][a][d];
+            }
+          }
+          f(c, b, a, jac);
+        }
+      }
+    }
+  }
+
+  //! gradient operator at one ip given the Jacobian, as `generic_grad_op`
+  template <typename ftype, typename GradViewType, typename OutputViewType>
+  KOKKOS_FUNCTION void grad_op_from_jacobian(
+    int ip,
+    const ftype (&jac)[3][3],
+    const GradViewType& referenceGradWeights,
+    OutputViewType& gradop) const
+  {
+    NALU_ALIGNED ftype adjJac[3][3];
+    cofactorMatrix(adjJac, jac);
+
+    NALU_ALIGNED ftype det = ftype(0.0);
+    for (int i = 0; i < 3; ++i) det += jac[i][0] * adjJac[i][0];
+    ThrowAssertMsg(
+      stk::simd::are_any(det > tiny_positive_value()),
+      "Problem with Jacobian determinant"
+    );
+    NALU_ALIGNED const ftype inv_detj = ftype(1.0) / det;
+
+    for (int n = 0; n < AlgTraits::nodesPerElement_; ++n) {
+      for (int i = 0; i < 3; ++i) {
+        gradop(ip, n, i) = inv_detj * (
+            adjJac[i][0] * referenceGradWeights(ip, n, 0)
+          + adjJac[i][1] * referenceGradWeights(ip, n, 1)
+          + adjJac[i][2] * referenceGradWeights(ip, n, 2));
+      }
+    }
+  }
 };
 
 // 3D Quad 27 subcontrol volume
@@ -298,12 +424,57 @@ public:
     }
   }
 
+  //! `weighted_volumes` with sum-factorized Jacobians
+  template <typename CoordViewType, typename OutputViewType>
+  KOKKOS_FUNCTION void tensor_weighted_volumes(const CoordViewType& coords, OutputViewType& volume) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    static_assert(OutputViewType::Rank == 1, "Volume view assumed to be 1D");
+
+    tensor_jacobians(
+      gaussBasis1D_, gaussDeriv1D_,
+      gaussBasis1D_, gaussDeriv1D_,
+      gaussBasis1D_, gaussDeriv1D_,
+      coords,
+      [&](int c, int b, int a, const ftype (&jac)[3][3]) {
+        const int ip = scv_ip(a, b, c);
+        volume(ip) = ipWeight_[ip] * determinant33(&jac[0][0]);
+      });
+  }
+
+  //! `generic_grad_op` with sum-factorized Jacobians
+  template <typename CoordViewType, typename OutputViewType>
+  KOKKOS_FUNCTION void tensor_grad_op(bool shifted, const CoordViewType& coords, OutputViewType& gradop) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    static_assert(OutputViewType::Rank == 3, "Weight view assumed to be rank 3");
+
+    const double (&basis)[numGauss1D_][nodes1D_] = shifted ? shiftBasis1D_ : gaussBasis1D_;
+    const double (&deriv)[numGauss1D_][nodes1D_] = shifted ? shiftDeriv1D_ : gaussDeriv1D_;
+    const GradWeightType& refGrad = shifted ? shiftedReferenceGradWeights_ : referenceGradWeights_;
+
+    tensor_jacobians(
+      basis, deriv, basis, deriv, basis, deriv,
+      coords,
+      [&](int c, int b, int a, const ftype (&jac)[3][3]) {
+        grad_op_from_jacobian(scv_ip(a, b, c), jac, refGrad, gradop);
+      });
+  }
+
 
 private:
 
   int ipNodeMap_   [numIntPoints_];
   double ipWeight_ [numIntPoints_];
 
+  // ip of the tensor-product point (s_a, t_b, u_c), see set_interior_info
+  static KOKKOS_INLINE_FUNCTION int scv_ip(int a, int b, int c)
+  {
+    const int subcv = ((c / numQuad_) * nodes1D_ + b / numQuad_) * nodes1D_ + a / numQuad_;
+    const int quad = ((c % numQuad_) * numQuad_ + b % numQuad_) * numQuad_ + a % numQuad_;
+    return subcv * numQuad_ * numQuad_ * numQuad_ + quad;
+  }
+
   KOKKOS_FUNCTION void set_interior_info();
 
   double jacobian_determinant(
@@ -488,10 +659,80 @@ public:
     }
   }
 
+  //! `weighted_area_vectors` with sum-factorized Jacobians
+  template <typename CoordViewType, typename OutputViewType>
+  KOKKOS_FUNCTION void tensor_weighted_area_vectors(const CoordViewType& coords, OutputViewType& areav) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    static_assert(OutputViewType::Rank == 2, "area_vector view assumed to be 2D");
+
+    for_each_scs_jacobian(false, coords,
+      [&](int ip, int direction, const ftype (&jac)[3][3]) {
+        const int s1 = (direction == Jacobian::T_DIRECTION) ? Jacobian::S_DIRECTION : Jacobian::T_DIRECTION;
+        const int s2 = (direction == Jacobian::U_DIRECTION) ? Jacobian::S_DIRECTION : Jacobian::U_DIRECTION;
+        const double weight = ipInfo_[ip].weight;
+        areav(ip, 0) = weight * (jac[1][s1] * jac[2][s2] - jac[2][s1] * jac[1][s2]);
+        areav(ip, 1) = weight * (jac[2][s1] * jac[0][s2] - jac[0][s1] * jac[2][s2]);
+        areav(ip, 2) = weight * (jac[0][s1] * jac[1][s2] - jac[1][s1] * jac[0][s2]);
+      });
+  }
+
+  //! `generic_grad_op` with sum-factorized Jacobians
+  template <typename CoordViewType, typename OutputViewType>
+  KOKKOS_FUNCTION void tensor_grad_op(bool shifted, const CoordViewType& coords, OutputViewType& gradop) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    static_assert(OutputViewType::Rank == 3, "Weight view assumed to be rank 3");
+
+    const GradWeightType& refGrad = shifted ? shiftedReferenceGradWeights_ : referenceGradWeights_;
+    for_each_scs_jacobian(shifted, coords,
+      [&](int ip, int /* direction */, const ftype (&jac)[3][3]) {
+        grad_op_from_jacobian(ip, jac, refGrad, gradop);
+      });
+  }
+
 protected:
   ContourData ipInfo_[numIntPoints_];
 
 private:
+  // ip of the point on surface m whose tangential 1D points are first and
+  // second, for the direction ordinal in the U->T->S order of set_interior_info
+  static KOKKOS_INLINE_FUNCTION int scs_ip(int directionOrdinal, int m, int first, int second)
+  {
+    const int subface = (m * nodes1D_ + second / numQuad_) * nodes1D_ + first / numQuad_;
+    const int quad = (second % numQuad_) * numQuad_ + first % numQuad_;
+    return directionOrdinal * ipsPerDirection_ + subface * numQuad_ * numQuad_ + quad;
+  }
+
+  //! Jacobians at all scs ips, surface direction by surface direction
+  template <typename CoordViewType, typename Func>
+  KOKKOS_FUNCTION void for_each_scs_jacobian(bool shifted, const CoordViewType& coords, Func&& f) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    const double (&basis)[numGauss1D_][nodes1D_] = shifted ? shiftBasis1D_ : gaussBasis1D_;
+    const double (&deriv)[numGauss1D_][nodes1D_] = shifted ? shiftDeriv1D_ : gaussDeriv1D_;
+
+    // constant u surfaces, tangential s and t
+    tensor_jacobians(
+      basis, deriv, basis, deriv, scsBasis1D_, scsDeriv1D_, coords,
+      [&](int c, int b, int a, const ftype (&jac)[3][3]) {
+        f(scs_ip(0, c, a, b), Jacobian::U_DIRECTION, jac);
+      });
+
+    // constant t surfaces, tangential s and u
+    tensor_jacobians(
+      basis, deriv, scsBasis1D_, scsDeriv1D_, basis, deriv, coords,
+      [&](int c, int b, int a, const ftype (&jac)[3][3]) {
+        f(scs_ip(1, b, a, c), Jacobian::T_DIRECTION, jac);
+      });
+
+    // constant s surfaces, tangential t and u
+    tensor_jacobians(
+      scsBasis1D_, scsDeriv1D_, basis, deriv, basis, deriv, coords,
+      [&](int c, int b, int a, const ftype (&jac)[3][3]) {
+        f(scs_ip(2, a, b, c), Jacobian::S_DIRECTION, jac);
+      });
+  }
 
   int lrscv_[2*numIntPoints_];
   int oppFace_  [numFaceIps_];
@@ -582,7 +823,7 @@ KOKKOS_FUNCTION void Hex27SCS::grad_op(
   ViewTypeGrad&  gradop,
   ViewTypeGrad&  deriv)
 {
-  generic_grad_op<AlgTraits>(referenceGradWeights_, coords, gradop);
+  tensor_grad_op(false, coords, gradop);
 
   // copy derivs as well.  These aren't used, but are part of the interface
   for (int ip = 0; ip < AlgTraits::numScsIp_; ++ip) {
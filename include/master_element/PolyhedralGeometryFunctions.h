@@ -0,0 +1,154 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PolyhedralGeometryFunctions_h
+#define PolyhedralGeometryFunctions_h
+
+#include <Kokkos_Core.hpp>
+
+namespace sierra {
+namespace nalu {
+
+/** Volume of a polyhedron bounded by triangular facets
+ *
+ *  Uses the Gauss divergence theorem with the facet centroids; the facets of
+ *  triangleFaceTable are numbered from zero and oriented with outward
+ *  normals. C++ replacement of the Fortran polyhedralVolumeByFaces.
+ */
+template <typename RealType>
+KOKKOS_INLINE_FUNCTION RealType
+polyhedral_volume_by_faces(
+  int /* ncoords */,
+  const RealType volcoords[][3],
+  int ntriangles,
+  const int triangleFaceTable[][3])
+{
+  RealType xface[3];
+
+  RealType volume = 0.0;
+
+  // loop over each triangular facet
+  for (int itriangle = 0; itriangle < ntriangles; ++itriangle) {
+    const int ip = triangleFaceTable[itriangle][0];
+    const int iq = triangleFaceTable[itriangle][1];
+    const int ir = triangleFaceTable[itriangle][2];
+    // set spatial coordinate of integration point
+    for (int k = 0; k < 3; ++k) {
+      xface[k] = volcoords[ip][k] + volcoords[iq][k] + volcoords[ir][k];
+    }
+    // calculate contribution of triangular face to volume
+    volume = volume +
+             xface[0] * ((volcoords[iq][1] - volcoords[ip][1]) *
+                           (volcoords[ir][2] - volcoords[ip][2]) -
+                         (volcoords[ir][1] - volcoords[ip][1]) *
+                           (volcoords[iq][2] - volcoords[ip][2])) -
+             xface[1] * ((volcoords[iq][0] - volcoords[ip][0]) *
+                           (volcoords[ir][2] - volcoords[ip][2]) -
+                         (volcoords[ir][0] - volcoords[ip][0]) *
+                           (volcoords[iq][2] - volcoords[ip][2])) +
+             xface[2] * ((volcoords[iq][0] - volcoords[ip][0]) *
+                           (volcoords[ir][1] - volcoords[ip][1]) -
+                         (volcoords[ir][0] - volcoords[ip][0]) *
+                           (volcoords[iq][1] - volcoords[ip][1]));
+  }
+
+  // apply constants that were factored out for calculation of
+  // the integration point, the area, and the gauss divergence
+  // theorem.
+  volume = volume / 18.0;
+  return volume;
+}
+
+/** Sum of the area vectors of a surface made of triangular facets
+ *
+ *  Exact for bilinear faces when the facets follow the right hand rule.
+ *  C++ replacement of the Fortran polyhedralAreaByFaces, with zero based
+ *  entries in triangleFaceTable.
+ */
+template <typename RealType>
+KOKKOS_INLINE_FUNCTION void
+polyhedral_area_by_faces(
+  int /* ncoords */,
+  const RealType areacoords[][3],
+  int ntriangles,
+  const int triangleFaceTable[][3],
+  RealType area[3])
+{
+  RealType r1[3];
+  RealType r2[3];
+
+  for (int k = 0; k < 3; ++k) {
+    area[k] = 0.0;
+  }
+
+  for (int itriangle = 0; itriangle < ntriangles; ++itriangle) {
+    const int ip = triangleFaceTable[itriangle][0];
+    const int iq = triangleFaceTable[itriangle][1];
+    const int ir = triangleFaceTable[itriangle][2];
+    // construct vectors with common beginning point
+    for (int k = 0; k < 3; ++k) {
+      r1[k] = areacoords[iq][k] - areacoords[ip][k];
+      r2[k] = areacoords[ir][k] - areacoords[ip][k];
+    }
+    // cross product is twice the area vector
+    area[0] += r1[1] * r2[2] - r2[1] * r1[2];
+    area[1] += r1[2] * r2[0] - r2[2] * r1[0];
+    area[2] += r1[0] * r2[1] - r2[0] * r1[1];
+  }
+
+  // apply the 1/2 that was pulled out
+  for (int k = 0; k < 3; ++k) {
+    area[k] = 0.5 * area[k];
+  }
+}
+
+/** Volume of the octohedral sub-control volume at the tip of a pyramid
+ *
+ *  The four non-planar faces are split at their midpoints so the
+ *  equivalent polyhedron has 24 triangular facets. C++ replacement of the
+ *  Fortran octohedronVolumeByTriangleFacets.
+ */
+template <typename RealType>
+KOKKOS_INLINE_FUNCTION RealType
+octohedron_volume_by_triangle_facets(const RealType volcoords[10][3])
+{
+  RealType coords[14][3];
+  const int triangularFacetTable[24][3] = {
+    {1, 3, 10}, {2, 10, 3}, {2, 9, 10}, {10, 9, 1}, {4, 3, 11}, {3, 1, 11},
+    {11, 1, 5}, {4, 11, 5}, {1, 12, 5}, {1, 7, 12}, {12, 7, 6}, {5, 12, 6},
+    {9, 8, 13}, {13, 8, 7}, {13, 7, 1}, {9, 13, 1}, {4, 5, 0},  {5, 6, 0},
+    {6, 7, 0},  {7, 8, 0},  {0, 8, 9},  {0, 9, 2},  {0, 2, 3},  {0, 3, 4}};
+
+  // the first ten coordinates are the vertices of the octohedron
+  for (int j = 0; j < 10; ++j) {
+    for (int k = 0; k < 3; ++k) {
+      coords[j][k] = volcoords[j][k];
+    }
+  }
+  // we now add face midpoints only for the four faces that are
+  // not planar
+  for (int k = 0; k < 3; ++k) {
+    coords[10][k] = 0.50 * (volcoords[3][k] + volcoords[9][k]);
+    coords[11][k] = 0.50 * (volcoords[3][k] + volcoords[5][k]);
+    coords[12][k] = 0.50 * (volcoords[5][k] + volcoords[7][k]);
+    coords[13][k] = 0.50 * (volcoords[7][k] + volcoords[9][k]);
+  }
+
+  const int ncoords = 14;
+  const int ntriangles = 24;
+
+  // compute the volume using the new equivalent polyhedron
+  return polyhedral_volume_by_faces<RealType>(
+    ncoords, coords, ntriangles, triangularFacetTable);
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
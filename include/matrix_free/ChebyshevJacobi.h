@@ -0,0 +1,102 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef CHEBYSHEV_JACOBI_H
+#define CHEBYSHEV_JACOBI_H
+
+#include <Teuchos_RCP.hpp>
+#include <Tpetra_Map.hpp>
+#include <Tpetra_MultiVector.hpp>
+#include <Tpetra_Operator.hpp>
+
+namespace Teuchos {
+class ParameterList;
+}
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+struct ChebyshevParameters
+{
+  ChebyshevParameters() = default;
+  explicit ChebyshevParameters(const Teuchos::ParameterList& params);
+
+  int degree{3};
+  double eigenvalue_ratio{30};
+  int power_iterations{10};
+  double boost_factor{1.1};
+};
+
+//! true if the solver parameters select the Chebyshev smoother
+bool use_chebyshev_preconditioner(const Teuchos::ParameterList& params);
+
+/** Chebyshev accelerated Jacobi preconditioner on a matrix-free operator
+ *
+ *  Uses the inverse diagonal computed by one of the Jacobi operators. The
+ *  largest eigenvalue of D^{-1}A is estimated with a few power iterations
+ *  when the preconditioner is computed; the smoother application itself is
+ *  a fixed degree polynomial of operator applies and vector updates without
+ *  any global reductions.
+ */
+class ChebyshevJacobiOperator final : public Tpetra::Operator<>
+{
+public:
+  using mv_type = Tpetra::MultiVector<>;
+  using map_type = Tpetra::Map<>;
+  using base_operator_type = Tpetra::Operator<>;
+
+  ChebyshevJacobiOperator(
+    Teuchos::RCP<const map_type> owned_map,
+    int num_vectors,
+    ChebyshevParameters params = {});
+
+  void apply(
+    const mv_type& ownedSolution,
+    mv_type& ownedRHS,
+    Teuchos::ETransp trans = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  void set_linear_operator(Teuchos::RCP<const base_operator_type> op_in)
+  {
+    op_ = op_in;
+  }
+
+  // only the first column of the inverse diagonal is used for all vectors
+  void set_inverse_diagonal(const mv_type& inv_diag) { inv_diag_ = &inv_diag; }
+
+  //! power iteration estimate of the largest eigenvalue of D^{-1}A
+  void estimate_eigenvalues();
+  double max_eigenvalue() const { return lambda_max_; }
+  double min_eigenvalue() const
+  {
+    return lambda_max_ / params_.eigenvalue_ratio;
+  }
+
+  Teuchos::RCP<const map_type> getDomainMap() const final { return map_; }
+  Teuchos::RCP<const map_type> getRangeMap() const final { return map_; }
+
+private:
+  const Teuchos::RCP<const map_type> map_;
+  const ChebyshevParameters params_;
+  double lambda_max_{1};
+
+  Teuchos::RCP<const base_operator_type> op_;
+  const mv_type* inv_diag_{nullptr};
+
+  mutable mv_type residual_;
+  mutable mv_type direction_;
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -40,11 +40,21 @@ struct BCFluxFields
   face_vector_view<p> exposed_areas;
 };
 
+template <int p>
+struct BCConvectionFields
+{
+  face_scalar_view<p> htc;
+  face_scalar_view<p> qref;
+  face_scalar_view<p> qp1;
+  face_vector_view<p> exposed_areas;
+};
+
 template <int p>
 struct BCFields
 {
   BCDirichletFields dirichlet_fields;
   BCFluxFields<p> flux_fields;
+  BCConvectionFields<p> convection_fields;
 };
 
 template <int p>
@@ -33,10 +33,14 @@ public:
     stk::mesh::BulkData&,
     stk::mesh::Selector,
     stk::mesh::Selector = {},
+    stk::mesh::Selector = {},
     stk::mesh::Selector = {});
 
   void gather_all();
   void update_solution_fields();
+  // specified values, heat fluxes and convection coefficients may be changed
+  // in between time steps, e.g. by a conjugate heat transfer coupling
+  void update_boundary_data();
   void swap_states();
 
   InteriorResidualFields<p> get_residual_fields() { return fields; }
@@ -46,6 +50,7 @@ public:
     return coefficient_fields;
   }
   BCFluxFields<p> get_flux_fields() { return flux_fields; }
+  BCConvectionFields<p> get_convection_fields() { return convection_fields; }
 
 private:
   stk::mesh::BulkData& bulk;
@@ -63,6 +68,10 @@ private:
   const stk::mesh::Selector flux;
   const const_face_mesh_index_view<p> flux_faces;
   BCFluxFields<p> flux_fields;
+
+  const stk::mesh::Selector convection;
+  const const_face_mesh_index_view<p> convection_faces;
+  BCConvectionFields<p> convection_fields;
 };
 
 } // namespace matrix_free
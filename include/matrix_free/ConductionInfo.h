@@ -36,6 +36,8 @@ struct conduction_info
   static constexpr auto gid_name = linsys_info::gid_name;
   static constexpr auto qbc_name = "temperature_bc";
   static constexpr auto flux_name = "heat_flux_bc";
+  static constexpr auto htc_name = "heat_transfer_coefficient";
+  static constexpr auto qref_name = "reference_temperature";
 };
 
 } // namespace matrix_free
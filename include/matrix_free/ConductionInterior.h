@@ -56,6 +56,28 @@ struct conduction_linearized_residual_t
     const_scs_vector_view<p> diffusion_metric,
     ra_tpetra_view_type delta_owned,
     tpetra_view_type rhs);
+
+  //! Apply only the element groups listed in `elems`
+  static void invoke(
+    const_entity_row_view_type elems,
+    double gamma,
+    const_elem_offset_view<p> offsets,
+    const_scalar_view<p> volume_metric,
+    const_scs_vector_view<p> diffusion_metric,
+    ra_tpetra_view_type delta_owned,
+    tpetra_view_type rhs);
+
+  // public for the device lambda; elem_index maps [0, num_elems) to groups
+  template <typename ElemIndex>
+  static void apply(
+    int num_elems,
+    ElemIndex elem_index,
+    double gamma,
+    const_elem_offset_view<p> offsets,
+    const_scalar_view<p> volume_metric,
+    const_scs_vector_view<p> diffusion_metric,
+    ra_tpetra_view_type delta_owned,
+    tpetra_view_type rhs);
 };
 } // namespace impl
 P_INVOKEABLE(conduction_linearized_residual)
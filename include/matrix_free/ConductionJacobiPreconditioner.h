@@ -48,6 +48,17 @@ public:
     dirichlet_bc_offsets_ = dirichlet_offsets_in;
   }
 
+  void set_convection_faces(
+    const_face_offset_view<p> face_offsets_in,
+    face_scalar_view<p> htc_in,
+    face_vector_view<p> areas_in)
+  {
+    convection_bc_active_ = face_offsets_in.extent_int(0) > 0;
+    convection_bc_offsets_ = face_offsets_in;
+    convection_htc_ = htc_in;
+    convection_areas_ = areas_in;
+  }
+
   void set_coefficients(double gamma_in, LinearizedResidualFields<p> fields_in)
   {
     gamma_ = gamma_in;
@@ -77,6 +88,12 @@ private:
 
   bool dirichlet_bc_active_{false};
   const_node_offset_view dirichlet_bc_offsets_;
+
+  bool convection_bc_active_{false};
+  const_face_offset_view<p> convection_bc_offsets_;
+  const_face_scalar_view<p> convection_htc_;
+  const_face_vector_view<p> convection_areas_;
+
   LinearizedResidualFields<p> fields_;
   double gamma_{+1};
 
@@ -20,6 +20,7 @@
 #include "Tpetra_MultiVector.hpp"
 #include "Tpetra_Operator.hpp"
 #include "matrix_free/ConductionFields.h"
+#include "matrix_free/StkToTpetraComm.h"
 
 namespace sierra {
 namespace nalu {
@@ -74,6 +75,15 @@ public:
     flux_ = flux_in;
   }
 
+  void set_convection_fields(
+    const_face_offset_view<p> face_offsets_in,
+    BCConvectionFields<p> convection_fields_in)
+  {
+    convection_bc_active_ = face_offsets_in.extent_int(0) > 0;
+    convection_bc_offsets_ = face_offsets_in;
+    convection_fields_ = convection_fields_in;
+  }
+
 private:
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
@@ -91,6 +101,10 @@ private:
   const_face_offset_view<p> flux_bc_offsets_;
   const_face_vector_view<p> exposed_areas_;
   const_face_scalar_view<p> flux_;
+
+  bool convection_bc_active_{false};
+  const_face_offset_view<p> convection_bc_offsets_;
+  BCConvectionFields<p> convection_fields_;
 };
 
 template <int p>
@@ -127,6 +141,17 @@ public:
     dirichlet_bc_offsets_ = dirichlet_offsets;
   }
 
+  void set_convection_faces(
+    const_face_offset_view<p> face_offsets_in,
+    face_scalar_view<p> htc_in,
+    face_vector_view<p> areas_in)
+  {
+    convection_bc_active_ = face_offsets_in.extent_int(0) > 0;
+    convection_bc_offsets_ = face_offsets_in;
+    convection_htc_ = htc_in;
+    convection_areas_ = areas_in;
+  }
+
   Teuchos::RCP<const map_type> getDomainMap() const final
   {
     return exporter_.getTargetMap();
@@ -139,10 +164,16 @@ public:
 private:
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
+  const owned_shared_elements elements_;
 
   bool dirichlet_bc_active_{false};
   const_node_offset_view dirichlet_bc_offsets_;
 
+  bool convection_bc_active_{false};
+  const_face_offset_view<p> convection_bc_offsets_;
+  const_face_scalar_view<p> convection_htc_;
+  const_face_vector_view<p> convection_areas_;
+
   LinearizedResidualFields<p> fields_;
   double gamma_{+1};
 
@@ -10,15 +10,20 @@
 #ifndef CONDUCTION_SOLUTION_UPDATE_H
 #define CONDUCTION_SOLUTION_UPDATE_H
 
+#include "matrix_free/ChebyshevJacobi.h"
 #include "matrix_free/ConductionJacobiPreconditioner.h"
 #include "matrix_free/ConductionOperator.h"
 #include "matrix_free/KokkosViewTypes.h"
 #include "matrix_free/MatrixFreeSolver.h"
+#include "matrix_free/PMultigridPreconditioner.h"
 
 #include "Kokkos_Array.hpp"
 #include "Kokkos_View.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Tpetra_CrsMatrix_fwd.hpp"
 #include "Tpetra_Export.hpp"
 #include "Tpetra_Map.hpp"
+#include "Tpetra_Operator.hpp"
 
 #include "stk_mesh/base/Ngp.hpp"
 #include "stk_mesh/base/Selector.hpp"
@@ -35,6 +40,8 @@ struct BCDirichletFields;
 template <int p>
 struct BCFluxFields;
 template <int p>
+struct BCConvectionFields;
+template <int p>
 struct InteriorResidualFields;
 template <int p>
 struct LinearizedResidualFields;
@@ -49,11 +56,13 @@ struct ConductionOffsetViews
     Kokkos::View<const typename Tpetra::Map<>::local_ordinal_type*> elid,
     const stk::mesh::Selector& active,
     stk::mesh::Selector dirichlet = {},
-    stk::mesh::Selector flux = {});
+    stk::mesh::Selector flux = {},
+    stk::mesh::Selector convection = {});
 
   const const_elem_offset_view<p> offsets;
   const const_node_offset_view dirichlet_bc_offsets;
   const const_face_offset_view<p> flux_bc_offsets;
+  const const_face_offset_view<p> convection_bc_offsets;
 };
 
 template <int p>
@@ -71,13 +80,20 @@ public:
     Kokkos::Array<double, 3>,
     InteriorResidualFields<p>,
     BCDirichletFields = {},
-    BCFluxFields<p> = {});
+    BCFluxFields<p> = {},
+    BCConvectionFields<p> = {});
 
-  const Tpetra::MultiVector<>&
-  compute_delta(double gamma, LinearizedResidualFields<p>);
+  const Tpetra::MultiVector<>& compute_delta(
+    double gamma, LinearizedResidualFields<p>, BCConvectionFields<p> = {});
 
   const MatrixFreeSolver& solver() const { return linear_solver_; }
-  void compute_preconditioner(double gamma, LinearizedResidualFields<p>);
+  void compute_preconditioner(
+    double gamma, LinearizedResidualFields<p>, BCConvectionFields<p> = {});
+
+  // coarse level of the p-multigrid preconditioner, built from the
+  // low-order-refined matrix before compute_preconditioner is called
+  void compute_coarse_preconditioner(
+    Tpetra::CrsMatrix<>& mat, Teuchos::ParameterList& params);
 
   double residual_norm() const;
   double final_linear_norm() const;
@@ -91,6 +107,11 @@ private:
   ConductionResidualOperator<p> resid_op_;
   ConductionLinearizedResidualOperator<p> lin_op_;
   JacobiOperator<p> prec_op_;
+  const bool use_chebyshev_;
+  ChebyshevJacobiOperator cheb_op_;
+  const bool use_pmultigrid_;
+  PMultigridOperator pmg_op_;
+  Teuchos::RCP<Tpetra::Operator<>> coarse_op_;
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<> owned_and_shared_mv_;
 };
@@ -20,7 +20,9 @@
 #include "Kokkos_View.hpp"
 
 #include "Teuchos_RCP.hpp"
+#include "Tpetra_CrsMatrix_fwd.hpp"
 #include "Tpetra_Export.hpp"
+#include "Tpetra_Map.hpp"
 #include "Tpetra_MultiVector_fwd.hpp"
 
 #include "stk_mesh/base/Selector.hpp"
@@ -51,16 +53,33 @@ public:
     stk::mesh::Selector active,
     stk::mesh::Selector dirichlet,
     stk::mesh::Selector flux,
+    stk::mesh::Selector convection = {},
     stk::mesh::Selector replicas = {},
     Kokkos::View<gid_type*> rgids = {});
 
+  ConductionUpdate(
+    stk::mesh::BulkData&,
+    Teuchos::ParameterList,
+    stk::mesh::Selector active,
+    stk::mesh::Selector dirichlet,
+    stk::mesh::Selector flux,
+    stk::mesh::Selector convection,
+    const Tpetra::Map<>& owned,
+    const Tpetra::Map<>& owned_and_shared,
+    Kokkos::View<const lid_type*> elids);
+
   void initialize() final;
   void swap_states() final;
   void predict_state() final;
   void compute_preconditioner(double projected_dt) final;
+  void create_coarse_preconditioner(
+    const stk::mesh::NgpField<double>& coords,
+    Tpetra::CrsMatrix<>& mat,
+    std::string xmlname) final;
   void compute_update(
     Kokkos::Array<double, 3>, stk::mesh::NgpField<double>& delta) final;
   void update_solution_fields() final;
+  void update_boundary_data() final;
   double provide_norm() const final { return residual_norm_; };
   double provide_scaled_norm() const final { return scaled_residual_norm_; }
   void banner(std::string name, std::ostream& stream) const final;
@@ -77,6 +96,8 @@ private:
   ConductionSolutionUpdate<p> field_update_;
   ConductionGatheredFieldManager<p> field_gather_;
 
+  Teuchos::ParameterList muelu_params_{};
+
   double initial_residual_{-1};
   double residual_norm_{0};
   double scaled_residual_norm_{0};
@@ -51,6 +51,24 @@ struct continuity_linearized_residual_t
     const_scs_vector_view<p> metric,
     ra_tpetra_view_type xin,
     tpetra_view_type yout);
+
+  //! Apply only the element groups listed in `elems`
+  static void invoke(
+    const_entity_row_view_type elems,
+    const_elem_offset_view<p> offsets,
+    const_scs_vector_view<p> metric,
+    ra_tpetra_view_type xin,
+    tpetra_view_type yout);
+
+  // public for the device lambda; elem_index maps [0, num_elems) to groups
+  template <typename ElemIndex>
+  static void apply(
+    int num_elems,
+    ElemIndex elem_index,
+    const_elem_offset_view<p> offsets,
+    const_scs_vector_view<p> metric,
+    ra_tpetra_view_type xin,
+    tpetra_view_type yout);
 };
 } // namespace impl
 P_INVOKEABLE(continuity_linearized_residual)
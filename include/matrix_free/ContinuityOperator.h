@@ -11,6 +11,7 @@
 #define CONTINUITY_OPERATOR_H
 
 #include "matrix_free/KokkosViewTypes.h"
+#include "matrix_free/StkToTpetraComm.h"
 
 #include "Teuchos_BLAS_types.hpp"
 #include "Teuchos_RCP.hpp"
@@ -89,6 +90,7 @@ public:
 private:
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
+  const owned_shared_elements elements_;
 
   const_scs_vector_view<p> metric_;
 
@@ -34,9 +34,14 @@ public:
   virtual void swap_states() = 0;
   virtual void predict_state() = 0;
   virtual void compute_preconditioner(double = -1) = 0;
+  virtual void create_coarse_preconditioner(
+    const stk::mesh::NgpField<double>& coords,
+    Tpetra::CrsMatrix<>& mat,
+    std::string xmlname) = 0;
   virtual void
   compute_update(Kokkos::Array<double, 3>, stk::mesh::NgpField<double>&) = 0;
   virtual void update_solution_fields() = 0;
+  virtual void update_boundary_data() = 0;
   virtual double provide_norm() const = 0;
   virtual double provide_scaled_norm() const = 0;
   virtual void banner(std::string, std::ostream&) const = 0;
@@ -86,6 +91,7 @@ public:
   virtual void gather_velocity() = 0;
   virtual void gather_pressure() = 0;
   virtual void gather_grad_p() = 0;
+  virtual void gather_body_force() = 0;
   virtual void update_transport_coefficients(GradTurbModel update) = 0;
   virtual void update_advection_metric(double dt) = 0;
 
@@ -10,6 +10,7 @@
 #ifndef GRADIENT_SOLUTION_UPDATE_H
 #define GRADIENT_SOLUTION_UPDATE_H
 
+#include "matrix_free/ChebyshevJacobi.h"
 #include "matrix_free/FilterJacobi.h"
 #include "matrix_free/GreenGaussGradientOperator.h"
 #include "matrix_free/KokkosViewTypes.h"
@@ -59,6 +60,8 @@ private:
   GradientResidualOperator<p> resid_op_;
   GradientLinearizedResidualOperator<p> lin_op_;
   FilterJacobiOperator<p> prec_op_;
+  const bool use_chebyshev_;
+  ChebyshevJacobiOperator cheb_op_;
 
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<double> owned_and_shared_mv_;
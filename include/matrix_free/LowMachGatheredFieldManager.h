@@ -44,6 +44,7 @@ public:
   void update_pressure();
   void update_velocity();
   void update_grad_p();
+  void update_body_force();
   void update_transport_coefficients(GradTurbModel model);
 
 private:
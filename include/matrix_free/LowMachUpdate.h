@@ -98,6 +98,7 @@ public:
   void gather_velocity();
   void gather_pressure();
   void gather_grad_p();
+  void gather_body_force();
   void update_transport_coefficients(GradTurbModel model);
   void update_advection_metric(double dt);
 
@@ -67,6 +67,30 @@ struct momentum_linearized_residual_t
     const_scs_vector_view<p> diff,
     ra_tpetra_view_type xin,
     tpetra_view_type yout);
+
+  //! Apply only the element groups listed in `elems`
+  static void invoke(
+    const_entity_row_view_type elems,
+    double proj_time_scale,
+    const_elem_offset_view<p> offsets,
+    const_scalar_view<p> vp1,
+    const_scs_scalar_view<p> mdot,
+    const_scs_vector_view<p> diff,
+    ra_tpetra_view_type xin,
+    tpetra_view_type yout);
+
+  // public for the device lambda; elem_index maps [0, num_elems) to groups
+  template <typename ElemIndex>
+  static void apply(
+    int num_elems,
+    ElemIndex elem_index,
+    double proj_time_scale,
+    const_elem_offset_view<p> offsets,
+    const_scalar_view<p> vp1,
+    const_scs_scalar_view<p> mdot,
+    const_scs_vector_view<p> diff,
+    ra_tpetra_view_type xin,
+    tpetra_view_type yout);
 };
 } // namespace impl
 P_INVOKEABLE(momentum_linearized_residual)
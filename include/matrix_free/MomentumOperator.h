@@ -12,6 +12,7 @@
 
 #include "matrix_free/KokkosViewTypes.h"
 #include "matrix_free/LinSysInfo.h"
+#include "matrix_free/StkToTpetraComm.h"
 
 #include "Kokkos_Array.hpp"
 #include "Teuchos_BLAS_types.hpp"
@@ -25,6 +26,10 @@
 
 #include "stk_util/util/ReportHandler.hpp"
 
+namespace Teuchos {
+class ParameterList;
+}
+
 namespace sierra {
 namespace nalu {
 namespace matrix_free {
@@ -124,6 +129,7 @@ private:
   const const_elem_offset_view<p> elem_offsets_;
   const export_type& exporter_;
   const int max_owned_row_id_;
+  const owned_shared_elements elements_;
 
   double gamma_0_{-1};
   LowMachLinearizedResidualFields<p> fields_;
@@ -135,6 +141,91 @@ private:
   mutable mv_type cached_rhs_;
 };
 
+bool use_jacobian_free_momentum(const Teuchos::ParameterList& params);
+double jacobian_free_perturbation(const Teuchos::ParameterList& params);
+
+/** Finite difference Jacobian-vector products of the momentum residual
+ *
+ *  Jv = -(R(u + eps v) - R(u)) / eps, where the residual re-evaluates the
+ *  mass flux of the perturbed velocity with the current pressure, so that
+ *  the linearization includes the dependence of the advection on the
+ *  velocity that the linearized operator lags. Dirichlet rows are the
+ *  identity, as for the linearized operator.
+ */
+template <int p>
+class MomentumJacobianFreeOperator final : public Tpetra::Operator<>
+{
+public:
+  static constexpr int num_vectors = 3;
+  using mv_type = Tpetra::MultiVector<>;
+  using map_type = Tpetra::Map<>;
+  using base_operator_type = Tpetra::Operator<>;
+  using export_type = Tpetra::Export<>;
+
+  MomentumJacobianFreeOperator(
+    const_elem_offset_view<p> elem_offsets_in,
+    const export_type& exporter,
+    double perturbation = 1.0e-7);
+
+  void apply(
+    const mv_type& sln,
+    mv_type& rhs,
+    Teuchos::ETransp trans = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  Teuchos::RCP<const map_type> getDomainMap() const final
+  {
+    return exporter_.getTargetMap();
+  }
+  Teuchos::RCP<const map_type> getRangeMap() const final
+  {
+    return exporter_.getTargetMap();
+  }
+
+  // mdot_scaling <= 0 keeps the mass flux of the fields frozen
+  void set_fields(
+    Kokkos::Array<double, 3> gammas,
+    LowMachResidualFields<p> fields,
+    double mdot_scaling);
+
+  // mass flux consistent with the velocity of the last set_fields
+  scs_scalar_view<p> advection_metric() const { return mdot_; }
+
+  void set_dirichlet_nodes(const_node_offset_view dirichlet_offsets_in)
+  {
+    dirichlet_bc_active_ = dirichlet_offsets_in.extent_int(0) > 0;
+    dirichlet_bc_offsets_ = dirichlet_offsets_in;
+  }
+
+private:
+  void local_residual(
+    vector_view<p> up1, scs_scalar_view<p> mdot, tpetra_view_type rhs) const;
+  void local_apply(
+    double eps, ra_tpetra_view_type xin, tpetra_view_type yout) const;
+
+  const const_elem_offset_view<p> elem_offsets_;
+  const export_type& exporter_;
+  const int max_owned_row_id_;
+  const double perturbation_;
+
+  Kokkos::Array<double, 3> gammas_;
+  LowMachResidualFields<p> fields_;
+  double mdot_scaling_{-1};
+  double velocity_scale_{0};
+
+  scs_scalar_view<p> mdot_;
+  vector_view<p> perturbed_up1_;
+  scs_scalar_view<p> perturbed_mdot_;
+
+  bool dirichlet_bc_active_{false};
+  const_node_offset_view dirichlet_bc_offsets_;
+
+  mv_type base_rhs_;
+  mutable mv_type cached_sln_;
+  mutable mv_type cached_rhs_;
+};
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
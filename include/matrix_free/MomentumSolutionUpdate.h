@@ -12,6 +12,7 @@
 
 #include "matrix_free/KokkosViewTypes.h"
 #include "matrix_free/MatrixFreeSolver.h"
+#include "matrix_free/ChebyshevJacobi.h"
 #include "matrix_free/MomentumJacobi.h"
 #include "matrix_free/MomentumOperator.h"
 
@@ -61,6 +62,12 @@ public:
   void compute_preconditioner(double, LowMachLinearizedResidualFields<p>);
   const MatrixFreeSolver& solver() const { return linear_solver_; }
 
+  // time scale of the mass flux, re-evaluated by the Jacobian-free operator
+  void set_advection_metric_scaling(double scaling)
+  {
+    advection_metric_scaling_ = scaling;
+  }
+
   double residual_norm() const;
   double final_linear_norm() const;
   int num_iterations() const;
@@ -74,6 +81,11 @@ private:
   MomentumResidualOperator<p> resid_op_;
   MomentumLinearizedResidualOperator<p> lin_op_;
   MomentumJacobiOperator<p> prec_op_;
+  const bool use_chebyshev_;
+  ChebyshevJacobiOperator cheb_op_;
+  const bool use_jacobian_free_;
+  MomentumJacobianFreeOperator<p> jf_op_;
+  double advection_metric_scaling_{-1};
 
   MatrixFreeSolver linear_solver_;
   mutable Tpetra::MultiVector<> owned_and_shared_mv_;
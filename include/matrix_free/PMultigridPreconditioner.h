@@ -0,0 +1,88 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PMULTIGRID_PRECONDITIONER_H
+#define PMULTIGRID_PRECONDITIONER_H
+
+#include <Teuchos_RCP.hpp>
+#include <Tpetra_Map.hpp>
+#include <Tpetra_MultiVector.hpp>
+#include <Tpetra_Operator.hpp>
+
+namespace Teuchos {
+class ParameterList;
+}
+
+namespace sierra {
+namespace nalu {
+namespace matrix_free {
+
+//! true if the solver parameters select the p-multigrid preconditioner
+bool use_pmultigrid_preconditioner(const Teuchos::ParameterList& params);
+
+/** Two-level p-multigrid V-cycle on a matrix-free operator
+ *
+ *  The fine level is the high-order matrix-free operator smoothed with a
+ *  polynomial smoother.  The coarse level is the low-order-refined operator
+ *  assembled on the same nodes, so restriction and prolongation are the
+ *  identity and the coarse correction is a single apply of the coarse
+ *  solver, e.g. an algebraic multigrid cycle.
+ */
+class PMultigridOperator final : public Tpetra::Operator<>
+{
+public:
+  using mv_type = Tpetra::MultiVector<>;
+  using map_type = Tpetra::Map<>;
+  using base_operator_type = Tpetra::Operator<>;
+
+  PMultigridOperator(Teuchos::RCP<const map_type> owned_map, int num_vectors);
+
+  void apply(
+    const mv_type& ownedSolution,
+    mv_type& ownedRHS,
+    Teuchos::ETransp trans = Teuchos::NO_TRANS,
+    double alpha = 1.0,
+    double beta = 0.0) const final;
+
+  void set_fine_operator(Teuchos::RCP<const base_operator_type> op_in)
+  {
+    fine_op_ = op_in;
+  }
+  void set_smoother(Teuchos::RCP<const base_operator_type> op_in)
+  {
+    smoother_ = op_in;
+  }
+  void set_coarse_operator(Teuchos::RCP<const base_operator_type> op_in)
+  {
+    coarse_op_ = op_in;
+  }
+
+  Teuchos::RCP<const map_type> getDomainMap() const final { return map_; }
+  Teuchos::RCP<const map_type> getRangeMap() const final { return map_; }
+
+private:
+  void
+  residual_correction(const mv_type& b, const base_operator_type& op, mv_type& x)
+    const;
+
+  const Teuchos::RCP<const map_type> map_;
+
+  Teuchos::RCP<const base_operator_type> fine_op_;
+  Teuchos::RCP<const base_operator_type> smoother_;
+  Teuchos::RCP<const base_operator_type> coarse_op_;
+
+  mutable mv_type residual_;
+  mutable mv_type correction_;
+};
+
+} // namespace matrix_free
+} // namespace nalu
+} // namespace sierra
+
+#endif
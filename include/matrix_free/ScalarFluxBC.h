@@ -21,6 +21,8 @@ namespace nalu {
 namespace matrix_free {
 
 using tpetra_view_type = typename Tpetra::MultiVector<>::dual_view_type::t_dev;
+using ra_tpetra_view_type =
+  typename Tpetra::MultiVector<>::dual_view_type::t_dev_const_randomread;
 
 namespace impl {
 template <int p>
@@ -32,8 +34,45 @@ struct scalar_neumann_residual_t
     const_face_vector_view<p> areav,
     tpetra_view_type owned_rhs);
 };
+
+// convective (Robin) condition, flux h (qref - q) through the face
+template <int p>
+struct scalar_convection_residual_t
+{
+  static void invoke(
+    const_face_offset_view<p> offsets,
+    const_face_scalar_view<p> htc,
+    const_face_scalar_view<p> qref,
+    const_face_scalar_view<p> q,
+    const_face_vector_view<p> areav,
+    tpetra_view_type owned_rhs);
+};
+
+template <int p>
+struct scalar_convection_linearized_t
+{
+  static void invoke(
+    const_face_offset_view<p> offsets,
+    const_face_scalar_view<p> htc,
+    const_face_vector_view<p> areav,
+    ra_tpetra_view_type xin,
+    tpetra_view_type yout);
+};
+
+template <int p>
+struct scalar_convection_diagonal_t
+{
+  static void invoke(
+    const_face_offset_view<p> offsets,
+    const_face_scalar_view<p> htc,
+    const_face_vector_view<p> areav,
+    tpetra_view_type yout);
+};
 } // namespace impl
 P_INVOKEABLE(scalar_neumann_residual)
+P_INVOKEABLE(scalar_convection_residual)
+P_INVOKEABLE(scalar_convection_linearized)
+P_INVOKEABLE(scalar_convection_diagonal)
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
@@ -66,6 +66,32 @@ struct assemble_sparsified_edge_laplacian_t
 P_INVOKEABLE(assemble_sparsified_edge_laplacian)
 SWITCH_INVOKEABLE(assemble_sparsified_edge_laplacian)
 
+namespace impl {
+// edge laplacian weighted by the diffusivity averaged along each edge
+// and augmented with the lumped mass of the high-order operator
+template <int p>
+struct assemble_sparsified_edge_conduction_t
+{
+  static void invoke(
+    double gamma,
+    const stk::mesh::NgpMesh& mesh,
+    const stk::mesh::Selector& active,
+    const stk::mesh::NgpField<double>& coords,
+    const stk::mesh::NgpField<double>& volume_weight,
+    const stk::mesh::NgpField<double>& diffusivity,
+    NoAuraDeviceMatrix mat);
+};
+} // namespace impl
+P_INVOKEABLE(assemble_sparsified_edge_conduction)
+SWITCH_INVOKEABLE(assemble_sparsified_edge_conduction)
+
+// replaces the owned rows of the nodes in the selector with identity rows
+// and zeros their shared rows. Must be called before the export to owned
+void dirichlet_rows_to_identity(
+  const stk::mesh::NgpMesh& mesh,
+  const stk::mesh::Selector& dirichlet,
+  NoAuraDeviceMatrix mat);
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
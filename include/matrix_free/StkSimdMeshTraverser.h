@@ -14,9 +14,17 @@
 #include <stk_mesh/base/Field.hpp>
 #include <stk_mesh/base/Selector.hpp>
 
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/FieldBase.hpp"
+#include "stk_mesh/base/MetaData.hpp"
 #include "stk_mesh/base/Types.hpp"
 #include "stk_mesh/base/NgpMesh.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
 namespace stk {
 namespace mesh {
 struct Entity;
@@ -91,6 +99,120 @@ simd_bucket_offsets(
   return simd_offset;
 }
 
+//! Spread the low 10 bits of v so that two zero bits follow each of them
+inline std::uint32_t
+spread_bits_by_three(std::uint32_t v)
+{
+  v &= 0x3ffu;
+  v = (v | (v << 16)) & 0x030000ffu;
+  v = (v | (v << 8)) & 0x0300f00fu;
+  v = (v | (v << 4)) & 0x030c30c3u;
+  v = (v | (v << 2)) & 0x09249249u;
+  return v;
+}
+
+//! 30 bit Morton code of a point quantized on 1024 cells per direction
+inline std::uint32_t
+morton_code(const double* x, const double* lo, const double* hi)
+{
+  std::uint32_t code = 0;
+  for (int d = 0; d < 3; ++d) {
+    const double len = hi[d] - lo[d];
+    const double t = (len > 0) ? (x[d] - lo[d]) / len : 0.0;
+    const auto q = static_cast<std::uint32_t>(
+      std::min(1023.0, std::max(0.0, t * 1023.0 + 0.5)));
+    code |= spread_bits_by_three(q) << d;
+  }
+  return code;
+}
+
+/** Bucket ordinals of the selected entities in Morton order of their
+ *  centroids, one bucket after the other
+ *
+ *  Entities are only reordered within their bucket, so the SIMD groups and
+ *  their number are the same as in bucket order, but the lanes of a group
+ *  are close in space and share nodes. The model coordinates do not change
+ *  with mesh motion, so every map built from the same selector agrees on the
+ *  order. Buckets without coordinates keep their order.
+ */
+inline Kokkos::View<int*, stk::mesh::NgpMesh::MeshExecSpace::memory_space>
+morton_bucket_ordinals(
+  const stk::mesh::NgpMesh& mesh,
+  stk::topology::rank_t rank,
+  stk::NgpVector<unsigned> buckets,
+  stk::NgpVector<int>& entity_offsets)
+{
+  const auto& bulk = mesh.get_bulk_on_host();
+  const auto& meta = bulk.mesh_meta_data();
+  const stk::mesh::FieldBase* coords = meta.coordinate_field();
+  const int dim = meta.spatial_dimension();
+  const auto& host_buckets = bulk.buckets(rank);
+
+  entity_offsets = stk::NgpVector<int>(buckets.size());
+  int num_entities = 0;
+  for (unsigned id = 0u; id < buckets.size(); ++id) {
+    entity_offsets[id] = num_entities;
+    num_entities += host_buckets[buckets[id]]->size();
+  }
+  entity_offsets.copy_host_to_device();
+
+  Kokkos::View<int*, stk::mesh::NgpMesh::MeshExecSpace::memory_space>
+    ordinals("morton_bucket_ordinals", num_entities);
+  auto ordinals_h = Kokkos::create_mirror_view(ordinals);
+
+  std::vector<double> centroids;
+  std::vector<std::uint32_t> codes;
+  for (unsigned id = 0u; id < buckets.size(); ++id) {
+    const auto& b = *host_buckets[buckets[id]];
+    const int len = b.size();
+    if (len == 0) {
+      continue;
+    }
+    int* perm = &ordinals_h(entity_offsets[id]);
+    std::iota(perm, perm + len, 0);
+
+    centroids.assign(3 * len, 0.0);
+    bool has_coords = (coords != nullptr);
+    for (int n = 0; n < len && has_coords; ++n) {
+      const stk::mesh::Entity ent = b[n];
+      const stk::mesh::Entity* nodes =
+        (rank == stk::topology::NODE_RANK) ? &ent : bulk.begin_nodes(ent);
+      const int num_nodes =
+        (rank == stk::topology::NODE_RANK) ? 1 : bulk.num_nodes(ent);
+      for (int k = 0; k < num_nodes && has_coords; ++k) {
+        const auto* x =
+          static_cast<const double*>(stk::mesh::field_data(*coords, nodes[k]));
+        has_coords = (x != nullptr);
+        for (int d = 0; d < dim && has_coords; ++d) {
+          centroids[3 * n + d] += x[d] / num_nodes;
+        }
+      }
+    }
+    if (!has_coords) {
+      continue;
+    }
+
+    double lo[3] = {centroids[0], centroids[1], centroids[2]};
+    double hi[3] = {centroids[0], centroids[1], centroids[2]};
+    for (int n = 1; n < len; ++n) {
+      for (int d = 0; d < 3; ++d) {
+        lo[d] = std::min(lo[d], centroids[3 * n + d]);
+        hi[d] = std::max(hi[d], centroids[3 * n + d]);
+      }
+    }
+
+    codes.resize(len);
+    for (int n = 0; n < len; ++n) {
+      codes[n] = morton_code(&centroids[3 * n], lo, hi);
+    }
+    std::stable_sort(perm, perm + len, [&](int a, int b_ord) {
+      return codes[a] < codes[b_ord];
+    });
+  }
+  Kokkos::deep_copy(ordinals, ordinals_h);
+  return ordinals;
+}
+
 } // namespace impl
 
 inline int
@@ -108,6 +230,11 @@ num_simd_elements(
   return mesh_index;
 }
 
+/** Call func for every selected entity and rem for the padded lanes
+ *
+ *  The SIMD groups of every bucket hold its entities in Morton order, see
+ *  impl::morton_bucket_ordinals.
+ */
 template <typename ValidFunc, typename RemainderFunc>
 void
 simd_traverse(
@@ -120,6 +247,9 @@ simd_traverse(
 
   auto buckets = mesh.get_bucket_ids(rank, active);
   const auto bucket_offsets = impl::simd_bucket_offsets(mesh, rank, buckets);
+  stk::NgpVector<int> entity_offsets;
+  const auto ordinals =
+    impl::morton_bucket_ordinals(mesh, rank, buckets, entity_offsets);
   Kokkos::parallel_for(
     Kokkos::TeamPolicy<stk::mesh::NgpMesh::MeshExecSpace>(
       buckets.size(), Kokkos::AUTO),
@@ -135,11 +265,15 @@ simd_traverse(
             impl::get_length_of_next_simd_group(e, bucket_len);
           const int simd_elem_index =
             bucket_offsets.device_get(team.league_rank()) + e;
+          const int first = entity_offsets.device_get(team.league_rank());
           for (int ne = 0; ne < num_simd_elems; ++ne) {
-            func(simd_elem_index, ne, b[impl::bucket_index(e, ne)]);
+            func(
+              simd_elem_index, ne,
+              b[ordinals(first + impl::bucket_index(e, ne))]);
           }
           for (int ne = num_simd_elems; ne < simd_len; ++ne) {
-            rem(simd_elem_index, ne, b[impl::bucket_index(e, 0)]);
+            rem(
+              simd_elem_index, ne, b[ordinals(first + impl::bucket_index(e, 0))]);
           }
         });
     });
@@ -10,6 +10,9 @@
 #ifndef STK_TO_TPETRA_COMM_H
 #define STK_TO_TPETRA_COMM_H
 
+#include "matrix_free/KokkosViewTypes.h"
+#include "matrix_free/PolynomialOrders.h"
+
 #include "Teuchos_RCP.hpp"
 #include "stk_mesh/base/Types.hpp"
 
@@ -25,6 +28,30 @@ namespace matrix_free {
 Teuchos::RCP<const Teuchos::Comm<int>>
 teuchos_communicator(const stk::ParallelMachine& pm);
 
+/** Element groups split by whether they touch rows that are not owned
+ *
+ *  Owned rows come first in the owned-shared Tpetra map, so an element group
+ *  whose offsets are all below the number of owned rows can be applied to an
+ *  owned vector directly, while its neighbors' data is still in flight.
+ */
+struct owned_shared_elements
+{
+  //! groups with at least one shared row
+  const_entity_row_view_type boundary;
+  //! groups with owned rows only
+  const_entity_row_view_type interior;
+};
+
+namespace impl {
+template <int p>
+struct split_owned_shared_elements_t
+{
+  static owned_shared_elements
+  invoke(const_elem_offset_view<p> offsets, int max_owned_row_lid);
+};
+} // namespace impl
+P_INVOKEABLE(split_owned_shared_elements)
+
 } // namespace matrix_free
 } // namespace nalu
 } // namespace sierra
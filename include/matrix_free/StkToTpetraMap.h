@@ -41,6 +41,13 @@ void add_tpetra_solution_vector_to_stk_field(
     delta_view,
   stk::mesh::NgpField<double>& field);
 
+void copy_stk_field_to_owned_tpetra_vector(
+  const stk::mesh::NgpMesh& mesh,
+  const stk::mesh::Selector& sel,
+  Kokkos::View<const lid_type*> elid,
+  const stk::mesh::NgpField<double>& field,
+  typename Tpetra::MultiVector<>::dual_view_type::t_dev delta_view);
+
 struct StkToTpetraMaps
 {
 public:
@@ -44,6 +44,10 @@ public:
 
   bool is_deforming(){ return isDeforming_; }
 
+  bool is_rigid(){ return isRigid_; }
+
+  bool is_affine(){ return isAffine_; }
+
 protected:
   //! Reference to the STK Mesh BulkData object
   stk::mesh::BulkData& bulk_;
@@ -57,6 +61,9 @@ protected:
    */
   std::vector<std::unique_ptr<NgpMotion>> motionKernels_;
 
+  //! Device instances of the motion kernels, refreshed in place
+  nalu_ngp::NGPInstanceView<NgpMotion> ngpMotionKernels_;
+
   /** Motion parts
    *
    *  A vector of size number of parts
@@ -74,6 +81,12 @@ protected:
   // flag to denote if mesh deformation exists
   bool isDeforming_ = false;
 
+  // flag to denote if all motions in the frame are rigid body motions
+  bool isRigid_ = false;
+
+  // flag to denote if all motions in the frame are affine
+  bool isAffine_ = false;
+
 private:
   FrameBase() = delete;
   FrameBase(const FrameBase&) = delete;
@@ -27,11 +27,41 @@ public:
 
   void update_coordinates_velocity(const double time);
 
+  /** Rigid body update of the frame
+   *
+   *  Updates the coordinates and mesh velocity and rotates the edge and
+   *  exposed area vectors, the wall function unit normals and the cached edge
+   *  length vectors by the rotation since the last update, so that the
+   *  geometry of the frame does not have to be recomputed. Only valid when
+   *  is_rigid() is true.
+   */
+  void update_rigid_body(const double time);
+
   void post_compute_geometry();
 
 private:
   FrameMoving() = delete;
   FrameMoving(const FrameMoving&) = delete;
+
+  //! Composite transformation of an affine frame, evaluated on host
+  mm::TransMatType composite_transformation(const double time);
+
+  /** Composite mesh velocity of an affine frame, evaluated on host
+   *
+   *  The velocity of every node is the matrix applied to its model
+   *  coordinates plus the last column.
+   */
+  mm::TransMatType
+  composite_velocity(const double time, const mm::TransMatType& compTransMat);
+
+  /** Update coordinates and velocity of an affine frame in one kernel
+   *
+   *  @return The composite transformation
+   */
+  mm::TransMatType update_affine_motion(const double time);
+
+  //! Composite transformation of a rigid frame at the last update
+  mm::TransMatType rigidTrans_;
 };
 
 } // nalu
@@ -23,12 +23,18 @@ public:
 
   void execute(const double);
 
+  //! Rigid body update of all frames; geometry does not need recomputing
+  void execute_rigid_body(const double);
+
   void post_compute_geometry();
 
   stk::mesh::PartVector get_partvec();
 
   bool is_deforming(){ return isDeforming_; }
 
+  //! True if every frame only undergoes rigid body motions
+  bool is_rigid();
+
 private:
   MeshMotionAlg() = delete;
   MeshMotionAlg(const MeshMotionAlg&) = delete;
@@ -86,11 +86,17 @@ private:
   void Stokes_coefficients();
   void Stokes_parameters();
 
-  KOKKOS_FUNCTION
-  double my_sinh_sin(int i, int j, const double& phase);
+  /** Amplitudes of the harmonics of the Stokes displacement and velocity
+   *
+   *  The series only depend on the node through the phase, so the amplitudes
+   *  are summed once and a node evaluates a single sine and cosine, the
+   *  higher harmonics following from the Chebyshev recurrence
+   */
+  void Stokes_harmonics();
 
+  //! Vertical damping of the mesh deformation
   KOKKOS_FUNCTION
-  double my_cosh_cos(int i, int j, const double& phase);
+  double damping(const double& z) const;
 
   const double g_{9.81};
 
@@ -141,6 +147,13 @@ private:
   double Q_{0.};
   double cs_{0.2}; // Mean Stokes drift speed
 
+  // Harmonic amplitudes of the displacement, streamwise and vertical velocity
+  static constexpr int maxHarmonics_{5};
+  int numHarmonics_{1};
+  double dispAmp_[maxHarmonics_] = {0.};
+  double uAmp_[maxHarmonics_] = {0.};
+  double wAmp_[maxHarmonics_] = {0.};
+
   // Deformation damping function
   double meshdampinglength_{1000};
   int meshdampingcoeff_{3};
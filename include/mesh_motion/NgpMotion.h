@@ -169,6 +169,21 @@ public:
 
   bool is_deforming() { return isDeforming_; }
 
+  /** Rigid body motion
+   *
+   *  The transformation is a rotation and translation independent of the
+   *  coordinates, so volumes are invariant and area vectors only rotate
+   */
+  bool is_rigid() { return isRigid_; }
+
+  /** Affine motion
+   *
+   *  The transformation is independent of the coordinates and the velocity is
+   *  an affine function of them, so a stack of such motions can be composed
+   *  once on host instead of at every node
+   */
+  bool is_affine() { return isAffine_; }
+
 protected:
   /** Centroid
    *
@@ -181,6 +196,10 @@ protected:
   double endTime_{DBL_MAX};
 
   bool isDeforming_ = false;
+
+  bool isRigid_ = false;
+
+  bool isAffine_ = false;
 };
 
 template<typename T>
@@ -195,8 +214,10 @@ public:
 
   virtual NgpMotion* create_on_device() final
   {
-    free_on_device();
-    deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    if (deviceCopy_ == nullptr)
+      deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    else
+      nalu_ngp::update<T>(deviceCopy_, *dynamic_cast<T*>(this));
     return deviceCopy_;
   }
 
@@ -108,7 +108,7 @@ private:
   unsigned bcHeatFlux_      {stk::mesh::InvalidOrdinal};
   unsigned wallHeatFlux_    {stk::mesh::InvalidOrdinal};
   unsigned specificHeat_    {stk::mesh::InvalidOrdinal};
-  unsigned exposedAreaVec_  {stk::mesh::InvalidOrdinal};
+  unsigned wallFaceGeom_    {stk::mesh::InvalidOrdinal};
   unsigned wallFricVel_     {stk::mesh::InvalidOrdinal};
   unsigned wallShearStress_ {stk::mesh::InvalidOrdinal};
   unsigned wallNormDist_    {stk::mesh::InvalidOrdinal};
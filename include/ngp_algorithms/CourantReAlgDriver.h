@@ -28,6 +28,9 @@ public:
 
   void update_max_cfl_rey(const double cfl, const double rey);
 
+  //! Reduce maxima computed by a sweep outside of this driver, in place of execute
+  void reduce_max_cfl_rey(const double cfl, const double rey);
+
 private:
   double maxCFL_;
   double maxRe_;
@@ -0,0 +1,103 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef FUSEDNODALGRADDRIVER_H
+#define FUSEDNODALGRADDRIVER_H
+
+#include "ngp_algorithms/NodalGradAlgDriver.h"
+#include "Algorithm.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Edge-based nodal gradient of several scalar fields in one edge sweep
+ *
+ *  The edge area vector and the dual volumes of the two edge nodes are read
+ *  once per edge and reused for every field.
+ */
+class FusedNodalGradEdgeAlg : public Algorithm
+{
+public:
+  //! Maximum number of fields handled by one sweep
+  static constexpr int MaxFields = 4;
+
+  FusedNodalGradEdgeAlg(
+    Realm&,
+    stk::mesh::PartVector&,
+    const std::vector<unsigned>& phi,
+    const std::vector<unsigned>& gradPhi);
+
+  virtual ~FusedNodalGradEdgeAlg() = default;
+
+  virtual void execute() override;
+
+  int num_fields() const { return phi_.size(); }
+
+private:
+  std::vector<unsigned> phi_;
+  std::vector<unsigned> gradPhi_;
+
+  unsigned edgeAreaVec_ {stk::mesh::InvalidOrdinal};
+  unsigned dualNodalVol_ {stk::mesh::InvalidOrdinal};
+
+  //! Spatial dimension (2D or 3D)
+  const int nDim_;
+
+  //! Maximum size for static arrays used within device loops
+  static constexpr int NDimMax = 3;
+};
+
+/** Nodal gradients of several scalar fields with shared sweeps
+ *
+ *  The edge algorithms of the drivers that cover the same parts are replaced
+ *  by a single FusedNodalGradEdgeAlg; the remaining (element and boundary)
+ *  algorithms run as registered. The parallel sum of all the gradients is
+ *  packed into one exchange before the per-field periodic and overset
+ *  updates.
+ */
+class FusedNodalGradDriver
+{
+public:
+  FusedNodalGradDriver(Realm&);
+
+  ~FusedNodalGradDriver() = default;
+
+  //! Add a driver; must be called before the first execute
+  void add_driver(ScalarNodalGradAlgDriver& driver);
+
+  void execute();
+
+private:
+  //! Group the edge algorithms of the drivers into fused sweeps
+  void setup();
+
+  Realm& realm_;
+
+  std::vector<ScalarNodalGradAlgDriver*> drivers_;
+
+  std::vector<std::unique_ptr<FusedNodalGradEdgeAlg>> fusedAlgs_;
+
+  //! Algorithms of the drivers that are not part of a fused sweep
+  std::vector<std::pair<std::string, Algorithm*>> otherAlgs_;
+
+  bool isSetup_{false};
+};
+
+}  // nalu
+}  // sierra
+
+
+#endif /* FUSEDNODALGRADDRIVER_H */
@@ -0,0 +1,68 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef GclFactorAlg_h
+#define GclFactorAlg_h
+
+#include "Algorithm.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Nodal geometric conservation law factor of a deforming mesh
+ *
+ *  \f[
+ *    f_\mathrm{gcl} = \nabla \cdot v - \left( \frac{\gamma_1 V^{n+1} +
+ *    \gamma_2 V^n + \gamma_3 V^{n-1}}{\Delta t \, V^{n+1}} - \nabla \cdot v
+ *    \right)
+ *  \f]
+ *
+ *  The first term comes from the Reynolds transport theorem, the second is
+ *  the discrete GCL error. The factor only depends on the mesh motion, so it
+ *  is computed once per time step and shared by the GCL terms of all the
+ *  equations, which then read a single field instead of the three dual
+ *  volume states.
+ *
+ *  With a lumped mass matrix the GCL source is fused into the mass BDF node
+ *  kernels (ScalarMassBDFNodeKernel, MomentumMassBDFNodeKernel and
+ *  ContinuityMassBDFNodeKernel through their `includeGcl` flag). The source
+ *  then shares the volume and density reads of the lumped mass, and the
+ *  equation systems skip the separate GCL node kernel. The standalone GCL
+ *  kernels remain for element mass configurations.
+ */
+class GclFactorAlg : public Algorithm
+{
+public:
+  using DblType = double;
+
+  GclFactorAlg(
+    Realm& realm, stk::mesh::PartVector& partVec, ScalarFieldType* gclFactor);
+
+  virtual ~GclFactorAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  ScalarFieldType* gclFactorField_{nullptr};
+  unsigned divV_{stk::mesh::InvalidOrdinal};
+  unsigned dnvNm1_{stk::mesh::InvalidOrdinal};
+  unsigned dnvN_{stk::mesh::InvalidOrdinal};
+  unsigned dnvNp1_{stk::mesh::InvalidOrdinal};
+  unsigned gclFactor_{stk::mesh::InvalidOrdinal};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
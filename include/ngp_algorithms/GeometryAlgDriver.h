@@ -28,6 +28,7 @@ class Realm;
  *    - exposed_area_vector
  *    - assembled_wall_area_wf
  *    - assembled_wall_normal_distance
+ *    - wall_normal_distance_bip, wall_face_geometry_bip (see WallFuncGeometryAlg)
  *
  *  While the volume computation happens at every invocation of the execute()
  *  method, the remaining fields are only computed if the user has requested
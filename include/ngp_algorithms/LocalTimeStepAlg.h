@@ -0,0 +1,81 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef LocalTimeStepAlg_h
+#define LocalTimeStepAlg_h
+
+#include "Algorithm.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Nodal pseudo-time step of the steady-state local time stepping
+ *
+ *  The local step combines the advective and the viscous limits of a node,
+ *
+ *  \f[
+ *    \Delta t = \mathrm{CFL} \frac{h^2}{|u| h + 2 \nu_\mathrm{eff}},
+ *    \quad h = V^{1/n_\mathrm{dim}},
+ *  \f]
+ *
+ *  with the CFL number ramped between its initial and maximum value by the
+ *  ratio of successive mean nonlinear residuals (switched evolution
+ *  relaxation).
+ */
+class LocalTimeStepAlg : public Algorithm
+{
+public:
+  using DblType = double;
+
+  LocalTimeStepAlg(
+    Realm& realm,
+    stk::mesh::PartVector& partVec,
+    ScalarFieldType* localDt,
+    const double cfl,
+    const double maxCfl,
+    const double rampExponent);
+
+  virtual ~LocalTimeStepAlg() = default;
+
+  virtual void execute() override;
+
+  /** Ramp the CFL number by the latest mean nonlinear residual
+   *
+   *  The first residual only initializes the ramp; non-positive residuals
+   *  leave the CFL number unchanged.
+   */
+  void update_cfl(const double residual);
+
+  double cfl() const { return cfl_; }
+
+private:
+  ScalarFieldType* localDtField_{nullptr};
+  unsigned velocity_{stk::mesh::InvalidOrdinal};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned viscosity_{stk::mesh::InvalidOrdinal};
+  unsigned tvisc_{stk::mesh::InvalidOrdinal};
+  unsigned dualNodalVolume_{stk::mesh::InvalidOrdinal};
+  unsigned localDt_{stk::mesh::InvalidOrdinal};
+
+  const double minCfl_;
+  const double maxCfl_;
+  const double rampExponent_;
+  double cfl_;
+  double prevResidual_{-1.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -32,6 +32,15 @@ public:
   //! Perform mdot correction logic after algorithms have done their work
   virtual void post_work() override;
 
+  /** Execute all algorithms except the interior edge mdot
+   *
+   *  Used before the continuity solve when the continuity edge assembly
+   *  stores the interior mdot itself (solution_options fused_mdot_continuity).
+   *  The density accumulation and boundary algorithms still provide the mass
+   *  balance used by the open mdot correction.
+   */
+  void execute_boundary_terms();
+
   //! Add up density accumulation from different topo element algorithms
   void add_density_accumulation(const DoubleType&);
 
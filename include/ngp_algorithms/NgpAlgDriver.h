@@ -42,9 +42,17 @@ public:
 
   /** Execute all the algorithms registered to this driver
    *
+   *  With split-phase assembly active and a driver that provides a halo sum,
+   *  the algorithms first run over the entities touching shared nodes, the
+   *  parallel sum is posted, and the interior entities are assembled while
+   *  the messages are in flight.
    */
   virtual void execute();
 
+  //! Algorithms registered to this driver, keyed by their unique names
+  const std::map<std::string, std::unique_ptr<Algorithm>>& algorithms() const
+  { return algMap_; }
+
   /** Register an edge algorithm
    *
    *  Currently only interior algorithms can be edge algorithms
@@ -174,6 +182,15 @@ public:
   }
 
 protected:
+  //! True if the driver implements begin_halo_sum/finish_halo_sum
+  virtual bool has_halo_sum() const { return false; }
+
+  //! Post the non-blocking parallel sum of the fields assembled by the driver
+  virtual void begin_halo_sum() {}
+
+  //! Complete the parallel sum posted in begin_halo_sum
+  virtual void finish_halo_sum() {}
+
   template <typename NaluAlg, class... Args>
   void register_algorithm_impl(
     stk::mesh::Part* part,
@@ -201,6 +218,9 @@ protected:
   std::map<std::string, std::unique_ptr<Algorithm>> algMap_;
 
   Realm& realm_;
+
+  //! Set during post_work if the parallel sum was done in split-phase mode
+  bool haloSumDone_{false};
 };
 
 
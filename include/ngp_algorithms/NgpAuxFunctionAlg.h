@@ -0,0 +1,78 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NGPAUXFUNCTIONALG_H
+#define NGPAUXFUNCTIONALG_H
+
+#include "Algorithm.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+class AuxFunction;
+class Realm;
+
+/** Evaluate an aux function on device at the nodes of a part
+ *
+ *  The functor is a plain value type copied into the kernel and called once
+ *  per node with the node coordinates, the current time and a buffer of three
+ *  values; components [beginPos, endPos) of the buffer are written to the
+ *  field. The field is left modified on device, so that the copy and
+ *  Dirichlet algorithms consuming it do not sync through the host.
+ */
+template <typename FunctorType>
+class NgpAuxFunctionAlg : public Algorithm
+{
+public:
+  NgpAuxFunctionAlg(
+    Realm& realm,
+    stk::mesh::Part* part,
+    stk::mesh::FieldBase* field,
+    const FunctorType& functor,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  virtual ~NgpAuxFunctionAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  stk::mesh::FieldBase* field_;
+  const FunctorType functor_;
+  const unsigned coordinates_{stk::mesh::InvalidOrdinal};
+  const unsigned beginPos_;
+  const unsigned endPos_;
+};
+
+/** Create the algorithm populating a field from an aux function
+ *
+ *  Aux functions with a device functor, listed in NgpAuxFunctionAlg.C, are
+ *  evaluated on device by a NgpAuxFunctionAlg when the field is a nodal
+ *  double field; the aux function is then deleted. All other functions fall
+ *  back to the host AuxFunctionAlgorithm, which takes ownership of it.
+ */
+Algorithm* create_aux_function_algorithm(
+  Realm& realm,
+  stk::mesh::Part* part,
+  stk::mesh::FieldBase* field,
+  AuxFunction* auxFunction,
+  stk::mesh::EntityRank entityRank);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NGPAUXFUNCTIONALG_H */
@@ -13,6 +13,7 @@
 
 #include "ngp_algorithms/NgpAlgDriver.h"
 #include "FieldTypeDef.h"
+#include "HaloSumExchange.h"
 
 namespace sierra {
 namespace nalu {
@@ -36,9 +37,28 @@ public:
   //! Synchronize fields after algorithms have done their work
   virtual void post_work() override;
 
+  /** Periodic and overset updates and the device sync of the gradient
+   *
+   *  The second half of post_work, for callers that perform the parallel
+   *  sum of the gradient themselves
+   */
+  void finish_post_work();
+
+  const std::string& grad_phi_name() const { return gradPhiName_; }
+
+protected:
+  virtual bool has_halo_sum() const override { return true; }
+
+  virtual void begin_halo_sum() override;
+
+  virtual void finish_halo_sum() override;
+
 private:
   //! Field that is synchronized pre/post updates
   const std::string gradPhiName_;
+
+  //! Split-phase parallel sum of the gradient
+  HaloSumExchange haloSum_;
 };
 
 using ScalarNodalGradAlgDriver = NodalGradAlgDriver<VectorFieldType>;
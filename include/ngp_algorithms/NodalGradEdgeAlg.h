@@ -42,6 +42,12 @@ public:
 
   virtual void execute() override;
 
+  virtual bool supports_split_phase() const override { return true; }
+
+  unsigned phi_ordinal() const { return phi_; }
+
+  unsigned grad_phi_ordinal() const { return gradPhi_; }
+
 private:
   unsigned phi_ {stk::mesh::InvalidOrdinal};
   unsigned gradPhi_ {stk::mesh::InvalidOrdinal};
@@ -46,6 +46,8 @@ public:
 
   virtual void execute() override;
 
+  virtual bool supports_split_phase() const override { return true; }
+
 private:
   ElemDataRequests dataNeeded_;
 
@@ -0,0 +1,64 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef RefinementIndicatorAlg_h
+#define RefinementIndicatorAlg_h
+
+#include "Algorithm.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+#include <cstddef>
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Nodal error indicator of a solution-adaptive refinement
+ *
+ *  The indicator is the vorticity magnitude scaled by the local mesh size,
+ *  \f$ |\omega| h \f$ with \f$ h = V^{1/n_\mathrm{dim}} \f$, i.e., the
+ *  velocity jump across a dual volume, normalized by its global maximum.
+ *  Nodes above the threshold are the ones a refinement would target; their
+ *  number is reported after each evaluation.
+ */
+class RefinementIndicatorAlg : public Algorithm
+{
+public:
+  using DblType = double;
+
+  RefinementIndicatorAlg(
+    Realm& realm,
+    stk::mesh::PartVector& partVec,
+    ScalarFieldType* indicator,
+    const double threshold);
+
+  virtual ~RefinementIndicatorAlg() = default;
+
+  virtual void execute() override;
+
+  //! Global number of nodes marked by the latest evaluation
+  size_t num_marked() const { return numMarked_; }
+
+private:
+  ScalarFieldType* indicatorField_{nullptr};
+  unsigned dudx_{stk::mesh::InvalidOrdinal};
+  unsigned dualNodalVolume_{stk::mesh::InvalidOrdinal};
+  unsigned indicator_{stk::mesh::InvalidOrdinal};
+
+  const double threshold_;
+  size_t numMarked_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
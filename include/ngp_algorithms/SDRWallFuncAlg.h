@@ -22,17 +22,17 @@ namespace nalu {
 
 /** SDR Wall function using wall friction velocity (u_tau)
  *
- *  \sa SDRWallFuncAlgDriver
+ *  The wall normal distance, unit normal and area magnitude at the boundary
+ *  integration points are read from the cache filled by WallFuncGeometryAlg,
+ *  so this is a face-only algorithm.
+ *
+ *  \sa SDRWallFuncAlgDriver, WallFuncGeometryAlg
  */
 template<typename BcAlgTraits>
 class SDRWallFuncAlg : public Algorithm
 {
 public:
-  SDRWallFuncAlg(
-    Realm&,
-    stk::mesh::Part*,
-    bool = false,
-    double = 0.0);
+  SDRWallFuncAlg(Realm&, stk::mesh::Part*, bool = false);
 
   virtual ~SDRWallFuncAlg() = default;
 
@@ -40,10 +40,9 @@ public:
 
 private:
   ElemDataRequests faceData_;
-  ElemDataRequests elemData_;
 
-  unsigned coordinates_    {stk::mesh::InvalidOrdinal};
-  unsigned exposedAreaVec_ {stk::mesh::InvalidOrdinal};
+  unsigned wallFaceGeom_   {stk::mesh::InvalidOrdinal};
+  unsigned wallNormDist_   {stk::mesh::InvalidOrdinal};
   unsigned wallFricVel_    {stk::mesh::InvalidOrdinal};
   unsigned wallArea_       {stk::mesh::InvalidOrdinal};
   unsigned sdrbc_          {stk::mesh::InvalidOrdinal};
@@ -52,10 +51,8 @@ private:
   const DoubleType kappa_;
 
   MasterElement* meFC_{nullptr};
-  MasterElement* meSCS_{nullptr};
 
   bool RANSAblBcApproach_;
-  double z0_;
 };
 
 }  // nalu
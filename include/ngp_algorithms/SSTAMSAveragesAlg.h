@@ -31,6 +31,14 @@ public:
 
   virtual void execute() override;
 
+  /** Terms of the averages that depend only on the metric tensor
+   *
+   *  Stores the 4/3 power of the metric tensor, its coefficient and the
+   *  aspect ratio scaling, so that the metric tensor is diagonalized when it
+   *  changes instead of every time the averages are updated.
+   */
+  void compute_metric_terms();
+
 private:
   const DblType betaStar_;
   const DblType CMdeg_;
@@ -59,6 +67,8 @@ private:
   unsigned visc_{stk::mesh::InvalidOrdinal};
   unsigned beta_{stk::mesh::InvalidOrdinal};
   unsigned Mij_{stk::mesh::InvalidOrdinal};
+  unsigned M43_{stk::mesh::InvalidOrdinal};
+  unsigned metricCoeffs_{stk::mesh::InvalidOrdinal};
   unsigned wallDist_{stk::mesh::InvalidOrdinal};
 
   // Proper definition of beta_kol in SST-AMS doesn't work 
@@ -0,0 +1,80 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef SSTClosureAlg_h
+#define SSTClosureAlg_h
+
+#include "Algorithm.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** SST F1 blending and effective diffusivities in a single node pass
+ *
+ *  Computes `sst_f_one_blending` and, from the blended F1, the effective
+ *  viscosities of the k and omega equations (and of the gamma equation when
+ *  a field is provided). tke, sdr, density, viscosity and the turbulent
+ *  viscosity are gathered once per node for all of them.
+ *
+ *  With `strainVort`, the strain rate and vorticity intermediates of the node
+ *  kernels are stored in the same pass: `2 S_ij S_ij`, so that the SST
+ *  production is that times the turbulent viscosity, and the vorticity
+ *  magnitude `sqrt(2 W_ij W_ij)`.
+ */
+class SSTClosureAlg : public Algorithm
+{
+public:
+  using DblType = double;
+
+  SSTClosureAlg(
+    Realm& realm,
+    stk::mesh::Part* part,
+    ScalarFieldType* fOneBlend,
+    ScalarFieldType* tkeEvisc,
+    ScalarFieldType* sdrEvisc,
+    ScalarFieldType* gammaEvisc = nullptr,
+    GenericFieldType* strainVort = nullptr);
+
+  virtual ~SSTClosureAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  ScalarFieldType* fOneBlendField_{nullptr};
+  unsigned density_{stk::mesh::InvalidOrdinal};
+  unsigned viscosity_{stk::mesh::InvalidOrdinal};
+  unsigned tvisc_{stk::mesh::InvalidOrdinal};
+  unsigned tke_{stk::mesh::InvalidOrdinal};
+  unsigned sdr_{stk::mesh::InvalidOrdinal};
+  unsigned dkdx_{stk::mesh::InvalidOrdinal};
+  unsigned dwdx_{stk::mesh::InvalidOrdinal};
+  unsigned minDistance_{stk::mesh::InvalidOrdinal};
+  unsigned fOneBlend_{stk::mesh::InvalidOrdinal};
+  unsigned tkeEvisc_{stk::mesh::InvalidOrdinal};
+  unsigned sdrEvisc_{stk::mesh::InvalidOrdinal};
+  unsigned gammaEvisc_{stk::mesh::InvalidOrdinal};
+  unsigned dudx_{stk::mesh::InvalidOrdinal};
+  unsigned strainVort_{stk::mesh::InvalidOrdinal};
+
+  const DblType betaStar_;
+  const DblType sigmaKOne_;
+  const DblType sigmaKTwo_;
+  const DblType sigmaWOne_;
+  const DblType sigmaWTwo_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
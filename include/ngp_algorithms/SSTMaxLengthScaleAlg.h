@@ -34,6 +34,10 @@ public:
 
   virtual void execute() override;
 
+  //! Max edge length, for the storage type T of the field
+  template <typename T>
+  void compute_max_length_scale();
+
 private:
   const unsigned maxLengthScale_ {stk::mesh::InvalidOrdinal};
   const unsigned coordinates_    {stk::mesh::InvalidOrdinal};
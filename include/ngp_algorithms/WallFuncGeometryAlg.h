@@ -13,12 +13,29 @@
 
 #include "Algorithm.h"
 #include "ElemDataRequests.h"
+#include "KokkosInterface.h"
 
 #include "stk_mesh/base/Types.hpp"
 
 namespace sierra {
 namespace nalu {
 
+//! Components per integration point of wall_face_geometry_bip
+KOKKOS_INLINE_FUNCTION
+constexpr int wall_face_geometry_bip_size(const int nDim) { return nDim + 1; }
+
+/** Wall face geometry used by the wall function algorithms
+ *
+ *  Computed by the GeometryAlgDriver once per mesh update and stored in face
+ *  fields, so that the wall function algorithms and kernels evaluated every
+ *  nonlinear iteration do not gather element coordinates or normalize the
+ *  exposed area vectors themselves:
+ *    - wall_normal_distance_bip: wall normal height of the first node off the
+ *      wall (or the roughness height for the RANS ABL approach)
+ *    - wall_face_geometry_bip: unit normal (nDim components) followed by the
+ *      area magnitude at every boundary integration point; see
+ *      wall_face_geometry_bip_size()
+ */
 template <typename BcAlgTraits>
 class WallFuncGeometryAlg : public Algorithm
 {
@@ -41,6 +58,7 @@ private:
   unsigned coordinates_ {stk::mesh::InvalidOrdinal};
   unsigned exposedAreaVec_ {stk::mesh::InvalidOrdinal};
   unsigned wallNormDistBip_ {stk::mesh::InvalidOrdinal};
+  unsigned wallFaceGeomBip_ {stk::mesh::InvalidOrdinal};
   unsigned wallArea_ {stk::mesh::InvalidOrdinal};
   unsigned wallNormDist_ {stk::mesh::InvalidOrdinal};
 
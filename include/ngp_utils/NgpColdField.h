@@ -0,0 +1,211 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NGPCOLDFIELD_H
+#define NGPCOLDFIELD_H
+
+/** \file
+ *  \brief Transient device copy of a field kept in host memory
+ */
+
+#include "KokkosInterface.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/FieldBase.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpMesh.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace sierra {
+namespace nalu {
+namespace nalu_ngp {
+
+/** Device accessor of a cold field
+ *
+ *  Same layout as NgpSoAField, `data(bucket_ord, component, bucket_id)`, in
+ *  a device block that only exists while the field is resident.
+ */
+template <typename T>
+class NgpColdField
+{
+public:
+  using ViewType = Kokkos::View<
+    T***, Kokkos::LayoutLeft, MemSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  KOKKOS_DEFAULTED_FUNCTION NgpColdField() = default;
+  KOKKOS_DEFAULTED_FUNCTION NgpColdField(const NgpColdField&) = default;
+  KOKKOS_DEFAULTED_FUNCTION NgpColdField& operator=(const NgpColdField&) = default;
+  KOKKOS_DEFAULTED_FUNCTION ~NgpColdField() = default;
+
+  explicit NgpColdField(const ViewType& data) : data_(data) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  T& get(const stk::mesh::FastMeshIndex& idx, const int comp) const
+  {
+    return data_(idx.bucket_ord, comp, idx.bucket_id);
+  }
+
+  //! Entity loop index of nalu_ngp::run_entity_algorithm
+  KOKKOS_FORCEINLINE_FUNCTION
+  T& get(const stk::mesh::NgpMesh::MeshIndex& mi, const int comp) const
+  {
+    return data_(mi.bucketOrd, comp, mi.bucket->bucket_id());
+  }
+
+  const ViewType& view() const { return data_; }
+
+private:
+  ViewType data_;
+};
+
+/** Host resident field that is copied to the device on demand
+ *
+ *  The STK host data stays the only persistent copy; no NgpField is ever
+ *  created for the field. prefetch() packs the host values into a pinned
+ *  staging buffer and starts an asynchronous copy into a device block,
+ *  field() waits for it, and release() optionally copies the device values
+ *  back to the host before freeing the block.
+ *
+ *  The block is allocated from Kokkos rather than the DeviceMemoryPool: the
+ *  pool caches released blocks of its size class, so a field sized block
+ *  would stay allocated for the rest of the run.
+ */
+template <typename T>
+class ColdFieldMirror
+{
+public:
+  using StagingType = Kokkos::View<T***, Kokkos::LayoutLeft, PinnedSpace>;
+  using BlockType = Kokkos::View<T***, Kokkos::LayoutLeft, MemSpace>;
+
+  ColdFieldMirror() = default;
+  ~ColdFieldMirror() { free_block(); }
+
+  ColdFieldMirror(const ColdFieldMirror&) = delete;
+  ColdFieldMirror& operator=(const ColdFieldMirror&) = delete;
+
+  bool resident() const { return resident_; }
+
+  //! Device bytes held while resident
+  size_t device_bytes() const { return block_.span() * sizeof(T); }
+
+  //! Pack the host values and start their copy to the device
+  void prefetch(const stk::mesh::BulkData& bulk, const stk::mesh::FieldBase& field)
+  {
+    if (resident())
+      return;
+
+    const auto rank = field.entity_rank();
+    const auto& buckets = bulk.buckets(rank);
+    size_t capacity = 0;
+    for (const auto* b : buckets)
+      capacity = std::max(capacity, static_cast<size_t>(b->capacity()));
+    const size_t numComp = field.max_size(rank);
+
+    // the staging buffer is kept; it only changes with the buckets
+    if (
+      staging_.extent(0) != capacity || staging_.extent(1) != numComp ||
+      staging_.extent(2) != buckets.size())
+      staging_ = StagingType(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "cold_" + field.name()),
+        capacity, numComp, buckets.size());
+
+    for (const auto* b : buckets) {
+      const unsigned ncomp = stk::mesh::field_scalars_per_entity(field, *b);
+      if (ncomp == 0)
+        continue;
+      const T* values = static_cast<const T*>(stk::mesh::field_data(field, *b));
+      const unsigned bktId = b->bucket_id();
+      for (size_t k = 0; k < b->size(); ++k)
+        for (unsigned d = 0; d < ncomp; ++d)
+          staging_(k, d, bktId) = values[k * ncomp + d];
+    }
+
+    block_ = BlockType(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "cold_" + field.name()),
+      capacity, numComp, buckets.size());
+    Kokkos::deep_copy(execSpace_, block_, staging_);
+    field_ = NgpColdField<T>(typename NgpColdField<T>::ViewType(
+      block_.data(), capacity, numComp, buckets.size()));
+    resident_ = true;
+    pending_ = true;
+  }
+
+  //! Device accessor; waits for a prefetch still in flight
+  const NgpColdField<T>& field(
+    const stk::mesh::BulkData& bulk, const stk::mesh::FieldBase& stkField)
+  {
+    prefetch(bulk, stkField);
+    if (pending_) {
+      execSpace_.fence();
+      pending_ = false;
+    }
+    return field_;
+  }
+
+  /** Free the device block
+   *
+   *  @param writeBack Copy the device values back to the host field first;
+   *         the host field is then marked modified, so that NgpFields other
+   *         consumers created for it are synced again
+   */
+  void release(
+    const stk::mesh::BulkData& bulk,
+    const stk::mesh::FieldBase& field,
+    const bool writeBack)
+  {
+    if (!resident())
+      return;
+
+    // kernels reading the block may still run
+    Kokkos::fence();
+    pending_ = false;
+    if (writeBack) {
+      Kokkos::deep_copy(staging_, field_.view());
+      for (const auto* b : bulk.buckets(field.entity_rank())) {
+        const unsigned ncomp = stk::mesh::field_scalars_per_entity(field, *b);
+        if (ncomp == 0)
+          continue;
+        T* values = static_cast<T*>(stk::mesh::field_data(field, *b));
+        const unsigned bktId = b->bucket_id();
+        for (size_t k = 0; k < b->size(); ++k)
+          for (unsigned d = 0; d < ncomp; ++d)
+            values[k * ncomp + d] = staging_(k, d, bktId);
+      }
+      field.modify_on_host();
+    }
+    free_block();
+  }
+
+private:
+  void free_block()
+  {
+    if (!resident_)
+      return;
+    // kernels still reading the block must finish before it is freed
+    Kokkos::fence();
+    field_ = NgpColdField<T>();
+    block_ = BlockType();
+    resident_ = false;
+  }
+
+  StagingType staging_;
+  NgpColdField<T> field_;
+  BlockType block_;
+  bool resident_{false};
+  bool pending_{false};
+  DeviceSpace execSpace_;
+};
+
+} // namespace nalu_ngp
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NGPCOLDFIELD_H */
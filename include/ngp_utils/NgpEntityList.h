@@ -0,0 +1,119 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef NGPENTITYLIST_H
+#define NGPENTITYLIST_H
+
+#include "ngp_utils/NgpTypes.h"
+
+#include "stk_mesh/base/Selector.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+
+#include <string>
+
+namespace sierra {
+namespace nalu {
+namespace nalu_ngp {
+
+/** Selected entities of one rank flattened across the STK buckets
+ *
+ *  Holds the bucket id and bucket ordinal of every selected entity, in bucket
+ *  order, so that mesh loops can be split into ranges of any length instead
+ *  of one team per bucket. The list is built on the device from the bucket
+ *  ids of the selector and must be rebuilt after a mesh modification, e.g.,
+ *  when BulkData::synchronized_count changes.
+ */
+template <typename Mesh = stk::mesh::NgpMesh>
+class EntityList
+{
+public:
+  using ExecSpace = typename Mesh::MeshExecSpace;
+  using IndexView =
+    Kokkos::View<stk::mesh::FastMeshIndex*, typename ExecSpace::memory_space>;
+
+  EntityList() = default;
+
+  EntityList(
+    const Mesh& mesh,
+    const stk::topology::rank_t rank,
+    const stk::mesh::Selector& sel)
+  {
+    build(mesh, rank, sel);
+  }
+
+  void build(
+    const Mesh& mesh,
+    const stk::topology::rank_t rank,
+    const stk::mesh::Selector& sel)
+  {
+    using TeamPolicy = typename NGPMeshTraits<Mesh>::TeamPolicy;
+    using TeamHandleType = typename NGPMeshTraits<Mesh>::TeamHandleType;
+
+    rank_ = rank;
+    const auto& buckets = mesh.get_bucket_ids(rank, sel);
+    const unsigned numBuckets = buckets.size();
+
+    // first entry of every bucket in the flattened list
+    Kokkos::View<unsigned*, typename ExecSpace::memory_space> offsets(
+      "entity_list_offsets", numBuckets);
+    unsigned numEntities = 0;
+    Kokkos::parallel_scan(
+      "EntityList::offsets", Kokkos::RangePolicy<ExecSpace>(0, numBuckets),
+      KOKKOS_LAMBDA(const unsigned i, unsigned& offset, const bool final) {
+        if (final)
+          offsets(i) = offset;
+        offset += mesh.get_bucket(rank, buckets.device_get(i)).size();
+      },
+      numEntities);
+
+    entities_ = IndexView(
+      Kokkos::ViewAllocateWithoutInitializing("entity_list"), numEntities);
+    const auto entities = entities_;
+    Kokkos::parallel_for(
+      "EntityList::fill", TeamPolicy(numBuckets, Kokkos::AUTO),
+      KOKKOS_LAMBDA(const TeamHandleType& team) {
+        const unsigned bktId = buckets.device_get(team.league_rank());
+        const unsigned first = offsets(team.league_rank());
+        const unsigned bktLen = mesh.get_bucket(rank, bktId).size();
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, bktLen), [&](const unsigned& k) {
+            entities(first + k) = stk::mesh::FastMeshIndex{bktId, k};
+          });
+      });
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t size() const { return entities_.extent(0); }
+
+  KOKKOS_INLINE_FUNCTION
+  stk::topology::rank_t rank() const { return rank_; }
+
+  KOKKOS_INLINE_FUNCTION
+  const stk::mesh::FastMeshIndex& operator()(const size_t i) const
+  {
+    return entities_(i);
+  }
+
+  //! Number of ranges of chunkSize entities covering the list
+  size_t num_chunks(const unsigned chunkSize) const
+  {
+    return (size() + chunkSize - 1) / chunkSize;
+  }
+
+private:
+  IndexView entities_;
+  stk::topology::rank_t rank_{stk::topology::INVALID_RANK};
+};
+
+} // namespace nalu_ngp
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NGPENTITYLIST_H */
@@ -14,6 +14,7 @@
 #include "ngp_utils/NgpTypes.h"
 #include "ngp_utils/NgpLoopUtils.h"
 #include "ngp_utils/NgpFieldUtils.h"
+#include "utils/SyncAudit.h"
 #include "stk_mesh/base/NgpMesh.hpp"
 
 namespace sierra {
@@ -46,7 +47,7 @@ inline void field_axpby(
   using Traits = NGPMeshTraits<Mesh>;
   using MeshIndex = typename Traits::MeshIndex;
 
-  yField.sync_to_device();
+  NALU_SYNC_TO_DEVICE(yField);
 
   nalu_ngp::run_entity_algorithm(
     "ngp_field_axpby",
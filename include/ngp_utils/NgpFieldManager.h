@@ -19,6 +19,11 @@
 #include "stk_mesh/base/MetaData.hpp"
 #include "stk_mesh/base/NgpField.hpp"
 #include "stk_mesh/base/GetNgpField.hpp"
+#include "ngp_utils/NgpColdField.h"
+#include "ngp_utils/NgpSoAField.h"
+
+#include <map>
+#include <memory>
 
 namespace sierra {
 namespace nalu {
@@ -33,7 +38,7 @@ class FieldManager
 {
 public:
   FieldManager(const stk::mesh::BulkData & bulk)
-    : m_meta(bulk.mesh_meta_data())
+    : m_bulk(bulk), m_meta(bulk.mesh_meta_data())
   {
   }
 
@@ -48,13 +53,90 @@ public:
   template <typename T>
   stk::mesh::NgpField<T> & get_field(unsigned fieldOrdinal) const {
     ThrowAssertMsg(m_meta.get_fields().size() > fieldOrdinal, "Invalid field ordinal.");
+    ThrowAssertMsg(
+      m_coldMirrors.find(fieldOrdinal) == m_coldMirrors.end(),
+      "Cold fields are accessed through get_cold_field.");
     stk::mesh::FieldBase* stkField = m_meta.get_fields()[fieldOrdinal];
     stk::mesh::NgpField<T>& tmp = stk::mesh::get_updated_ngp_field<T>(*stkField);
     return tmp;
   }
 
+  /** Structure-of-arrays mirror of a field on device
+   *
+   *  The mirror is created on the first request and copied from the device
+   *  field again on the first request after mark_soa_fields_stale(); the
+   *  equation systems mark the mirrors stale before each assembly.
+   */
+  const NgpSoAField<double> & get_soa_field(unsigned fieldOrdinal) const {
+    ThrowAssertMsg(m_meta.get_fields().size() > fieldOrdinal, "Invalid field ordinal.");
+    SoAMirror& mirror = m_soaMirrors[fieldOrdinal];
+    if (mirror.stale) {
+      mirror.field.refresh(m_bulk, *m_meta.get_fields()[fieldOrdinal]);
+      mirror.stale = false;
+    }
+    return mirror.field;
+  }
+
+  void mark_soa_fields_stale() const {
+    for (auto& mirror : m_soaMirrors)
+      mirror.second.stale = true;
+  }
+
+  /** Cold fields: device memory only while a kernel needs the field
+   *
+   *  Meant for fields touched once per step or per output (averaging
+   *  accumulators, output or restart only fields). The host field is the
+   *  persistent copy; prefetch_cold_field() starts its asynchronous copy into
+   *  a device block ahead of the kernel, get_cold_field() returns the
+   *  accessor (prefetching on the spot if needed) and release_cold_field()
+   *  frees the block again, copying the values back for fields written on
+   *  device.
+   */
+  void prefetch_cold_field(unsigned fieldOrdinal) const {
+    cold_mirror(fieldOrdinal).prefetch(m_bulk, *m_meta.get_fields()[fieldOrdinal]);
+  }
+
+  const NgpColdField<double> & get_cold_field(unsigned fieldOrdinal) const {
+    return cold_mirror(fieldOrdinal).field(m_bulk, *m_meta.get_fields()[fieldOrdinal]);
+  }
+
+  void release_cold_field(unsigned fieldOrdinal, const bool writeBack = false) const {
+    auto it = m_coldMirrors.find(fieldOrdinal);
+    if (it != m_coldMirrors.end())
+      it->second->release(m_bulk, *m_meta.get_fields()[fieldOrdinal], writeBack);
+  }
+
+  //! Device bytes held by the resident cold fields
+  size_t cold_field_device_bytes() const {
+    size_t bytes = 0;
+    for (const auto& mirror : m_coldMirrors)
+      bytes += mirror.second->device_bytes();
+    return bytes;
+  }
+
 private: 
+  ColdFieldMirror<double>& cold_mirror(unsigned fieldOrdinal) const {
+    ThrowAssertMsg(m_meta.get_fields().size() > fieldOrdinal, "Invalid field ordinal.");
+    auto& mirror = m_coldMirrors[fieldOrdinal];
+    if (!mirror)
+      mirror.reset(new ColdFieldMirror<double>());
+    return *mirror;
+  }
+
+  struct SoAMirror
+  {
+    NgpSoAField<double> field;
+    bool stale{true};
+  };
+
+  const stk::mesh::BulkData& m_bulk;
   const stk::mesh::MetaData& m_meta;
+
+  //! SoA mirrors requested so far, by field ordinal
+  mutable std::map<unsigned, SoAMirror> m_soaMirrors;
+
+  //! Cold fields requested so far, by field ordinal
+  mutable std::map<unsigned, std::unique_ptr<ColdFieldMirror<double>>> m_coldMirrors;
 };
 
 } 
@@ -14,6 +14,7 @@
 #include <type_traits>
 
 #include "ngp_utils/NgpTypes.h"
+#include "ngp_utils/NgpEntityList.h"
 #include "ngp_utils/NgpScratchData.h"
 #include "ngp_utils/NgpMEUtils.h"
 #include "CopyAndInterleave.h"
@@ -62,7 +63,8 @@ inline int
 ngp_calc_thread_shmem_size(
   int ndim, const DataReqType& dataReq, const ElemReqType reqType)
 {
-  int preReqSize = get_num_bytes_pre_req_data<T>(dataReq, ndim, reqType);
+  int preReqSize = get_num_bytes_pre_req_data<T>(dataReq, ndim, reqType) +
+                   get_num_bytes_simd_alignment_padding(dataReq);
   int mdvSize = MultiDimViews<T>::bytes_needed(
     dataReq.get_total_num_fields(),
     count_needed_field_views(dataReq.get_host_fields()));
@@ -240,6 +242,112 @@ void run_entity_par_reduce(
     }, reduceVal);
 }
 
+//! Default number of entities per team of the flattened entity loops
+constexpr unsigned defaultEntityChunkSize = 128;
+
+/** Execute the given functor for all entities of a flattened entity list
+ *
+ *  Alternative to the bucket based run_entity_algorithm where each team
+ *  processes chunkSize consecutive entities of the list irrespective of the
+ *  STK bucket they belong to. This evens out the team sizes when many
+ *  buckets are only partially filled. The functor is called with the same
+ *  MeshIndex argument as the bucket based loop.
+ *
+ *. @param algName User-defined name for the parallel for loop
+ *  @param mesh A STK NGP mesh instance
+ *  @param entities Flattened list of the entities to loop over
+ *  @param algorithm A functor that will be executed for each entity
+ *  @param chunkSize Number of entities processed by one team
+ */
+template<typename Mesh, typename AlgFunctor>
+void run_entity_algorithm(
+  const std::string& algName,
+  const Mesh& mesh,
+  const EntityList<Mesh>& entities,
+  const AlgFunctor algorithm,
+  const unsigned chunkSize = defaultEntityChunkSize)
+{
+  using Traits         = NGPMeshTraits<Mesh>;
+  using TeamPolicy     = typename Traits::TeamPolicy;
+  using TeamHandleType = typename Traits::TeamHandleType;
+  using MeshIndex      = typename Traits::MeshIndex;
+
+  const stk::topology::rank_t rank = entities.rank();
+  const unsigned numEntities = entities.size();
+  auto team_exec = TeamPolicy(entities.num_chunks(chunkSize), Kokkos::AUTO);
+
+  Kokkos::parallel_for(
+    algName, team_exec,
+    KOKKOS_LAMBDA(const TeamHandleType& team) {
+      const unsigned chunkBegin = team.league_rank() * chunkSize;
+      const unsigned chunkLen = (chunkBegin + chunkSize < numEntities)
+        ? chunkSize : numEntities - chunkBegin;
+
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, chunkLen),
+        [&](const unsigned& k) {
+          const auto& fmi = entities(chunkBegin + k);
+          MeshIndex meshIdx{&mesh.get_bucket(rank, fmi.bucket_id), fmi.bucket_ord};
+          algorithm(meshIdx);
+        });
+    });
+}
+
+/** Execute the given functor for a flattened entity list and reduce
+ *
+ *  Flattened counterpart of run_entity_par_reduce for Kokkos reducer types,
+ *  see the flattened run_entity_algorithm.
+ *
+ *. @param algName User-defined name for the parallel_reduce loop
+ *  @param mesh A STK NGP mesh instance
+ *  @param entities Flattened list of the entities to loop over
+ *  @param algorithm A functor that will be executed for each entity
+ *  @param reduceVal A Kokkos reducer type
+ *  @param chunkSize Number of entities processed by one team
+ */
+template<typename Mesh, typename AlgFunctor, typename ReducerType>
+void run_entity_par_reduce(
+  const std::string& algName,
+  const Mesh& mesh,
+  const EntityList<Mesh>& entities,
+  const AlgFunctor algorithm,
+  ReducerType& reduceVal,
+  const unsigned chunkSize = defaultEntityChunkSize)
+{
+  using Traits         = NGPMeshTraits<Mesh>;
+  using TeamPolicy     = typename Traits::TeamPolicy;
+  using TeamHandleType = typename Traits::TeamHandleType;
+  using MeshIndex      = typename Traits::MeshIndex;
+  using value_type     = typename ReducerType::value_type;
+
+  const stk::topology::rank_t rank = entities.rank();
+  const unsigned numEntities = entities.size();
+  auto team_exec = TeamPolicy(entities.num_chunks(chunkSize), Kokkos::AUTO);
+
+  Kokkos::parallel_reduce(
+    algName, team_exec,
+    KOKKOS_LAMBDA(const TeamHandleType& team, value_type& teamVal) {
+      const unsigned chunkBegin = team.league_rank() * chunkSize;
+      const unsigned chunkLen = (chunkBegin + chunkSize < numEntities)
+        ? chunkSize : numEntities - chunkBegin;
+
+      value_type chunkVal;
+      Kokkos::parallel_reduce(
+        Kokkos::TeamThreadRange(team, chunkLen),
+        [&](const unsigned& k, value_type& threadVal) {
+          const auto& fmi = entities(chunkBegin + k);
+          MeshIndex meshIdx{&mesh.get_bucket(rank, fmi.bucket_id), fmi.bucket_ord};
+          algorithm(meshIdx, threadVal);
+        }, ReducerType(chunkVal));
+
+      Kokkos::single(
+        Kokkos::PerTeam(team),
+        [&]() {
+          reduceVal.join(teamVal, chunkVal);
+        });
+    }, reduceVal);
+}
+
 /** Execute the given functor for all edges in a Kokkos parallel loop
  *
  *  The functor is called with one argument MeshIndex, a struct containing a
@@ -271,6 +379,39 @@ inline void run_edge_algorithm(
   });
 }
 
+/** Execute the given functor for all edges and perform global reduction
+ *
+ *  The functor is called with the EntityInfo of the edge, as in
+ *  run_edge_algorithm, and the accumulator for reduction.
+ *
+ *. @param algName User-defined name for the edge parallel_reduce loop
+ *  @param mesh A STK NGP mesh instance
+ *  @param sel  STK mesh selector to choose buckets for looping
+ *  @param algorithm A functor that will be executed for each entity
+ *  @param reduceVal A Kokkos reducer type
+ */
+template<typename Mesh, typename AlgFunctor, typename ReducerType>
+inline void run_edge_par_reduce(
+  const std::string& algName,
+  const Mesh& mesh,
+  const stk::mesh::Selector& sel,
+  const AlgFunctor algorithm,
+  ReducerType& reduceVal)
+{
+  static constexpr stk::topology::rank_t rank = stk::topology::EDGE_RANK;
+  using Traits     = NGPMeshTraits<Mesh>;
+  using MeshIndex  = typename Traits::MeshIndex;
+  using value_type = typename ReducerType::value_type;
+
+  run_entity_par_reduce(
+    algName, mesh, rank, sel,
+    KOKKOS_LAMBDA(MeshIndex& meshIdx, value_type& threadVal) {
+      algorithm(
+        EntityInfo<Mesh>{meshIdx, (*meshIdx.bucket)[meshIdx.bucketOrd],
+            mesh.get_nodes(meshIdx)}, threadVal);
+  }, reduceVal);
+}
+
 /** Execute the given functor for all elements in a Kokkos parallel loop
  *
  *  The functor is called with one argument MeshIndex, a struct containing a
@@ -115,6 +115,7 @@ struct NgpReduceArray
 using ArrayDbl2 = NgpReduceArray<double, 2>;
 using ArrayDbl3 = NgpReduceArray<double, 3>;
 using ArrayInt2 = NgpReduceArray<int, 2>;
+using ArrayInt3 = NgpReduceArray<int, 3>;
 
 using ArraySimdDouble2 = NgpReduceArray<DoubleType, 2>;
 using ArraySimdDouble3 = NgpReduceArray<DoubleType, 3>;
@@ -218,6 +219,18 @@ struct reduction_identity<sierra::nalu::nalu_ngp::ArrayInt2>
   { return sierra::nalu::nalu_ngp::ArrayInt2(1); }
 };
 
+template<>
+struct reduction_identity<sierra::nalu::nalu_ngp::ArrayInt3>
+{
+  KOKKOS_FORCEINLINE_FUNCTION
+  static sierra::nalu::nalu_ngp::ArrayInt3 sum()
+  { return sierra::nalu::nalu_ngp::ArrayInt3(0); }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static sierra::nalu::nalu_ngp::ArrayInt3 prod()
+  { return sierra::nalu::nalu_ngp::ArrayInt3(1); }
+};
+
 } // namespace Kokkos
 
 #endif /* NGPREDUCEUTILS_H */
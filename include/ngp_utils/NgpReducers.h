@@ -11,6 +11,7 @@
 #define NGPREDUCERS_H
 
 #include "KokkosInterface.h"
+#include "ngp_utils/NgpReduceUtils.h"
 
 namespace sierra {
 namespace nalu {
@@ -111,6 +112,110 @@ public:
   }
 };
 
+
+/** Sums of N quantities along with the extrema of one more
+ *
+ *  Used by the surface force and moment post-processing, which sums the
+ *  pressure/viscous force and moment components and tracks the y+ range in a
+ *  single pass over the wall faces.
+ */
+template<class Scalar, int N>
+struct ArraySumMinMaxScalar {
+  NgpReduceArray<Scalar, N> sum;
+  Scalar min_val, max_val;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  ArraySumMinMaxScalar() = default;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  ArraySumMinMaxScalar(const ArraySumMinMaxScalar&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator = (const ArraySumMinMaxScalar& rhs) {
+    sum = rhs.sum;
+    min_val = rhs.min_val;
+    max_val = rhs.max_val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator = (const volatile ArraySumMinMaxScalar& rhs) volatile {
+    sum = rhs.sum;
+    min_val = rhs.min_val;
+    max_val = rhs.max_val;
+  }
+};
+
+template<class Scalar, int N, class Space = Kokkos::HostSpace>
+struct ArraySumMinMax
+{
+private:
+  typedef typename std::remove_cv<Scalar>::type scalar_type;
+
+public:
+  typedef ArraySumMinMax reducer;
+  typedef ArraySumMinMaxScalar<scalar_type, N> value_type;
+  typedef Kokkos::View<value_type, Space> result_view_type;
+
+private:
+  result_view_type value;
+  bool references_scalar_v;
+
+public:
+  KOKKOS_INLINE_FUNCTION
+  ArraySumMinMax(value_type& value_): value(&value_),references_scalar_v(true) {}
+
+  KOKKOS_INLINE_FUNCTION
+  ArraySumMinMax(const result_view_type& value_): value(value_),references_scalar_v(false) {}
+
+  //Required
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& dest, const value_type& src)  const {
+    if ( src.min_val < dest.min_val ) {
+      dest.min_val = src.min_val;
+    }
+    if ( src.max_val > dest.max_val ) {
+      dest.max_val = src.max_val;
+    }
+
+    dest.sum += src.sum;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type& dest, const volatile value_type& src) const {
+    if ( src.min_val < dest.min_val ) {
+      dest.min_val = src.min_val;
+    }
+    if ( src.max_val > dest.max_val ) {
+      dest.max_val = src.max_val;
+    }
+
+    dest.sum += src.sum;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init( value_type& val)  const {
+    val.max_val = Kokkos::reduction_identity<scalar_type>::max();
+    val.min_val = Kokkos::reduction_identity<scalar_type>::min();
+    for (int i=0; i < N; ++i)
+      val.sum.array_[i] = Kokkos::reduction_identity<scalar_type>::sum();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  value_type& reference() const {
+    return *value.data();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  result_view_type view() const {
+    return value;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool references_scalar() const {
+    return references_scalar_v;
+  }
+};
+
 }
 
 }  // nalu
@@ -0,0 +1,113 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NGPSOAFIELD_H
+#define NGPSOAFIELD_H
+
+/** \file
+ *  \brief Structure-of-arrays device mirror of a multi-component field
+ */
+
+#include "KokkosInterface.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/FieldBase.hpp"
+#include "stk_mesh/base/GetNgpField.hpp"
+#include "stk_mesh/base/GetNgpMesh.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/NgpMesh.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace sierra {
+namespace nalu {
+namespace nalu_ngp {
+
+/** Read-only device copy of a field with the components stored in planes
+ *
+ *  The values of one component are contiguous over the entities of a bucket,
+ *  `data(bucket_ord, component, bucket_id)`, so that threads working on
+ *  neighbouring entities load neighbouring addresses whatever the layout of
+ *  the STK device field. The accessor mirrors `NgpField::get` so kernels can
+ *  be written once for either type.
+ *
+ *  The copy is refreshed on request by nalu_ngp::FieldManager; see
+ *  FieldManager::get_soa_field.
+ */
+template <typename T>
+class NgpSoAField
+{
+public:
+  using ViewType = Kokkos::View<T***, Kokkos::LayoutLeft, MemSpace>;
+
+  KOKKOS_DEFAULTED_FUNCTION NgpSoAField() = default;
+  KOKKOS_DEFAULTED_FUNCTION NgpSoAField(const NgpSoAField&) = default;
+  KOKKOS_DEFAULTED_FUNCTION NgpSoAField& operator=(const NgpSoAField&) = default;
+  KOKKOS_DEFAULTED_FUNCTION ~NgpSoAField() = default;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  const T& get(const stk::mesh::FastMeshIndex& idx, const int comp) const
+  {
+    return data_(idx.bucket_ord, comp, idx.bucket_id);
+  }
+
+  //! Copy the current device values of the field into the mirror
+  void refresh(const stk::mesh::BulkData& bulk, const stk::mesh::FieldBase& field)
+  {
+    using TeamPolicy =
+      Kokkos::TeamPolicy<stk::mesh::NgpMesh::MeshExecSpace, stk::ngp::ScheduleType>;
+    using TeamHandleType = typename TeamPolicy::member_type;
+
+    const auto rank = field.entity_rank();
+    const auto& buckets = bulk.buckets(rank);
+    size_t capacity = 0;
+    for (const auto* b : buckets)
+      capacity = std::max(capacity, static_cast<size_t>(b->capacity()));
+    const size_t numComp = field.max_size(rank);
+
+    // reallocate after mesh modifications changed the buckets
+    if (
+      data_.extent(0) != capacity || data_.extent(1) != numComp ||
+      data_.extent(2) != buckets.size())
+      data_ = ViewType(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "soa_" + field.name()),
+        capacity, numComp, buckets.size());
+
+    const auto& ngpMesh = stk::mesh::get_updated_ngp_mesh(bulk);
+    const auto ngpField = stk::mesh::get_updated_ngp_field<T>(field);
+    const auto data = data_;
+    const int ncomp = numComp;
+
+    const auto& bucketIds =
+      ngpMesh.get_bucket_ids(rank, stk::mesh::selectField(field));
+    Kokkos::parallel_for(
+      "soa_mirror_" + field.name(), TeamPolicy(bucketIds.size(), Kokkos::AUTO),
+      KOKKOS_LAMBDA(const TeamHandleType& team) {
+        const unsigned bktId = bucketIds.device_get(team.league_rank());
+        const auto& bkt = ngpMesh.get_bucket(rank, bktId);
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team, bkt.size()), [&](const unsigned k) {
+            const stk::mesh::FastMeshIndex idx{bktId, k};
+            for (int d = 0; d < ncomp; ++d)
+              data(k, d, bktId) = ngpField.get(idx, d);
+          });
+      });
+  }
+
+private:
+  ViewType data_;
+};
+
+} // namespace nalu_ngp
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NGPSOAFIELD_H */
@@ -47,7 +47,8 @@ public:
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
   double FPG(const double& out);
 
@@ -56,22 +57,18 @@ private:
   stk::mesh::NgpField<double> sdr_;
   stk::mesh::NgpField<double> density_;
   stk::mesh::NgpField<double> visc_;
-  stk::mesh::NgpField<double> dudx_;
+  stk::mesh::NgpField<double> strainVort_;
   stk::mesh::NgpField<double> minD_;
   stk::mesh::NgpField<double> dualNodalVolume_;
-  stk::mesh::NgpField<double> coordinates_;
-  stk::mesh::NgpField<double> velocityNp1_;
   stk::mesh::NgpField<double> gamint_;
 
   unsigned tkeID_             {stk::mesh::InvalidOrdinal};
   unsigned sdrID_             {stk::mesh::InvalidOrdinal};
   unsigned densityID_         {stk::mesh::InvalidOrdinal};
   unsigned viscID_            {stk::mesh::InvalidOrdinal};
-  unsigned dudxID_            {stk::mesh::InvalidOrdinal};
+  unsigned strainVortID_      {stk::mesh::InvalidOrdinal};
   unsigned minDID_            {stk::mesh::InvalidOrdinal};
   unsigned dualNodalVolumeID_ {stk::mesh::InvalidOrdinal};
-  unsigned coordinatesID_     {stk::mesh::InvalidOrdinal};
-  unsigned velocityNp1ID_     {stk::mesh::InvalidOrdinal};
   unsigned gamintID_          {stk::mesh::InvalidOrdinal};
 
   NodeKernelTraits::DblType caOne_;
@@ -81,8 +78,6 @@ private:
 
   int timeStepCount;
   int maxStepCount;
-
-  const int nDim_;
 };
 
 }  // nalu
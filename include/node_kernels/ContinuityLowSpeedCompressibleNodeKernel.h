@@ -0,0 +1,67 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef CONTINUITYLOWSPEEDCOMPRESSIBLENODEKERNEL_H
+#define CONTINUITYLOWSPEEDCOMPRESSIBLENODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Lumped d(rho)/dp contribution to the pressure Poisson operator
+ *
+ *  The right hand side is already part of the density time derivative.
+ */
+class ContinuityLowSpeedCompressibleNodeKernel : public NGPNodeKernel<ContinuityLowSpeedCompressibleNodeKernel>
+{
+public:
+  ContinuityLowSpeedCompressibleNodeKernel(
+    const stk::mesh::BulkData&);
+
+  ContinuityLowSpeedCompressibleNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~ContinuityLowSpeedCompressibleNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME | NodeKernelData::DENSITY;
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
+
+private:
+  stk::mesh::NgpField<double> pressure_;
+
+  unsigned pressureID_{stk::mesh::InvalidOrdinal};
+
+  NodeKernelTraits::DblType dt_{0.0};
+  NodeKernelTraits::DblType gamma1_{1.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* CONTINUITYLOWSPEEDCOMPRESSIBLENODEKERNEL_H */
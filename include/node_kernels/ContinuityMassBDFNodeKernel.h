@@ -24,12 +24,19 @@ namespace nalu{
 
 class Realm;
 
+/** Lumped BDF density time derivative of the pressure Poisson equation
+ *
+ *  With `includeGcl` the GCL source of a deforming mesh is assembled in the
+ *  same pass from the shared `gcl_factor` node field, in place of a separate
+ *  ContinuityGclNodeKernel.
+ */
 class ContinuityMassBDFNodeKernel : public NGPNodeKernel<ContinuityMassBDFNodeKernel>
 {
 public:
 
   ContinuityMassBDFNodeKernel(
-    const stk::mesh::BulkData&);
+    const stk::mesh::BulkData&,
+    const bool includeGcl = false);
 
   KOKKOS_DEFAULTED_FUNCTION
   ContinuityMassBDFNodeKernel() = default;
@@ -43,7 +50,8 @@ public:
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
   stk::mesh::NgpField<double> densityNm1_;
@@ -52,6 +60,7 @@ private:
   stk::mesh::NgpField<double> dnvNp1_;
   stk::mesh::NgpField<double> dnvN_;
   stk::mesh::NgpField<double> dnvNm1_;
+  stk::mesh::NgpField<double> gclFactor_;
 
 
   unsigned densityNm1ID_ {stk::mesh::InvalidOrdinal};
@@ -60,10 +69,12 @@ private:
   unsigned dnvNp1ID_ {stk::mesh::InvalidOrdinal}; //dual nodal volume
   unsigned dnvNID_ {stk::mesh::InvalidOrdinal}; //dual nodal volume
   unsigned dnvNm1ID_ {stk::mesh::InvalidOrdinal}; //dual nodal volume
+  unsigned gclFactorID_ {stk::mesh::InvalidOrdinal};
 
 
   double dt_;
   double gamma1_, gamma2_, gamma3_;
+  bool includeGcl_{false};
 
 };
 
@@ -42,18 +42,19 @@ public:
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
-  stk::mesh::NgpField<double> coordinates_;
+  stk::mesh::NgpField<int> heightIndex_;
+  stk::mesh::NgpField<double> heightWeight_;
   stk::mesh::NgpField<double> dualNodalVolume_;
 
   ABLScalarInterpolator ablSrc_;
 
-  unsigned coordinatesID_ {stk::mesh::InvalidOrdinal};
+  unsigned heightIndexID_ {stk::mesh::InvalidOrdinal};
+  unsigned heightWeightID_ {stk::mesh::InvalidOrdinal};
   unsigned dualNodalVolumeID_ {stk::mesh::InvalidOrdinal};
-
-  const int nDim_;
 };
 
 }  // nalu
@@ -0,0 +1,64 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef ENTHALPYPRESSUREWORKNODEKERNEL_H
+#define ENTHALPYPRESSUREWORKNODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+
+/** Pressure work, u_j dp/dx_j, in the enthalpy equation
+ */
+class EnthalpyPressureWorkNodeKernel : public NGPNodeKernel<EnthalpyPressureWorkNodeKernel>
+{
+public:
+  EnthalpyPressureWorkNodeKernel(
+    const stk::mesh::BulkData&);
+
+  EnthalpyPressureWorkNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~EnthalpyPressureWorkNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME | NodeKernelData::VELOCITY;
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
+
+private:
+  stk::mesh::NgpField<double> dpdx_;
+
+  unsigned dpdxID_{stk::mesh::InvalidOrdinal};
+
+  const int nDim_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ENTHALPYPRESSUREWORKNODEKERNEL_H */
@@ -38,24 +38,47 @@ public:
 
   virtual void setup(Realm&) override;
 
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME;
+  }
+
   KOKKOS_FUNCTION
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
-  stk::mesh::NgpField<double> coordinates_;
-  stk::mesh::NgpField<double> dualNodalVolume_;
+  stk::mesh::NgpField<int> heightIndex_;
+  stk::mesh::NgpField<double> heightWeight_;
 
   ABLVectorInterpolator ablSrc_;
 
-  unsigned coordinatesID_ {stk::mesh::InvalidOrdinal};
-  unsigned dualNodalVolumeID_ {stk::mesh::InvalidOrdinal};
+  unsigned heightIndexID_ {stk::mesh::InvalidOrdinal};
+  unsigned heightWeightID_ {stk::mesh::InvalidOrdinal};
 
   const int nDim_;
 };
 
+KOKKOS_INLINE_FUNCTION void
+MomentumABLForceNodeKernel::execute(
+  NodeKernelTraits::LhsType&,
+  NodeKernelTraits::RhsType& rhs,
+  const stk::mesh::FastMeshIndex& node,
+  const NodeKernelData& data)
+{
+  NALU_ALIGNED NodeKernelTraits::DblType momSrc[NodeKernelTraits::NDimMax];
+
+  const NodeKernelTraits::DblType dualVol = data.dualVolume;
+
+  ablSrc_(heightIndex_.get(node, 0), heightWeight_.get(node, 0), momSrc);
+
+  for (int i=0; i < nDim_; ++i)
+    rhs(i) += dualVol * momSrc[i];
+}
+
 }  // nalu
 }  // sierra
 
@@ -37,7 +37,8 @@ public:
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
   stk::mesh::NgpField<double> dualNodalVolume_;
@@ -37,26 +37,46 @@ public:
 
   virtual void setup(Realm&) override;
 
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME;
+  }
+
   KOKKOS_FUNCTION
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
-  stk::mesh::NgpField<double> dualNodalVolume_;
   stk::mesh::NgpField<double> temperature_;
   const int nDim_;
   NodeKernelTraits::DblType tRef_;
   NodeKernelTraits::DblType rhoRef_;
   NodeKernelTraits::DblType beta_;
 
-  unsigned dualNodalVolumeID_ {stk::mesh::InvalidOrdinal};
   unsigned temperatureID_ {stk::mesh::InvalidOrdinal};
 
   NALU_ALIGNED NodeKernelTraits::DblType gravity_[NodeKernelTraits::NDimMax];
 };
 
+KOKKOS_INLINE_FUNCTION void
+MomentumBoussinesqNodeKernel::execute(
+  NodeKernelTraits::LhsType&,
+  NodeKernelTraits::RhsType& rhs,
+  const stk::mesh::FastMeshIndex& node,
+  const NodeKernelData& data)
+{
+  const NodeKernelTraits::DblType temperature = temperature_.get(node, 0);
+  const NodeKernelTraits::DblType dualVolume = data.dualVolume;
+  const double fac = -rhoRef_*beta_*(temperature - tRef_)*dualVolume;
+
+  for ( int i = 0; i < nDim_; ++i ) {
+    rhs(i) += fac*gravity_[i];
+  }
+}
+
 } // namespace nalu
 } // namespace Sierra
 
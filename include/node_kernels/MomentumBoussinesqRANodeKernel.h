@@ -0,0 +1,74 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef MOMENTUMBOUSSINESQRANODEKERNEL_H
+#define MOMENTUMBOUSSINESQRANODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class SolutionOptions;
+
+/** Boussinesq buoyancy about the running average of the temperature,
+ *  -rhoRef beta (T - <T>) g
+ */
+class MomentumBoussinesqRANodeKernel : public NGPNodeKernel<MomentumBoussinesqRANodeKernel>
+{
+public:
+  MomentumBoussinesqRANodeKernel(
+    const stk::mesh::BulkData&,
+    const SolutionOptions&);
+
+  MomentumBoussinesqRANodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~MomentumBoussinesqRANodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME;
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
+
+private:
+  stk::mesh::NgpField<double> temperature_;
+
+  unsigned temperatureID_{stk::mesh::InvalidOrdinal};
+
+  stk::mesh::NgpField<double> raTemperature_;
+  unsigned raTemperatureID_{stk::mesh::InvalidOrdinal};
+
+  const int nDim_;
+  NodeKernelTraits::DblType rhoRef_;
+  NodeKernelTraits::DblType beta_;
+
+  NALU_ALIGNED NodeKernelTraits::DblType gravity_[NodeKernelTraits::NDimMax];
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MOMENTUMBOUSSINESQRANODEKERNEL_H */
@@ -0,0 +1,65 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef MOMENTUMBUOYANCYNODEKERNEL_H
+#define MOMENTUMBUOYANCYNODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class SolutionOptions;
+
+/** Buoyancy from the variable density, (rho - rhoRef) g
+ */
+class MomentumBuoyancyNodeKernel : public NGPNodeKernel<MomentumBuoyancyNodeKernel>
+{
+public:
+  MomentumBuoyancyNodeKernel(
+    const stk::mesh::BulkData&,
+    const SolutionOptions&);
+
+  MomentumBuoyancyNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~MomentumBuoyancyNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME | NodeKernelData::DENSITY;
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
+
+private:
+  const int nDim_;
+  NodeKernelTraits::DblType rhoRef_;
+
+  NALU_ALIGNED NodeKernelTraits::DblType gravity_[NodeKernelTraits::NDimMax];
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MOMENTUMBUOYANCYNODEKERNEL_H */
@@ -38,24 +38,78 @@ public:
 
   virtual void setup(Realm&) override;
 
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME | NodeKernelData::DENSITY |
+           NodeKernelData::VELOCITY;
+  }
+
   KOKKOS_FUNCTION
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
   const CoriolisSrc cor_;
 
-  stk::mesh::NgpField<double> dualNodalVolume_;
-  stk::mesh::NgpField<double> densityNp1_;
-  stk::mesh::NgpField<double> velocityNp1_;
 
-  unsigned dualNodalVolumeID_ {stk::mesh::InvalidOrdinal};
-  unsigned densityNp1ID_ {stk::mesh::InvalidOrdinal};
-  unsigned velocityNp1ID_ {stk::mesh::InvalidOrdinal};
 };
 
+KOKKOS_INLINE_FUNCTION void
+MomentumCoriolisNodeKernel::execute(
+  NodeKernelTraits::LhsType& lhs,
+  NodeKernelTraits::RhsType& rhs,
+  const stk::mesh::FastMeshIndex&,
+  const NodeKernelData& data)
+{
+  const NodeKernelTraits::DblType* vel = data.velocity;
+  NodeKernelTraits::DblType rhoNp1 = data.density;
+  NodeKernelTraits::DblType dualVol = data.dualVolume;
+
+  // calculate the velocity vector in east-north-up coordinates
+  const NodeKernelTraits::DblType ue = cor_.eastVector_[0] * vel[0] +
+                                       cor_.eastVector_[1] * vel[1] +
+                                       cor_.eastVector_[2] * vel[2];
+  const NodeKernelTraits::DblType un = cor_.northVector_[0] * vel[0] +
+                                       cor_.northVector_[1] * vel[1] +
+                                       cor_.northVector_[2] * vel[2];
+  const NodeKernelTraits::DblType uu = cor_.upVector_[0] * vel[0] +
+                                       cor_.upVector_[1] * vel[1] +
+                                       cor_.upVector_[2] * vel[2];
+
+  // calculate acceleration in east-north-up coordinates
+  const NodeKernelTraits::DblType ae =
+    cor_.corfac_ * (un * cor_.sinphi_ - uu * cor_.cosphi_);
+  const NodeKernelTraits::DblType an = -cor_.corfac_ * ue * cor_.sinphi_;
+  const NodeKernelTraits::DblType au = cor_.corfac_ * ue * cor_.cosphi_;
+
+  // calculate acceleration in model x-y-z coordinates
+  const NodeKernelTraits::DblType ax = ae * cor_.eastVector_[0] +
+                                       an * cor_.northVector_[0] +
+                                       au * cor_.upVector_[0];
+  const NodeKernelTraits::DblType ay = ae * cor_.eastVector_[1] +
+                                       an * cor_.northVector_[1] +
+                                       au * cor_.upVector_[1];
+  const NodeKernelTraits::DblType az = ae * cor_.eastVector_[2] +
+                                       an * cor_.northVector_[2] +
+                                       au * cor_.upVector_[2];
+
+  const double fac2 = rhoNp1 * dualVol;
+  rhs(0) += fac2*ax;
+  rhs(1) += fac2*ay;
+  rhs(2) += fac2*az;
+
+  // Only the off-diagonal LHS entries are non-zero
+  lhs(0, 1) += fac2*cor_.Jxy_;
+  lhs(0, 2) += fac2*cor_.Jxz_;
+  lhs(1, 0) -= fac2*cor_.Jxy_; // Jyx = - Jxy
+  lhs(1, 2) += fac2*cor_.Jyz_;
+  lhs(2, 0) -= fac2*cor_.Jxz_; // Jzx = - Jxz
+  lhs(2, 1) -= fac2*cor_.Jyz_; // Jzy = - Jyz
+}
+
 }  // nalu
 }  // sierra
 
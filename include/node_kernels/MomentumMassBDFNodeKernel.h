@@ -25,11 +25,18 @@ namespace nalu{
 
 class Realm;
 
+/** Lumped BDF time derivative of the momentum
+ *
+ *  With `includeGcl` the GCL source of a deforming mesh is assembled in the
+ *  same pass from the shared `gcl_factor` node field, in place of a separate
+ *  MomentumGclSrcNodeKernel.
+ */
 class MomentumMassBDFNodeKernel : public NGPNodeKernel<MomentumMassBDFNodeKernel>
 {
 public:
   MomentumMassBDFNodeKernel(
-    const stk::mesh::BulkData&);
+    const stk::mesh::BulkData&,
+    const bool includeGcl = false);
 
   KOKKOS_DEFAULTED_FUNCTION
   MomentumMassBDFNodeKernel() = default;
@@ -39,42 +46,79 @@ public:
 
   virtual void setup(Realm&) override;
 
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME | NodeKernelData::DENSITY |
+           NodeKernelData::VELOCITY;
+  }
+
   KOKKOS_FUNCTION
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
   stk::mesh::NgpField<double> velocityNm1_;
   stk::mesh::NgpField<double> velocityN_;
-  stk::mesh::NgpField<double> velocityNp1_;
   stk::mesh::NgpField<double> densityNm1_;
   stk::mesh::NgpField<double> densityN_;
-  stk::mesh::NgpField<double> densityNp1_;
   stk::mesh::NgpField<double> dpdx_;
-  stk::mesh::NgpField<double> dnvNp1_;
   stk::mesh::NgpField<double> dnvN_;
   stk::mesh::NgpField<double> dnvNm1_;
+  stk::mesh::NgpField<double> localDt_;
+  stk::mesh::NgpField<double> gclFactor_;
 
 
   unsigned velocityNm1ID_ {stk::mesh::InvalidOrdinal};
   unsigned velocityNID_ {stk::mesh::InvalidOrdinal};
-  unsigned velocityNp1ID_ {stk::mesh::InvalidOrdinal};
   unsigned densityNm1ID_ {stk::mesh::InvalidOrdinal};
   unsigned densityNID_ {stk::mesh::InvalidOrdinal};
-  unsigned densityNp1ID_ {stk::mesh::InvalidOrdinal};
   unsigned dpdxID_ {stk::mesh::InvalidOrdinal};
-  unsigned dnvNp1ID_ {stk::mesh::InvalidOrdinal};
   unsigned dnvNID_ {stk::mesh::InvalidOrdinal};
   unsigned dnvNm1ID_ {stk::mesh::InvalidOrdinal};
+  unsigned localDtID_ {stk::mesh::InvalidOrdinal};
+  unsigned gclFactorID_ {stk::mesh::InvalidOrdinal};
   
   double dt_;
+  bool useLocalDt_{false};
+  bool includeGcl_{false};
   int nDim_;
   double gamma1_, gamma2_, gamma3_;
   
 };
 
+KOKKOS_INLINE_FUNCTION void
+MomentumMassBDFNodeKernel::execute(
+  NodeKernelTraits::LhsType& lhs,
+  NodeKernelTraits::RhsType& rhs,
+  const stk::mesh::FastMeshIndex& node,
+  const NodeKernelData& data)
+{
+  const int nDim = nDim_;
+
+  const NodeKernelTraits::DblType rhoNm1     = densityNm1_.get(node, 0);
+  const NodeKernelTraits::DblType rhoN       = densityN_.get(node, 0);
+  const NodeKernelTraits::DblType rhoNp1     = data.density;
+  const NodeKernelTraits::DblType dnvNp1     = data.dualVolume;
+  const NodeKernelTraits::DblType dnvN       = dnvN_.get(node, 0);
+  const NodeKernelTraits::DblType dnvNm1     = dnvNm1_.get(node, 0);  
+  const NodeKernelTraits::DblType dt         = useLocalDt_ ? localDt_.get(node, 0) : dt_;
+  const NodeKernelTraits::DblType lhsfac     = gamma1_*rhoNp1*dnvNp1/dt;
+  const NodeKernelTraits::DblType gclFac     = includeGcl_ ? rhoNp1*gclFactor_.get(node, 0)*dnvNp1 : 0.0;
+  // deal with lumped mass matrix (diagonal matrix)
+  for ( int i = 0; i < nDim; ++i ) {
+    const NodeKernelTraits::DblType uNm1   = velocityNm1_.get(node, i);
+    const NodeKernelTraits::DblType uN     = velocityN_.get(node, i);
+    const NodeKernelTraits::DblType uNp1   = data.velocity[i];
+    const NodeKernelTraits::DblType dpdx   = dpdx_.get(node, i);
+
+    rhs(i) += -(gamma1_*rhoNp1*uNp1*dnvNp1 + gamma2_*rhoN*uN*dnvN + gamma3_*rhoNm1*uNm1*dnvNm1)/dt - dpdx*dnvNp1 - gclFac*uNp1;
+    lhs(i, i) += lhsfac;
+  }
+}
+
 } // namespace nalu
 } // namespace Sierra
 
@@ -0,0 +1,56 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MOMENTUMNODEKERNELPACKS_H
+#define MOMENTUMNODEKERNELPACKS_H
+
+#include "node_kernels/NodeKernelPack.h"
+#include "node_kernels/MomentumABLForceNodeKernel.h"
+#include "node_kernels/MomentumBoussinesqNodeKernel.h"
+#include "node_kernels/MomentumCoriolisNodeKernel.h"
+#include "node_kernels/MomentumMassBDFNodeKernel.h"
+
+namespace sierra {
+namespace nalu {
+
+// momentum node kernel combinations of the atmospheric boundary layer cases,
+// in the order in which the kernels are registered
+#define MOMENTUM_NODE_KERNEL_PACK_BOUSSINESQ                            \
+  MomentumMassBDFNodeKernel, MomentumBoussinesqNodeKernel
+#define MOMENTUM_NODE_KERNEL_PACK_BOUSSINESQ_CORIOLIS                   \
+  MomentumMassBDFNodeKernel, MomentumBoussinesqNodeKernel,              \
+    MomentumCoriolisNodeKernel
+#define MOMENTUM_NODE_KERNEL_PACK_BOUSSINESQ_ABL                        \
+  MomentumMassBDFNodeKernel, MomentumBoussinesqNodeKernel,              \
+    MomentumABLForceNodeKernel
+#define MOMENTUM_NODE_KERNEL_PACK_BOUSSINESQ_CORIOLIS_ABL               \
+  MomentumMassBDFNodeKernel, MomentumBoussinesqNodeKernel,              \
+    MomentumCoriolisNodeKernel, MomentumABLForceNodeKernel
+
+#define INSTANTIATE_MOMENTUM_NODE_KERNEL_PACK(PackName)                 \
+  template class NodeKernelPack<PackName>;
+
+#define EXTERN_MOMENTUM_NODE_KERNEL_PACK(PackName)                      \
+  extern template class NodeKernelPack<PackName>;
+
+EXTERN_MOMENTUM_NODE_KERNEL_PACK(MOMENTUM_NODE_KERNEL_PACK_BOUSSINESQ)
+EXTERN_MOMENTUM_NODE_KERNEL_PACK(MOMENTUM_NODE_KERNEL_PACK_BOUSSINESQ_CORIOLIS)
+EXTERN_MOMENTUM_NODE_KERNEL_PACK(MOMENTUM_NODE_KERNEL_PACK_BOUSSINESQ_ABL)
+EXTERN_MOMENTUM_NODE_KERNEL_PACK(MOMENTUM_NODE_KERNEL_PACK_BOUSSINESQ_CORIOLIS_ABL)
+
+/** Fuse the momentum node kernels when they form one of the packs above
+ *
+ *  @return True if the kernels of the algorithm were replaced by a pack
+ */
+bool fuse_momentum_node_kernels(AssembleNGPNodeSolverAlgorithm& nodeAlg);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MOMENTUMNODEKERNELPACKS_H */
@@ -32,6 +32,27 @@ struct NodeKernelTraits
   using LhsType = SharedMemView<DblType**, ShmemType>;
 };
 
+/** Node state shared by the kernels of a node solver algorithm
+ *
+ *  The algorithm reads the quantities requested by any of its kernels once
+ *  per node and hands them to every kernel, so that kernels summing into the
+ *  same node do not gather the same field values again. Quantities are at
+ *  the new time level (NP1); only the requested members are set.
+ */
+struct NodeKernelData
+{
+  enum Gather : unsigned {
+    NONE = 0u,
+    DUAL_VOLUME = 1u << 0,
+    DENSITY = 1u << 1,
+    VELOCITY = 1u << 2
+  };
+
+  NodeKernelTraits::DblType dualVolume{0.0};
+  NodeKernelTraits::DblType density{0.0};
+  NodeKernelTraits::DblType velocity[NodeKernelTraits::NDimMax]{0.0, 0.0, 0.0};
+};
+
 class NodeKernel
 {
 public:
@@ -47,11 +68,15 @@ public:
 
   virtual void setup(Realm&) = 0;
 
+  //! NodeKernelData::Gather flags of the node state read by the kernel
+  virtual unsigned gathered_fields() const { return NodeKernelData::NONE; }
+
   KOKKOS_FUNCTION
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) = 0;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) = 0;
 };
 
 template<typename T>
@@ -66,8 +91,10 @@ public:
 
   virtual NodeKernel* create_on_device() final
   {
-    free_on_device();
-    deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    if (deviceCopy_ == nullptr)
+      deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    else
+      nalu_ngp::update<T>(deviceCopy_, *dynamic_cast<T*>(this));
     return deviceCopy_;
   }
 
@@ -0,0 +1,169 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NODEKERNELPACK_H
+#define NODEKERNELPACK_H
+
+#include "AssembleNGPNodeSolverAlgorithm.h"
+#include "node_kernels/NodeKernel.h"
+
+#include <memory>
+#include <typeinfo>
+#include <utility>
+
+namespace sierra {
+namespace nalu {
+
+namespace impl {
+
+//! Kernels of a pack held by value, executed in the order of the list
+template<typename... Kernels>
+struct NodeKernelList;
+
+template<>
+struct NodeKernelList<>
+{
+  void setup(Realm&) {}
+
+  unsigned gathered_fields() const { return NodeKernelData::NONE; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&)
+  {}
+};
+
+template<typename Kernel, typename... Rest>
+struct NodeKernelList<Kernel, Rest...>
+{
+  NodeKernelList(const Kernel& kernel, const Rest&... rest)
+    : kernel_(kernel), rest_(rest...)
+  {}
+
+  void setup(Realm& realm)
+  {
+    kernel_.setup(realm);
+    rest_.setup(realm);
+  }
+
+  unsigned gathered_fields() const
+  {
+    return kernel_.gathered_fields() | rest_.gathered_fields();
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute(
+    NodeKernelTraits::LhsType& lhs,
+    NodeKernelTraits::RhsType& rhs,
+    const stk::mesh::FastMeshIndex& node,
+    const NodeKernelData& data)
+  {
+    // qualified call, resolved at compile time and inlined
+    kernel_.Kernel::execute(lhs, rhs, node, data);
+    rest_.execute(lhs, rhs, node, data);
+  }
+
+  Kernel kernel_;
+  NodeKernelList<Rest...> rest_;
+};
+
+} // namespace impl
+
+/** Statically typed sequence of node kernels
+ *
+ *  The pack is a single node kernel: the algorithm dispatches to it once per
+ *  node and the pack calls its kernels directly, in order, so that their
+ *  execute bodies are inlined into one loop. The kernels must define their
+ *  execute method in the header. Packs are explicitly instantiated for the
+ *  common kernel combinations, see MomentumNodeKernelPacks.C.
+ */
+template<typename... Kernels>
+class NodeKernelPack : public NGPNodeKernel<NodeKernelPack<Kernels...>>
+{
+public:
+  NodeKernelPack(const Kernels&... kernels) : kernels_(kernels...) {}
+
+  NodeKernelPack() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~NodeKernelPack() = default;
+
+  virtual void setup(Realm& realm) override { kernels_.setup(realm); }
+
+  virtual unsigned gathered_fields() const override
+  {
+    return kernels_.gathered_fields();
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType& lhs,
+    NodeKernelTraits::RhsType& rhs,
+    const stk::mesh::FastMeshIndex& node,
+    const NodeKernelData& data) override
+  {
+    kernels_.execute(lhs, rhs, node, data);
+  }
+
+private:
+  impl::NodeKernelList<Kernels...> kernels_;
+};
+
+namespace impl {
+
+template<typename Kernel>
+bool is_kernel_type(const NodeKernel* kernel)
+{
+  return typeid(*kernel) == typeid(Kernel);
+}
+
+template<typename... Kernels, size_t... I>
+bool fuse_node_kernels(
+  AssembleNGPNodeSolverAlgorithm::NodeKernelVecType& kernels,
+  std::index_sequence<I...>)
+{
+  if (kernels.size() != sizeof...(Kernels))
+    return false;
+
+  const bool match[] = {true, is_kernel_type<Kernels>(kernels[I].get())...};
+  for (const bool m : match)
+    if (!m)
+      return false;
+
+  auto pack = std::make_unique<NodeKernelPack<Kernels...>>(
+    static_cast<const Kernels&>(*kernels[I])...);
+  kernels.clear();
+  kernels.push_back(std::move(pack));
+  return true;
+}
+
+} // namespace impl
+
+/** Replace the kernels of a node algorithm by a pack of the same kernels
+ *
+ *  The kernels registered with the algorithm must be exactly of the pack
+ *  types, in the same order; otherwise the algorithm is left untouched.
+ *  Called after the kernels are registered and before the first execution.
+ *
+ *  @return True if the kernels were fused
+ */
+template<typename... Kernels>
+bool fuse_node_kernels(AssembleNGPNodeSolverAlgorithm& nodeAlg)
+{
+  return impl::fuse_node_kernels<Kernels...>(
+    nodeAlg.node_kernels(), std::index_sequence_for<Kernels...>());
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NODEKERNELPACK_H */
@@ -13,6 +13,7 @@
 
 #include "node_kernels/NodeKernel.h"
 #include "FieldTypeDef.h"
+#include "utils/MixedPrecisionField.h"
 
 #include "stk_mesh/base/BulkData.hpp"
 #include "stk_mesh/base/Ngp.hpp"
@@ -41,7 +42,8 @@ public:
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
   stk::mesh::NgpField<double> tke_;
@@ -53,7 +55,7 @@ private:
   stk::mesh::NgpField<double> dwdx_;
   stk::mesh::NgpField<double> dualNodalVolume_;
   stk::mesh::NgpField<double> fOneBlend_;
-  stk::mesh::NgpField<double> cellLengthScale_;
+  MixedPrecisionNgpField cellLengthScale_;
 
 
   unsigned tkeID_             {stk::mesh::InvalidOrdinal};
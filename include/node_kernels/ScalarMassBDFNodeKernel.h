@@ -24,12 +24,19 @@ namespace nalu{
 
 class Realm;
 
+/** Lumped BDF time derivative of a transported scalar
+ *
+ *  With `includeGcl` the GCL source of a deforming mesh is assembled in the
+ *  same pass from the shared `gcl_factor` node field, in place of a separate
+ *  ScalarGclNodeKernel.
+ */
 class ScalarMassBDFNodeKernel : public NGPNodeKernel<ScalarMassBDFNodeKernel>
 {
 public:
   ScalarMassBDFNodeKernel(
     const stk::mesh::BulkData&,
-    ScalarFieldType*);
+    ScalarFieldType*,
+    const bool includeGcl = false);
 
   KOKKOS_DEFAULTED_FUNCTION
   ScalarMassBDFNodeKernel() = default;
@@ -43,7 +50,8 @@ public:
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
   stk::mesh::NgpField<double> scalarQNm1_;
@@ -55,6 +63,8 @@ private:
   stk::mesh::NgpField<double> dnvNp1_;
   stk::mesh::NgpField<double> dnvN_;
   stk::mesh::NgpField<double> dnvNm1_;
+  stk::mesh::NgpField<double> localDt_;
+  stk::mesh::NgpField<double> gclFactor_;
 
   unsigned scalarQNm1ID_ {stk::mesh::InvalidOrdinal};
   unsigned scalarQNID_ {stk::mesh::InvalidOrdinal};
@@ -65,8 +75,12 @@ private:
   unsigned dnvNp1ID_ {stk::mesh::InvalidOrdinal};
   unsigned dnvNID_ {stk::mesh::InvalidOrdinal};
   unsigned dnvNm1ID_ {stk::mesh::InvalidOrdinal};
+  unsigned localDtID_ {stk::mesh::InvalidOrdinal};
+  unsigned gclFactorID_ {stk::mesh::InvalidOrdinal};
 
   double dt_;
+  bool useLocalDt_{false};
+  bool includeGcl_{false};
   double gamma1_, gamma2_, gamma3_;
 };
 
@@ -13,6 +13,7 @@
 
 #include "node_kernels/NodeKernel.h"
 #include "FieldTypeDef.h"
+#include "utils/MixedPrecisionField.h"
 
 #include "stk_mesh/base/BulkData.hpp"
 #include "stk_mesh/base/Ngp.hpp"
@@ -40,7 +41,8 @@ public:
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
   stk::mesh::NgpField<double> tke_;
@@ -49,7 +51,7 @@ private:
   stk::mesh::NgpField<double> tvisc_;
   stk::mesh::NgpField<double> dudx_;
   stk::mesh::NgpField<double> dualNodalVolume_;
-  stk::mesh::NgpField<double> maxLenScale_;
+  MixedPrecisionNgpField maxLenScale_;
   stk::mesh::NgpField<double> fOneBlend_;
 
   unsigned tkeID_             {stk::mesh::InvalidOrdinal};
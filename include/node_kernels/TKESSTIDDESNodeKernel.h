@@ -10,6 +10,7 @@
 
 #include "node_kernels/NodeKernel.h"
 #include "FieldTypeDef.h"
+#include "utils/MixedPrecisionField.h"
 
 #include "stk_mesh/base/BulkData.hpp"
 #include "stk_mesh/base/Ngp.hpp"
@@ -35,7 +36,8 @@ public:
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
   stk::mesh::NgpField<double> tke_;
@@ -46,7 +48,7 @@ private:
   stk::mesh::NgpField<double> dudx_;
   stk::mesh::NgpField<double> wallDist_;
   stk::mesh::NgpField<double> dualNodalVolume_;
-  stk::mesh::NgpField<double> maxLenScale_;
+  MixedPrecisionNgpField maxLenScale_;
   stk::mesh::NgpField<double> fOneBlend_;
   stk::mesh::NgpField<double> ransIndicator_;
 
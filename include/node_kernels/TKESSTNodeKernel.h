@@ -38,7 +38,8 @@ public:
   virtual void execute(
     NodeKernelTraits::LhsType&,
     NodeKernelTraits::RhsType&,
-    const stk::mesh::FastMeshIndex&) override;
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
 
 private:
   stk::mesh::NgpField<double> tke_;
@@ -47,6 +48,7 @@ private:
   stk::mesh::NgpField<double> tvisc_;
   stk::mesh::NgpField<double> dudx_;
   stk::mesh::NgpField<double> dualNodalVolume_;
+  stk::mesh::NgpField<double> strainVort_;
 
   unsigned tkeID_{stk::mesh::InvalidOrdinal};
   unsigned sdrID_{stk::mesh::InvalidOrdinal};
@@ -54,11 +56,14 @@ private:
   unsigned tviscID_{stk::mesh::InvalidOrdinal};
   unsigned dudxID_{stk::mesh::InvalidOrdinal};
   unsigned dualNodalVolumeID_{stk::mesh::InvalidOrdinal};
+  unsigned strainVortID_{stk::mesh::InvalidOrdinal};
 
   NodeKernelTraits::DblType betaStar_;
   NodeKernelTraits::DblType tkeProdLimitRatio_;
   NodeKernelTraits::DblType relaxFac_;
 
+  bool useStrainVort_{false};
+
   const int nDim_;
 };
 
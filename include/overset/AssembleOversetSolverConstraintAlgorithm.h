@@ -41,6 +41,11 @@ public:
   virtual void execute();
 
 private:
+  /** Write the constraint rows from the flattened stencils of the overset
+   *  manager, without host row construction
+   */
+  void execute_on_device(const double tauScale);
+
   AssembleOversetSolverConstraintAlgorithm() = delete;
   AssembleOversetSolverConstraintAlgorithm(
     const AssembleOversetSolverConstraintAlgorithm&) = delete;
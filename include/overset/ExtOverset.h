@@ -21,6 +21,7 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
+class OversetManager;
 
 class ExtOverset
 {
@@ -46,6 +47,14 @@ public:
   //! Update solution fields using TIOGA
   void exchange_solution();
 
+  /** Update solution fields for a sub-step of sub-cycled realms
+   *
+   *  The overset fields of `heldRealms`, which have completed the time step,
+   *  are interpolated in time to the fraction `theta` of the step between
+   *  states N and N+1 for the exchange, and restored afterwards.
+   */
+  void exchange_solution(const std::vector<Realm*>& heldRealms, const double theta);
+
   //! Register meshes to TIOGA to perform overset connectivity with external meshes
   void pre_overset_conn_work();
 
@@ -72,6 +81,9 @@ private:
   std::vector<tioga_nalu::TiogaSTKIface*> tgIfaceVec_;
 #endif
 
+  //! Overset managers that determine connectivity without TIOGA
+  std::vector<OversetManager*> nativeMgrVec_;
+
   std::vector<std::string> slnFieldNames_;
 
   //! Flag indicating whether we are interfacing external solver
@@ -39,6 +39,7 @@ namespace nalu {
 
 class Realm;
 class OversetInfo;
+class PartitionWeights;
 
 /** Base class for Overset connectivity manager
  *
@@ -47,6 +48,22 @@ class OversetManager
 {
 public:
   using EntityList = Kokkos::View<stk::mesh::Entity*, Kokkos::LayoutRight, MemSpace>;
+  using IntList = Kokkos::View<int*, Kokkos::LayoutRight, MemSpace>;
+  using DoubleList = Kokkos::View<double*, Kokkos::LayoutRight, MemSpace>;
+
+  /** Flattened {fringe node, donor element} pairs of the locally owned
+   *  fringe nodes
+   *
+   *  The donor nodes and shape function weights of fringe node `i` are in
+   *  [donorOffsets_(i), donorOffsets_(i+1)).
+   */
+  struct ConstraintStencils
+  {
+    EntityList fringeNodes_;
+    IntList donorOffsets_;
+    EntityList donorNodes_;
+    DoubleList donorWeights_;
+  };
 
   OversetManager(Realm& realm);
 
@@ -86,6 +103,28 @@ public:
 
   virtual void reset_data_structures();
 
+  /** The iso-parametric coordinates of the pairs changed without a new
+   *  connectivity, e.g., when the donors of the previous step are reused
+   */
+  void connectivity_changed() { ++connectivityEpoch_; }
+
+  /** Device stencils of the overset constraint rows
+   *
+   *  Flattened from oversetInfoVec_ on the first call after a connectivity
+   *  update and reused by every assembly until the next one.
+   */
+  const ConstraintStencils& constraint_stencils();
+
+  //! Bytes of the hole, fringe and receptor data on this rank
+  virtual size_t memory_bytes() const;
+
+  /** Register the fringe and donor zones in the initial decomposition weights
+   *
+   *  Called after the mesh is read and before it is balanced; the default
+   *  adds nothing.
+   */
+  virtual void add_partition_weights(PartitionWeights&, const double) {}
+
   Realm& realm_;
 
   stk::mesh::MetaData* metaData_{nullptr};
@@ -114,6 +153,14 @@ private:
   OversetManager() = delete;
   OversetManager(const OversetManager&) = delete;
 
+  ConstraintStencils stencils_;
+
+  //! Incremented whenever the pairs of oversetInfoVec_ change
+  unsigned connectivityEpoch_{0};
+
+  //! Epoch stencils_ were built from; behind connectivityEpoch_ if stale
+  unsigned stencilsEpoch_{0};
+
 };
 
 } // nalu
@@ -0,0 +1,165 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef OVERSETMANAGERNATIVE_H
+#define OVERSETMANAGERNATIVE_H
+
+#include "overset/OversetManager.h"
+#include "FieldTypeDef.h"
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <mpi.h>
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+struct OversetUserData;
+
+/** Overset connectivity without a third-party library
+ *
+ *  Lightweight alternative to OversetManagerTIOGA for one background mesh and
+ *  any number of non-overlapping interior (near-body) meshes, intended for
+ *  decoupled overset solves in NGP builds.
+ *
+ *  Connectivity is determined every time the mesh moves:
+ *
+ *  - background nodes inside an interior mesh element are flagged as covered
+ *    through a bounding box pre-filter and a fine search in the elements of
+ *    the ranks that may contain them;
+ *
+ *  - an iblank flood fill on device marks the uncovered background nodes
+ *    reachable from outside the interior meshes as field nodes (nodes
+ *    enclosed by the interior meshes, e.g., inside a solid body, become
+ *    holes); the covered nodes are then peeled in layers, the first
+ *    `num_overlap_layers` remain field nodes, the next `num_fringe_layers`
+ *    become fringe nodes and the rest are holes;
+ *
+ *  - every fringe node (the exterior boundary of the interior meshes and the
+ *    background fringe) is located in a donor element on whichever rank owns
+ *    it, and the shape function weights are stored on that rank.
+ *
+ *  Fringe updates are device gathers over the stored stencils. Only the
+ *  compact buffer of interpolated values is exchanged between the donor and
+ *  receptor ranks, so no donor elements are ghosted.
+ */
+class OversetManagerNative : public OversetManager
+{
+public:
+  OversetManagerNative(Realm&, const OversetUserData&);
+
+  virtual ~OversetManagerNative();
+
+  virtual void setup() override;
+
+  virtual void initialize() override;
+
+  virtual void execute(const bool isDecoupled) override;
+
+  virtual void add_partition_weights(
+    PartitionWeights& weights, const double weight) override;
+
+  virtual void overset_update_fields(
+    const std::vector<OversetFieldData>&) override;
+
+  virtual void overset_update_field(
+    stk::mesh::FieldBase* field, const int nrows = 1, const int ncols = 1,
+    const bool doFinalSyncToDevice = true) override;
+
+  virtual size_t memory_bytes() const override;
+
+  /// Instance holding all the data from input files
+  const OversetUserData& oversetUserData_;
+
+private:
+  OversetManagerNative() = delete;
+  OversetManagerNative(const OversetManagerNative&) = delete;
+
+  /** Update the background iblanks from the covered node flags
+   *
+   *  \param covered Covered flag of every background node in backgroundNodes
+   *  \param seeded  Background nodes known to be outside the interior meshes
+   */
+  void cut_holes(
+    const std::vector<stk::mesh::Entity>& backgroundNodes,
+    const std::vector<char>& covered,
+    const std::vector<char>& seeded);
+
+  /** Locate fringe nodes and append their stencils
+   *
+   *  \param receptors Fringe nodes on this rank
+   *  \param donors Locally owned elements that may serve as donors
+   */
+  void add_receptors(
+    const std::vector<stk::mesh::Entity>& receptors,
+    const std::vector<stk::mesh::Entity>& donors);
+
+  //! Copy the stencils and the exchange plan to their final layout
+  void finalize_stencils();
+
+  //! Copy the hole and fringe lists and iblanks to device
+  void sync_iblanks();
+
+  /** Size the exchange buffers for nComp values per receptor and create
+   *  the persistent requests over them
+   */
+  void init_exchange(const int nComp);
+
+  void free_exchange();
+
+  stk::mesh::PartVector backgroundParts_;
+  stk::mesh::PartVector oversetParts_;
+  stk::mesh::PartVector oversetSurfaceParts_;
+
+  //! Flood fill state of the background nodes
+  ScalarIntFieldType* cutMask_{nullptr};
+
+  //! Stencil rows being assembled for each receptor rank
+  std::vector<std::vector<stk::mesh::Entity>> pendingDonors_;
+  std::vector<std::vector<double>> pendingIsoPar_;
+
+  //! Receptor nodes being assembled for each donor rank
+  std::vector<std::vector<stk::mesh::Entity>> pendingReceptors_;
+
+  int maxNodes_{1};
+  Kokkos::View<stk::mesh::Entity**, Kokkos::LayoutRight, MemSpace> stencilNodes_;
+  Kokkos::View<double**, Kokkos::LayoutRight, MemSpace> stencilWeights_;
+  Kokkos::View<int*, MemSpace> stencilSize_;
+
+  //! Receptor nodes in the order of the received values
+  Kokkos::View<stk::mesh::Entity*, MemSpace> receptorNodes_;
+
+  Kokkos::View<double*, MemSpace> sendValues_;
+  Kokkos::View<double*, MemSpace> recvValues_;
+  Kokkos::View<double*, MemSpace>::HostMirror hostSend_;
+  Kokkos::View<double*, MemSpace>::HostMirror hostRecv_;
+
+  //! Stencil rows sent to and receptor values received from each rank
+  std::vector<int> sendCounts_, sendDispls_;
+  std::vector<int> recvCounts_, recvDispls_;
+
+  /** Persistent receives then sends with the ranks exchanging values
+   *
+   *  Created for the number of values per receptor of the last update and
+   *  kept until that number or the stencils change, so repeated updates of
+   *  the same fields, e.g., the decoupled overset correctors, only start
+   *  and complete the requests.
+   */
+  std::vector<MPI_Request> exchangeRequests_;
+  int exchangeComp_{0};
+};
+
+}  // nalu
+}  // sierra
+
+#endif /* OVERSETMANAGERNATIVE_H */
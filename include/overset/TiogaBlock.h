@@ -147,8 +147,11 @@ public:
    *
    *  Updates to mesh connectivity information will require a call to
    *  TiogaBlock::update_connectivity() instead.
+   *
+   *  \param updateResolutions If false, the nodal resolutions from the
+   *  previous call are kept (valid when the mesh motion is rigid)
    */
-  void update_coords();
+  void update_coords(const bool updateResolutions = true);
 
   /** Perform full update including connectivity
    *
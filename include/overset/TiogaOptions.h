@@ -59,6 +59,30 @@ public:
   double cell_res_mult() const { return cellResMult_; }
   double node_res_mult() const { return nodeResMult_; }
 
+  /** Reuse the previous connectivity for rigid-body mesh motion
+   *
+   *  If true and the mesh does not deform, the element volumes and resolutions
+   *  are only computed once, and the {receptor, donor} pairs of the previous
+   *  step are revalidated instead of repeating the TIOGA search whenever all
+   *  receptors are still within their donor elements.
+   */
+  bool incremental_connectivity() const { return incrementalConn_; }
+
+  //! Maximum number of consecutive steps that reuse the connectivity
+  int max_connectivity_reuse() const { return maxConnReuse_; }
+
+  //! Allowed iso-parametric distance beyond the donor element on reuse
+  double donor_reuse_tolerance() const { return donorReuseTol_; }
+
+  /** Number of connectivity updates a donor element stays ghosted after it
+   *  stopped being a donor for a receptor rank
+   *
+   *  Donors at the edge of the overlap flip in and out of the donor set as
+   *  the meshes move; keeping them ghosted for a few updates avoids a STK
+   *  modification cycle each time they return.
+   */
+  int ghost_retention() const { return ghostRetention_; }
+
 private:
   double cellResMult_{1.0};
   double nodeResMult_{1.0};
@@ -99,6 +123,18 @@ private:
   //! Flag indicating whether the node/cell resolutions should be adjusted for
   //! mandatory fringes
   bool adjustResolutionsForFringes_{true};
+
+  //! Reuse connectivity between full searches for rigid-body motion
+  bool incrementalConn_{false};
+
+  //! Number of steps after which a full TIOGA search is forced
+  int maxConnReuse_{4};
+
+  //! Tolerance on the iso-parametric distance of reused donors
+  double donorReuseTol_{1.0e-8};
+
+  //! Connectivity updates that stale donor ghosts are kept for
+  int ghostRetention_{0};
 };
 
 }
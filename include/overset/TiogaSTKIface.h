@@ -12,6 +12,7 @@
 #include "overset/OversetFieldData.h"
 
 #include <vector>
+#include <map>
 #include <memory>
 #include <array>
 
@@ -74,6 +75,18 @@ public:
 
   void post_connectivity_work(const bool isDecoupled = true);
 
+  /** Attempt to reuse the connectivity from the previous step
+   *
+   *  Only possible with the incremental_connectivity option, rigid-body mesh
+   *  motion and non-decoupled solves, where the constraint rows are built from
+   *  the OversetInfo pairs. The iso-parametric coordinates of every receptor
+   *  are recomputed within its previous donor element; the pairs are kept
+   *  only if all receptors on all ranks are still inside their donors.
+   *
+   *  \return True if the TIOGA connectivity search can be skipped
+   */
+  bool reuse_connectivity(const bool isDecoupled);
+
   int register_solution(const std::vector<sierra::nalu::OversetFieldData>&);
 
   void update_solution(const std::vector<sierra::nalu::OversetFieldData>&);
@@ -98,6 +111,11 @@ private:
    */
   void update_ghosting();
 
+  /** Add the current send ghosts that were donors within the last
+   *  TiogaOptions::ghost_retention() updates to the elements to ghost
+   */
+  void retain_send_ghosts(const stk::mesh::EntityProcVec& currentSendGhosts);
+
   /** Reset all connectivity data structures when recomputing connectivity
    */
   void reset_data_structures();
@@ -144,6 +162,13 @@ private:
   //! MPI ranks
   stk::mesh::EntityProcVec elemsToGhost_;
 
+  //! Last ghosting update at which each {donor element, receptor rank} pair
+  //! was needed; only tracked with ghost retention
+  std::map<std::pair<stk::mesh::EntityKey, int>, int> ghostLastNeeded_;
+
+  //! Number of overset ghosting updates
+  int numGhostUpdates_{0};
+
   //! List of receptor nodes that are shared entities across MPI ranks. This
   //! information is used to synchronize the field vs. fringe point status for
   //! these shared nodes across processor boundaries.
@@ -156,6 +181,18 @@ private:
 
   //! Name of the coordinates field (for moving mesh simulations)
   std::string coordsName_;
+
+  //! Mesh motion does not deform the elements
+  bool rigidMotion_{false};
+
+  //! Element and node resolutions registered with TIOGA are current
+  bool resolutionsCurrent_{false};
+
+  //! A full connectivity has been computed since the last mesh update
+  bool hasConnectivity_{false};
+
+  //! Number of consecutive steps that reused the connectivity
+  int numReuseSteps_{0};
 };
 
 
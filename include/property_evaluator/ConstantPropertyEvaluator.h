@@ -33,6 +33,14 @@ class ConstantPropertyEvaluator : public PropertyEvaluator
   double execute(double *indVarList,
                  stk::mesh::Entity node);
 
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
+
+  bool temperature_polynomial(PolynomialTFunctor& functor) override;
+
   double value_;
 
 };
@@ -46,6 +46,14 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
+
+  bool temperature_polynomial(PolynomialTFunctor& functor) override;
+
   double compute_h_rt(
       const double &T,
       const double *pt_poly);
@@ -94,6 +102,14 @@ public:
     double *indVarList,
     stk::mesh::Entity node);
 
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
+
+  bool temperature_polynomial(PolynomialTFunctor& functor) override;
+
   double specificHeat_;
   double referenceTemperature_;
 
@@ -41,6 +41,12 @@ public:
   double execute(
     double *indVarList,
     stk::mesh::Entity node);
+
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
   
   const double pRef_;
   const double R_;
@@ -13,12 +13,17 @@
 #define PropertyEvaluator_h
 
 #include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/NgpField.hpp>
+#include <stk_mesh/base/NgpMesh.hpp>
+#include <stk_mesh/base/Selector.hpp>
 
 #include <vector>
 
 namespace sierra{
 namespace nalu{
 
+struct PolynomialTFunctor;
+
 class PropertyEvaluator
 {
 public:
@@ -29,7 +34,34 @@ public:
   virtual double execute(
     double *indVarList,
     stk::mesh::Entity node = stk::mesh::Entity()) = 0;
-  
+
+  /** Evaluate the property at every selected node on device from the single
+   *  independent variable `indVar`
+   *
+   *  Returns false, without touching `prop`, for evaluators that only
+   *  provide the host execute()
+   */
+  virtual bool ngp_execute(
+    const stk::mesh::NgpMesh& /* ngpMesh */,
+    const stk::mesh::Selector& /* sel */,
+    const stk::mesh::NgpField<double>& /* indVar */,
+    stk::mesh::NgpField<double>& /* prop */)
+  {
+    return false;
+  }
+
+  /** Fill the default constructed `functor` with the coefficients of the
+   *  property as a polynomial in temperature, for the evaluators that are
+   *  one; device kernels evaluate it pointwise, e.g., the inversion of
+   *  enthalpy for temperature
+   *
+   *  Returns false, without touching `functor`, otherwise
+   */
+  virtual bool temperature_polynomial(PolynomialTFunctor& /* functor */)
+  {
+    return false;
+  }
+
 };
 
 } // namespace nalu
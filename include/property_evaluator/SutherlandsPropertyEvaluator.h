@@ -43,6 +43,12 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
   
   double compute_viscosity(
       const double &T,
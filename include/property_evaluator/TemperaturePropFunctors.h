@@ -0,0 +1,205 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TemperaturePropFunctors_h
+#define TemperaturePropFunctors_h
+
+#include "KokkosInterface.h"
+#include "ngp_utils/NgpLoopUtils.h"
+#include "ngp_utils/NgpReduceUtils.h"
+
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/NgpMesh.hpp"
+#include "stk_math/StkMath.hpp"
+
+#include <limits>
+
+namespace sierra {
+namespace nalu {
+
+/** Device-callable property evaluators of temperature only
+ *
+ *  Each functor is a plain value type holding the evaluator coefficients,
+ *  copied by value into the kernel launched by ngp_temperature_property. The
+ *  reference-composition evaluators fold the species sum into the functor
+ *  coefficients at construction on the host.
+ */
+
+//! Property `factor_/T`; ideal gas density at fixed pressure and composition
+struct IdealGasTFunctor
+{
+  double factor_{0.0};
+
+  KOKKOS_INLINE_FUNCTION
+  double operator()(const double T) const { return factor_ / T; }
+};
+
+//! Polynomial of degree up to five in T, with separate low/high T ranges
+struct PolynomialTFunctor
+{
+  static constexpr int numCoeffs = 6;
+
+  //! Coefficients of T^j used below tSwitch_
+  Kokkos::Array<double, numCoeffs> low_;
+
+  //! Coefficients of T^j used at and above tSwitch_
+  Kokkos::Array<double, numCoeffs> high_;
+
+  double tSwitch_{std::numeric_limits<double>::max()};
+
+  PolynomialTFunctor()
+  {
+    for (int j = 0; j < numCoeffs; ++j) {
+      low_[j] = 0.0;
+      high_[j] = 0.0;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double operator()(const double T) const
+  {
+    const auto& c = (T < tSwitch_) ? low_ : high_;
+    double value = c[numCoeffs - 1];
+    for (int j = numCoeffs - 2; j >= 0; --j)
+      value = value * T + c[j];
+    return value;
+  }
+};
+
+//! Mass-fraction weighted sum of the Sutherland law of every species
+struct SutherlandsTFunctor
+{
+  static constexpr int maxSpecies = 8;
+
+  int numSpecies_{0};
+  Kokkos::Array<double, maxSpecies> massFraction_;
+  Kokkos::Array<double, maxSpecies> muRef_;
+  Kokkos::Array<double, maxSpecies> tRef_;
+  Kokkos::Array<double, maxSpecies> sRef_;
+
+  KOKKOS_INLINE_FUNCTION
+  double operator()(const double T) const
+  {
+    double mu = 0.0;
+    for (int k = 0; k < numSpecies_; ++k) {
+      mu += massFraction_[k] * muRef_[k] *
+            stk::math::pow(T / tRef_[k], 1.5) * (tRef_[k] + sRef_[k]) /
+            (T + sRef_[k]);
+    }
+    return mu;
+  }
+};
+
+/** Evaluate `prop = functor(indVar)` at every selected node on device
+ *
+ *  The kernel is instantiated for each functor type, so the property law is
+ *  inlined into the per-bucket loop instead of dispatched per node.
+ */
+template <typename Functor>
+void
+ngp_temperature_property(
+  const Functor& functor,
+  const stk::mesh::NgpMesh& ngpMesh,
+  const stk::mesh::Selector& sel,
+  const stk::mesh::NgpField<double>& indVar,
+  stk::mesh::NgpField<double>& prop)
+{
+  using Traits = nalu_ngp::NGPMeshTraits<stk::mesh::NgpMesh>;
+
+  const Functor f = functor;
+  const auto temperature = indVar;
+  auto property = prop;
+  nalu_ngp::run_entity_algorithm(
+    "ngp_temperature_property", ngpMesh, stk::topology::NODE_RANK, sel,
+    KOKKOS_LAMBDA(const Traits::MeshIndex& mi) {
+      property.get(mi, 0) = f(temperature.get(mi, 0));
+    });
+  prop.modify_on_device();
+}
+
+/** Invert `enthalpy = hFunctor(T)` for the temperature at every selected node
+ *  on device
+ *
+ *  Newton iterations with `cpFunctor` as the derivative, starting from the
+ *  current temperature. Temperatures outside [minT, maxT] are clipped and
+ *  the enthalpy is reset to that of the clipped temperature, as is the
+ *  enthalpy of the nodes that did not converge.
+ *
+ *  Returns the local number of nodes that did not converge, that were
+ *  clipped to minT and that were clipped to maxT.
+ */
+template <typename HFunctor, typename CpFunctor>
+nalu_ngp::ArrayInt3
+ngp_temperature_from_enthalpy(
+  const HFunctor& hFunctor,
+  const CpFunctor& cpFunctor,
+  const stk::mesh::NgpMesh& ngpMesh,
+  const stk::mesh::Selector& sel,
+  stk::mesh::NgpField<double>& enthalpy,
+  stk::mesh::NgpField<double>& temperature,
+  const double minT,
+  const double maxT,
+  const int maxIter = 25,
+  const double tolerance = 1.0e-8)
+{
+  using Traits = nalu_ngp::NGPMeshTraits<stk::mesh::NgpMesh>;
+
+  const HFunctor hF = hFunctor;
+  const CpFunctor cpF = cpFunctor;
+  auto h = enthalpy;
+  auto temp = temperature;
+
+  nalu_ngp::ArrayInt3 troubleCount(0);
+  Kokkos::Sum<nalu_ngp::ArrayInt3> troubleReducer(troubleCount);
+  nalu_ngp::run_entity_par_reduce(
+    "ngp_temperature_from_enthalpy", ngpMesh, stk::topology::NODE_RANK, sel,
+    KOKKOS_LAMBDA(const Traits::MeshIndex& mi, nalu_ngp::ArrayInt3& trouble) {
+      const double hNp1 = h.get(mi, 0);
+
+      // the current temperature is as good a guess as anything
+      double TNp1 = temp.get(mi, 0);
+      bool converged = false;
+      for (int j = 0; j < maxIter; ++j) {
+        const double tDiff = (hNp1 - hF(TNp1)) / cpF(TNp1);
+        TNp1 += tDiff;
+        if (stk::math::abs(tDiff) < TNp1 * tolerance) {
+          converged = true;
+          break;
+        }
+      }
+
+      bool clipped = !converged;
+      if (!converged)
+        trouble.array_[0] += 1;
+      if (TNp1 < minT) {
+        TNp1 = minT;
+        clipped = true;
+        trouble.array_[1] += 1;
+      }
+      if (TNp1 > maxT) {
+        TNp1 = maxT;
+        clipped = true;
+        trouble.array_[2] += 1;
+      }
+
+      if (clipped)
+        h.get(mi, 0) = hF(TNp1);
+      temp.get(mi, 0) = TNp1;
+    },
+    troubleReducer);
+
+  temperature.modify_on_device();
+  enthalpy.modify_on_device();
+  return troubleCount;
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* TemperaturePropFunctors_h */
@@ -40,6 +40,12 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -57,6 +63,12 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
   
   // reference quantities
   const double aw_;
@@ -76,6 +88,14 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
+
+  bool temperature_polynomial(PolynomialTFunctor& functor) override;
   
   // reference quantities
   const double aw_;
@@ -97,6 +117,14 @@ public:
     double *indVarList,
     stk::mesh::Entity node);
 
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
+
+  bool temperature_polynomial(PolynomialTFunctor& functor) override;
+
   double compute_h(
     const double T);
 
@@ -121,6 +149,12 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool ngp_execute(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const stk::mesh::NgpField<double>& indVar,
+    stk::mesh::NgpField<double>& prop) override;
   
   // reference quantities
   const double aw_;
@@ -0,0 +1,343 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef DEVICETABLE_H
+#define DEVICETABLE_H
+
+#include "KokkosInterface.h"
+#include "ngp_utils/NgpLoopUtils.h"
+#include "ngp_utils/NgpReduceUtils.h"
+
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/NgpMesh.hpp"
+#include "stk_math/StkMath.hpp"
+#include "stk_util/util/ReportHandler.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+//! Clipping statistics of a batched table query
+struct TableClipSummary
+{
+  //! Number of evaluations with at least one input outside the table
+  size_t numClipped{0};
+
+  //! Sum over clipped evaluations of the relative distance outside the table
+  double totalSeverity{0.0};
+};
+
+/** Read-only structured lookup table resident in device memory
+ *
+ *  Device counterpart of the HDF5Table lookup: the independent variable mesh
+ *  points and the tabulated values are flattened into Kokkos views, and a
+ *  whole node field is evaluated in one kernel. Inputs are clipped to the
+ *  table bounds, and the clipping events are reduced on device into a
+ *  TableClipSummary instead of being logged one by one.
+ *
+ *  Values are stored with the last independent variable varying fastest.
+ *  Interpolation is tensor-product Lagrange of order 1 (multilinear) or 3
+ *  (cubic over the four nearest mesh points) in every direction, performed
+ *  in log space for the inputs flagged as log scale.
+ *
+ *  Several properties tabulated on the same mesh, e.g. the density,
+ *  viscosity, conductivity and specific heat of a flamelet table, can share
+ *  one table. Their values are interleaved per mesh point, so that a query
+ *  locates the cell and evaluates the interpolation weights once and reads
+ *  every property of a stencil corner from contiguous memory.
+ */
+template <int MaxDim = 4, int MaxOutputs = 8>
+class DeviceTable
+{
+public:
+  using InputFields = Kokkos::Array<stk::mesh::NgpField<double>, MaxDim>;
+  using OutputFields = Kokkos::Array<stk::mesh::NgpField<double>, MaxOutputs>;
+
+  /**
+   *  @param mesh     Mesh points of every independent variable, increasing
+   *  @param values   Tabulated values, last variable varying fastest
+   *  @param logScale Interpolate in the log of the inputs flagged non-zero
+   *  @param order    Interpolation order, 1 or 3
+   */
+  DeviceTable(
+    const std::vector<std::vector<double>>& mesh,
+    const std::vector<double>& values,
+    const std::vector<unsigned>& logScale,
+    const int order = 1)
+    : DeviceTable(mesh, std::vector<std::vector<double>>{values}, logScale, order)
+  {
+  }
+
+  /**
+   *  @param mesh     Mesh points of every independent variable, increasing
+   *  @param values   Tabulated values of every property, last variable
+   *                  varying fastest
+   *  @param logScale Interpolate in the log of the inputs flagged non-zero
+   *  @param order    Interpolation order, 1 or 3
+   */
+  DeviceTable(
+    const std::vector<std::vector<double>>& mesh,
+    const std::vector<std::vector<double>>& values,
+    const std::vector<unsigned>& logScale,
+    const int order = 1)
+    : dim_(mesh.size()), numOutputs_(values.size()), order_(order)
+  {
+    ThrowRequireMsg(
+      dim_ > 0 && dim_ <= MaxDim,
+      "DeviceTable: unsupported number of inputs " + std::to_string(dim_));
+    ThrowRequireMsg(
+      order_ == 1 || order_ == 3,
+      "DeviceTable: interpolation order must be 1 or 3");
+    ThrowRequireMsg(
+      numOutputs_ > 0 && numOutputs_ <= MaxOutputs,
+      "DeviceTable: unsupported number of properties " +
+        std::to_string(numOutputs_));
+    ThrowRequireMsg(
+      logScale.empty() || static_cast<int>(logScale.size()) == dim_,
+      "DeviceTable: log scale flags do not match the number of inputs");
+
+    size_t numPoints = 0;
+    size_t numValues = 1;
+    for (int d = dim_ - 1; d >= 0; --d) {
+      const int n = mesh[d].size();
+      ThrowRequireMsg(
+        n > order_, "DeviceTable: too few mesh points for the order");
+      numPoints_[d] = n;
+      strides_[d] = numValues;
+      numValues *= n;
+      numPoints += n;
+      logScale_[d] = logScale.empty() ? 0 : static_cast<int>(logScale[d] != 0);
+    }
+    for (const auto& propValues : values)
+      ThrowRequireMsg(
+        propValues.size() == numValues,
+        "DeviceTable: number of values does not match the mesh");
+
+    Kokkos::View<double*, MemSpace> meshPoints("device_table_mesh", numPoints);
+    auto hMeshPoints = Kokkos::create_mirror_view(meshPoints);
+    int offset = 0;
+    for (int d = 0; d < dim_; ++d) {
+      offsets_[d] = offset;
+      for (int i = 0; i < numPoints_[d]; ++i)
+        hMeshPoints(offset + i) =
+          logScale_[d] ? std::log(mesh[d][i]) : mesh[d][i];
+      offset += numPoints_[d];
+    }
+    Kokkos::deep_copy(meshPoints, hMeshPoints);
+    mesh_ = meshPoints;
+
+    Kokkos::View<double*, MemSpace> tableValues(
+      "device_table_values", numValues * numOutputs_);
+    auto hTableValues = Kokkos::create_mirror_view(tableValues);
+    for (size_t i = 0; i < numValues; ++i)
+      for (int p = 0; p < numOutputs_; ++p)
+        hTableValues(i * numOutputs_ + p) = values[p][i];
+    Kokkos::deep_copy(tableValues, hTableValues);
+    values_ = tableValues;
+  }
+
+  int dimension() const { return dim_; }
+
+  //! Number of properties returned by a query
+  int num_outputs() const { return numOutputs_; }
+
+  int order() const { return order_; }
+
+  /** Interpolated first property at the inputs `x`, clipped to the table
+   *  bounds
+   *
+   *  @param severity Sum over inputs of the distance outside the table,
+   *                  relative to the table extent; zero if nothing was clipped
+   */
+  KOKKOS_INLINE_FUNCTION
+  double value(const double* x, double& severity) const
+  {
+    double result[MaxOutputs];
+    values(x, result, severity);
+    return result[0];
+  }
+
+  /** Interpolated properties at the inputs `x`, clipped to the table bounds
+   *
+   *  @param result   Receives the num_outputs() properties
+   *  @param severity Sum over inputs of the distance outside the table,
+   *                  relative to the table extent; zero if nothing was clipped
+   */
+  KOKKOS_INLINE_FUNCTION
+  void values(const double* x, double* result, double& severity) const
+  {
+    const int npts = order_ + 1;
+    int start[MaxDim];
+    double weights[MaxDim][4];
+
+    severity = 0.0;
+    for (int d = 0; d < dim_; ++d) {
+      const double* pts = &mesh_(offsets_[d]);
+      const int n = numPoints_[d];
+      const double lo = pts[0];
+      const double hi = pts[n - 1];
+
+      double xd = logScale_[d] ? stk::math::log(x[d]) : x[d];
+      if (xd < lo) {
+        severity += (lo - xd) / (hi - lo);
+        xd = lo;
+      } else if (xd > hi) {
+        severity += (xd - hi) / (hi - lo);
+        xd = hi;
+      }
+
+      // interval [pts[i], pts[i+1]] containing xd
+      int i0 = 0, i1 = n - 1;
+      while (i1 - i0 > 1) {
+        const int im = (i0 + i1) / 2;
+        if (pts[im] <= xd)
+          i0 = im;
+        else
+          i1 = im;
+      }
+
+      // centre the stencil on the interval, shifted inside at the bounds
+      int s = i0 - (npts / 2 - 1);
+      s = (s < 0) ? 0 : s;
+      s = (s > n - npts) ? n - npts : s;
+      start[d] = s;
+
+      for (int k = 0; k < npts; ++k) {
+        double w = 1.0;
+        for (int m = 0; m < npts; ++m) {
+          if (m != k)
+            w *= (xd - pts[s + m]) / (pts[s + k] - pts[s + m]);
+        }
+        weights[d][k] = w;
+      }
+    }
+
+    // tensor-product sum over the stencil corners; the properties of a
+    // corner are contiguous
+    int numCorners = 1;
+    for (int d = 0; d < dim_; ++d)
+      numCorners *= npts;
+
+    const int numOutputs = numOutputs_;
+    for (int p = 0; p < numOutputs; ++p)
+      result[p] = 0.0;
+    for (int c = 0; c < numCorners; ++c) {
+      int rem = c;
+      size_t index = 0;
+      double w = 1.0;
+      for (int d = dim_ - 1; d >= 0; --d) {
+        const int k = rem % npts;
+        rem /= npts;
+        index += (start[d] + k) * strides_[d];
+        w *= weights[d][k];
+      }
+      const double* corner = &values_(index * numOutputs);
+      for (int p = 0; p < numOutputs; ++p)
+        result[p] += w * corner[p];
+    }
+  }
+
+  /** Evaluate the first property of the table at every selected node
+   *
+   *  @param inputs First dimension() entries are the input node fields,
+   *                in the order of the table independent variables
+   *  @param output Node field receiving the interpolated property
+   */
+  TableClipSummary evaluate(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const InputFields& inputs,
+    stk::mesh::NgpField<double>& output) const
+  {
+    ThrowRequireMsg(
+      numOutputs_ == 1,
+      "DeviceTable: a table of several properties needs one output per property");
+    OutputFields outputs;
+    outputs[0] = output;
+    const auto summary = evaluate(ngpMesh, sel, inputs, outputs);
+    output.modify_on_device();
+    return summary;
+  }
+
+  /** Evaluate every property of the table at every selected node in one pass
+   *
+   *  @param inputs  First dimension() entries are the input node fields,
+   *                 in the order of the table independent variables
+   *  @param outputs First num_outputs() entries are the node fields
+   *                 receiving the properties, in the order of the values
+   *                 given at construction
+   */
+  TableClipSummary evaluate(
+    const stk::mesh::NgpMesh& ngpMesh,
+    const stk::mesh::Selector& sel,
+    const InputFields& inputs,
+    OutputFields& outputs) const
+  {
+    using Traits = nalu_ngp::NGPMeshTraits<stk::mesh::NgpMesh>;
+    using ClipType = nalu_ngp::ArrayDbl2;
+
+    const DeviceTable table = *this;
+    const int dim = dim_;
+    const int numOutputs = numOutputs_;
+    const auto ins = inputs;
+    auto outs = outputs;
+
+    ClipType clip;
+    Kokkos::Sum<ClipType> clipReducer(clip);
+    nalu_ngp::run_entity_par_reduce(
+      "DeviceTable::evaluate", ngpMesh, stk::topology::NODE_RANK, sel,
+      KOKKOS_LAMBDA(const Traits::MeshIndex& mi, ClipType& pSum) {
+        double x[MaxDim];
+        for (int d = 0; d < dim; ++d)
+          x[d] = ins[d].get(mi, 0);
+
+        double result[MaxOutputs];
+        double severity = 0.0;
+        table.values(x, result, severity);
+        for (int p = 0; p < numOutputs; ++p)
+          outs[p].get(mi, 0) = result[p];
+        if (severity > 0.0) {
+          pSum.array_[0] += 1.0;
+          pSum.array_[1] += severity;
+        }
+      },
+      clipReducer);
+    for (int p = 0; p < numOutputs_; ++p)
+      outputs[p].modify_on_device();
+
+    TableClipSummary summary;
+    summary.numClipped = static_cast<size_t>(clip.array_[0]);
+    summary.totalSeverity = clip.array_[1];
+    return summary;
+  }
+
+private:
+  int dim_{0};
+  int numOutputs_{1};
+  int order_{1};
+
+  Kokkos::Array<int, MaxDim> numPoints_;
+  Kokkos::Array<int, MaxDim> offsets_;
+  Kokkos::Array<size_t, MaxDim> strides_;
+  Kokkos::Array<int, MaxDim> logScale_;
+
+  //! Mesh points of all independent variables, concatenated
+  Kokkos::View<const double*, MemSpace> mesh_;
+
+  //! Flattened table values, the properties of a mesh point contiguous
+  Kokkos::View<const double*, MemSpace> values_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* DEVICETABLE_H */
@@ -92,6 +92,9 @@ class HDF5Table
    *
    *  @param inputs : Array of independent variable values
    *  @result : The property as a function of the inputs
+   *
+   *  For evaluating a whole node field on device, or several properties
+   *  sharing the same inputs in one pass, see DeviceTable.
    */
   double query( const std::vector<double> &inputs ) const;
 
@@ -12,12 +12,44 @@
 #define BoundaryLayerPerturbationAuxFunction_h
 
 #include <AuxFunction.h>
+#include <KokkosInterface.h>
+
+#include <stk_math/StkMath.hpp>
 
 #include <vector>
 
 namespace sierra{
 namespace nalu{
 
+//! Perturbed boundary layer velocity at one point, callable on host and device
+struct BoundaryLayerPerturbationFunctor
+{
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const double* coords, const double /* time */, double* vel) const
+  {
+    const double cX = coords[0];
+    const double cY = coords[1];
+    const double cZ = coords[2];
+
+    const double dampfun = stk::math::exp(-cZ/thickness_)*cZ/thickness_/stk::math::exp(-1.0);
+    const double Upower = stk::math::pow((cZ/(5.0*thickness_)),1.0/7.0);
+    const double Umean = stk::math::min(Upower, 1.0)*uInf_;
+
+    vel[0] = Umean + amplitude_*stk::math::cos(kx_*cX)*stk::math::cos(ky_*cY)*dampfun;
+    vel[1] = amplitude_*kx_/ky_*stk::math::sin(kx_*cX)*stk::math::sin(ky_*cY)*dampfun;
+    vel[2] = 0.0;
+  }
+
+  /// Amplitude of perturbations
+  double amplitude_{0.05};
+  double kx_{0.1};
+  double ky_{0.1};
+  double thickness_{0.05};
+
+  /// Mean velocity field during initialization
+  double uInf_{10.0};
+};
+
 /** Add sinusoidal perturbations to the velocity field.
  *
  *  This function is used as an initial condition, primarily in Atmospheric
@@ -45,17 +77,12 @@ public:
     const unsigned fieldSize,
     const unsigned beginPos,
     const unsigned endPos) const;
+
+  using FunctorType = BoundaryLayerPerturbationFunctor;
+  const FunctorType& device_functor() const { return functor_; }
   
 private:
-  /// Amplitude of perturbations
-  double amplitude_;
-  double kx_;
-  double ky_;
-  double thickness_;
-
-  /// Mean velocity field during initialization
-  double uInf_;
-
+  BoundaryLayerPerturbationFunctor functor_;
 };
 
 } // namespace nalu
@@ -0,0 +1,65 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef BOUSSINESQNONISOENTHALPYSRCNODEKERNEL_H
+#define BOUSSINESQNONISOENTHALPYSRCNODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class SolutionOptions;
+
+/** Manufactured enthalpy source of the non-isothermal Boussinesq solution
+ */
+class BoussinesqNonIsoEnthalpySrcNodeKernel : public NGPNodeKernel<BoussinesqNonIsoEnthalpySrcNodeKernel>
+{
+public:
+  BoussinesqNonIsoEnthalpySrcNodeKernel(
+    const stk::mesh::BulkData&,
+    const SolutionOptions&);
+
+  BoussinesqNonIsoEnthalpySrcNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~BoussinesqNonIsoEnthalpySrcNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME;
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
+
+private:
+  stk::mesh::NgpField<double> coordinates_;
+
+  unsigned coordinatesID_{stk::mesh::InvalidOrdinal};
+
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* BOUSSINESQNONISOENTHALPYSRCNODEKERNEL_H */
@@ -0,0 +1,73 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef BOUSSINESQNONISOMOMENTUMSRCNODEKERNEL_H
+#define BOUSSINESQNONISOMOMENTUMSRCNODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class SolutionOptions;
+
+/** Manufactured momentum source of the non-isothermal Boussinesq
+ *  solution, including its buoyancy
+ */
+class BoussinesqNonIsoMomentumSrcNodeKernel : public NGPNodeKernel<BoussinesqNonIsoMomentumSrcNodeKernel>
+{
+public:
+  BoussinesqNonIsoMomentumSrcNodeKernel(
+    const stk::mesh::BulkData&,
+    const SolutionOptions&);
+
+  BoussinesqNonIsoMomentumSrcNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~BoussinesqNonIsoMomentumSrcNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME;
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
+
+private:
+  stk::mesh::NgpField<double> coordinates_;
+
+  unsigned coordinatesID_{stk::mesh::InvalidOrdinal};
+
+  const NodeKernelTraits::DblType visc_;
+  const NodeKernelTraits::DblType Cp_;
+  const NodeKernelTraits::DblType rhoRef_;
+  const NodeKernelTraits::DblType TRef_;
+  const NodeKernelTraits::DblType beta_;
+
+  NALU_ALIGNED NodeKernelTraits::DblType gravity_[NodeKernelTraits::NDimMax];
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* BOUSSINESQNONISOMOMENTUMSRCNODEKERNEL_H */
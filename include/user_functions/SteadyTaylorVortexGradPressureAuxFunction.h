@@ -12,12 +12,33 @@
 #define SteadyTaylorVortexGradPressureAuxFunction_h
 
 #include <AuxFunction.h>
+#include <KokkosInterface.h>
+
+#include <stk_math/StkMath.hpp>
 
 #include <vector>
 
 namespace sierra{
 namespace nalu{
 
+//! Steady Taylor vortex pressure gradient at one point, callable on host and device
+struct SteadyTaylorVortexGradPressureFunctor
+{
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const double* coords, const double /* time */, double* dpdx) const
+  {
+    const double x = coords[0];
+    const double y = coords[1];
+
+    dpdx[0] = a_*pi_/2.0*stk::math::sin(2.0*a_*pi_*x);
+    dpdx[1] = a_*pi_/2.0*stk::math::sin(2.0*a_*pi_*y);
+    dpdx[2] = 0.0;
+  }
+
+  double a_{20.0};
+  double pi_{0.0};
+};
+
 class SteadyTaylorVortexGradPressureAuxFunction : public AuxFunction
 {
 public:
@@ -38,10 +59,12 @@ public:
     const unsigned fieldSize,
     const unsigned beginPos,
     const unsigned endPos) const;
+
+  using FunctorType = SteadyTaylorVortexGradPressureFunctor;
+  const FunctorType& device_functor() const { return functor_; }
   
 private:
-  const double a_;
-  const double pi_;
+  SteadyTaylorVortexGradPressureFunctor functor_;
 };
 
 } // namespace nalu
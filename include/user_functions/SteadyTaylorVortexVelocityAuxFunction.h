@@ -12,12 +12,35 @@
 #define SteadyTaylorVortexVelocityAuxFunction_h
 
 #include <AuxFunction.h>
+#include <KokkosInterface.h>
+
+#include <stk_math/StkMath.hpp>
 
 #include <vector>
 
 namespace sierra{
 namespace nalu{
 
+//! Steady Taylor vortex velocity at one point, callable on host and device
+struct SteadyTaylorVortexVelocityFunctor
+{
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const double* coords, const double /* time */, double* vel) const
+  {
+    const double x = coords[0];
+    const double y = coords[1];
+
+    vel[0] = -unot_*stk::math::cos(a_*pi_*x)*stk::math::sin(a_*pi_*y);
+    vel[1] = +vnot_*stk::math::sin(a_*pi_*x)*stk::math::cos(a_*pi_*y);
+    vel[2] = 0.0;
+  }
+
+  double unot_{1.0};
+  double vnot_{1.0};
+  double a_{20.0};
+  double pi_{0.0};
+};
+
 class SteadyTaylorVortexVelocityAuxFunction : public AuxFunction
 {
 public:
@@ -38,12 +61,12 @@ public:
     const unsigned fieldSize,
     const unsigned beginPos,
     const unsigned endPos) const;
+
+  using FunctorType = SteadyTaylorVortexVelocityFunctor;
+  const FunctorType& device_functor() const { return functor_; }
   
 private:
-  const double unot_;
-  const double vnot_;
-  const double a_;
-  const double pi_;
+  SteadyTaylorVortexVelocityFunctor functor_;
 };
 
 } // namespace nalu
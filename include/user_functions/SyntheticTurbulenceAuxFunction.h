@@ -0,0 +1,119 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef SYNTHETICTURBULENCEAUXFUNCTION_H
+#define SYNTHETICTURBULENCEAUXFUNCTION_H
+
+#include "AuxFunction.h"
+#include "KokkosInterface.h"
+
+#include "stk_math/StkMath.hpp"
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+//! Sheared mean flow plus random Fourier mode turbulence at one point,
+//! callable on host and device
+struct SyntheticTurbulenceFunctor
+{
+  //! Fixed so that the functor stays a small by-value kernel argument
+  static constexpr int maxModes = 32;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const double* coords, const double time, double* vel) const
+  {
+    const double z = coords[2] - z_offset_;
+    const double uMean =
+      (z > 0.0) ? u_ref_ * stk::math::pow(z / z_ref_, shear_exp_) : 0.0;
+
+    // frozen turbulence convected through the inflow plane at the reference
+    // speed
+    const double xc[3] = {coords[0] - u_ref_ * time, coords[1], coords[2]};
+
+    double up[3] = {0.0, 0.0, 0.0};
+    for (int n = 0; n < num_modes_; ++n) {
+      const double arg = wave_[n][0] * xc[0] + wave_[n][1] * xc[1] +
+                         wave_[n][2] * xc[2] + phase_[n];
+      const double c = stk::math::cos(arg);
+      for (int d = 0; d < 3; ++d)
+        up[d] += amp_[n][d] * c;
+    }
+
+    const double sigma = turb_intensity_ * uMean;
+    vel[0] = uMean + sigma * up[0];
+    vel[1] = sigma * up[1];
+    vel[2] = sigma * up[2];
+  }
+
+  double u_ref_{8.0};          // Mean speed at the reference height
+  double z_ref_{90.0};         // Reference height
+  double z_offset_{0.0};       // Height of the ground
+  double shear_exp_{0.14};     // Power law shear exponent
+  double turb_intensity_{0.1}; // Turbulence intensity of each component
+  int num_modes_{0};
+
+  double wave_[maxModes][3];   // Wave vectors
+  double amp_[maxModes][3];    // Divergence-free amplitudes
+  double phase_[maxModes];
+};
+
+/** Synthetic turbulent inflow from random Fourier modes
+ *
+ *  The velocity is the power law mean \f$ U(z) = U_{ref} (z/z_{ref})^\alpha
+ *  \f$ along x plus fluctuations of standard deviation \f$ I\,U(z) \f$ per
+ *  component,
+ *
+ *  \f[
+ *    u'_i = \sum_n a_{n,i} \cos(\mathbf{k}_n \cdot (\mathbf{x} - U_{ref}\, t
+ *    \,\mathbf{e}_x) + \varphi_n), \quad \mathbf{a}_n \perp \mathbf{k}_n,
+ *  \f]
+ *
+ *  so that the field is divergence free and is convected through the inflow
+ *  by Taylor's frozen turbulence hypothesis. The mode energies follow a von
+ *  Karman spectrum of integral length L; directions and phases are drawn
+ *  from a seeded generator so that every rank builds the same modes.
+ *
+ *  Parameters: u_ref, z_ref, shear_exp, turbulence_intensity, length_scale,
+ *  and optionally z_offset, num_modes (at most 32) and seed.
+ */
+class SyntheticTurbulenceAuxFunction : public AuxFunction
+{
+public:
+
+  SyntheticTurbulenceAuxFunction(
+    const unsigned beginPos,
+    const unsigned endPos,
+    const std::vector<double> &theParams);
+
+  virtual ~SyntheticTurbulenceAuxFunction() {}
+
+  using AuxFunction::do_evaluate;
+  virtual void do_evaluate(
+    const double * coords,
+    const double time,
+    const unsigned spatialDimension,
+    const unsigned numPoints,
+    double * fieldPtr,
+    const unsigned fieldSize,
+    const unsigned beginPos,
+    const unsigned endPos) const;
+
+  using FunctorType = SyntheticTurbulenceFunctor;
+  const FunctorType& device_functor() const { return functor_; }
+
+private:
+  SyntheticTurbulenceFunctor functor_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif /* SYNTHETICTURBULENCEAUXFUNCTION_H */
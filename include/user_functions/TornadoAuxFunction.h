@@ -12,10 +12,41 @@
 #define TornadoAuxFunction_h
 
 #include <AuxFunction.h>
+#include <KokkosInterface.h>
+
+#include <stk_math/StkMath.hpp>
 
 namespace sierra{
 namespace nalu{
 
+//! Tornado-like swirling wall velocity at one point, callable on host and device
+struct TornadoFunctor
+{
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const double* coords, const double /* time */, double* vel) const
+  {
+    const double cX = coords[0];
+    const double cY = coords[1];
+    const double cZ = coords[2];
+
+    const double fac = stk::math::pow(cZ/z1_, 1.0/7.0);
+
+    const double uMag = uRef_*fac;
+    const double omega = uMag/rNot_;
+    const double uZ = 2.0*hNot_/rNot_*swirl_*uMag;
+
+    vel[0] = -omega*cY;
+    vel[1] = +omega*cX;
+    vel[2] = uZ;
+  }
+
+  double z1_{0.025};
+  double hNot_{0.41};
+  double rNot_{0.4};
+  double uRef_{0.3};
+  double swirl_{2.0};
+};
+
 class TornadoAuxFunction : public AuxFunction
 {
 public:
@@ -36,9 +67,12 @@ public:
     const unsigned fieldSize,
     const unsigned beginPos,
     const unsigned endPos) const;
+
+  using FunctorType = TornadoFunctor;
+  const FunctorType& device_functor() const { return functor_; }
   
 private:
-  const double z1_, hNot_, rNot_, uRef_, swirl_;
+  const TornadoFunctor functor_;
 };
 
 } // namespace nalu
@@ -0,0 +1,76 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef VARIABLEDENSITYCONTINUITYSRCNODEKERNEL_H
+#define VARIABLEDENSITYCONTINUITYSRCNODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class SolutionOptions;
+
+/** Manufactured continuity source of the variable density mixture
+ *  fraction solution
+ */
+class VariableDensityContinuitySrcNodeKernel : public NGPNodeKernel<VariableDensityContinuitySrcNodeKernel>
+{
+public:
+  VariableDensityContinuitySrcNodeKernel(
+    const stk::mesh::BulkData&,
+    const SolutionOptions&);
+
+  VariableDensityContinuitySrcNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~VariableDensityContinuitySrcNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME;
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
+
+private:
+  stk::mesh::NgpField<double> coordinates_;
+
+  unsigned coordinatesID_{stk::mesh::InvalidOrdinal};
+
+  const NodeKernelTraits::DblType unot_;
+  const NodeKernelTraits::DblType vnot_;
+  const NodeKernelTraits::DblType wnot_;
+  const NodeKernelTraits::DblType znot_;
+  const NodeKernelTraits::DblType rhoP_;
+  const NodeKernelTraits::DblType rhoS_;
+  const NodeKernelTraits::DblType a_;
+  const NodeKernelTraits::DblType amf_;
+  const NodeKernelTraits::DblType pi_;
+  NodeKernelTraits::DblType projTimeScale_{1.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* VARIABLEDENSITYCONTINUITYSRCNODEKERNEL_H */
@@ -0,0 +1,83 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef VARIABLEDENSITYMOMENTUMSRCNODEKERNEL_H
+#define VARIABLEDENSITYMOMENTUMSRCNODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class SolutionOptions;
+
+/** Manufactured momentum source of the variable density mixture fraction
+ *  solution
+ */
+class VariableDensityMomentumSrcNodeKernel : public NGPNodeKernel<VariableDensityMomentumSrcNodeKernel>
+{
+public:
+  VariableDensityMomentumSrcNodeKernel(
+    const stk::mesh::BulkData&,
+    const SolutionOptions&);
+
+  VariableDensityMomentumSrcNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~VariableDensityMomentumSrcNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME;
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
+
+private:
+  stk::mesh::NgpField<double> coordinates_;
+
+  unsigned coordinatesID_{stk::mesh::InvalidOrdinal};
+
+  const int nDim_;
+  const NodeKernelTraits::DblType unot_;
+  const NodeKernelTraits::DblType vnot_;
+  const NodeKernelTraits::DblType wnot_;
+  const NodeKernelTraits::DblType pnot_;
+  const NodeKernelTraits::DblType znot_;
+  const NodeKernelTraits::DblType a_;
+  const NodeKernelTraits::DblType amf_;
+  const NodeKernelTraits::DblType visc_;
+  const NodeKernelTraits::DblType rhoP_;
+  const NodeKernelTraits::DblType rhoS_;
+  const NodeKernelTraits::DblType pi_;
+  const NodeKernelTraits::DblType twoThirds_;
+  const NodeKernelTraits::DblType rhoRef_;
+  NodeKernelTraits::DblType gx_;
+  NodeKernelTraits::DblType gy_;
+  NodeKernelTraits::DblType gz_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* VARIABLEDENSITYMOMENTUMSRCNODEKERNEL_H */
@@ -0,0 +1,80 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef VARIABLEDENSITYNONISOCONTINUITYSRCNODEKERNEL_H
+#define VARIABLEDENSITYNONISOCONTINUITYSRCNODEKERNEL_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include "stk_mesh/base/BulkData.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class SolutionOptions;
+
+/** Manufactured continuity source of the non-isothermal variable density
+ *  solution
+ */
+class VariableDensityNonIsoContinuitySrcNodeKernel : public NGPNodeKernel<VariableDensityNonIsoContinuitySrcNodeKernel>
+{
+public:
+  VariableDensityNonIsoContinuitySrcNodeKernel(
+    const stk::mesh::BulkData&,
+    const SolutionOptions&);
+
+  VariableDensityNonIsoContinuitySrcNodeKernel() = delete;
+
+  KOKKOS_DEFAULTED_FUNCTION
+  virtual ~VariableDensityNonIsoContinuitySrcNodeKernel() = default;
+
+  virtual void setup(Realm&) override;
+
+  virtual unsigned gathered_fields() const override
+  {
+    return NodeKernelData::DUAL_VOLUME;
+  }
+
+  KOKKOS_FUNCTION
+  virtual void execute(
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&,
+    const NodeKernelData&) override;
+
+private:
+  stk::mesh::NgpField<double> coordinates_;
+
+  unsigned coordinatesID_{stk::mesh::InvalidOrdinal};
+
+  const NodeKernelTraits::DblType unot_;
+  const NodeKernelTraits::DblType vnot_;
+  const NodeKernelTraits::DblType wnot_;
+  const NodeKernelTraits::DblType hnot_;
+  const NodeKernelTraits::DblType a_;
+  const NodeKernelTraits::DblType ah_;
+  const NodeKernelTraits::DblType Pref_;
+  const NodeKernelTraits::DblType MW_;
+  const NodeKernelTraits::DblType R_;
+  const NodeKernelTraits::DblType Tref_;
+  const NodeKernelTraits::DblType Cp_;
+  const NodeKernelTraits::DblType Pr_;
+  const NodeKernelTraits::DblType pi_;
+  NodeKernelTraits::DblType projTimeScale_{1.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* VARIABLEDENSITYNONISOCONTINUITYSRCNODEKERNEL_H */
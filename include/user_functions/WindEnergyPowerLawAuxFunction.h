@@ -12,12 +12,44 @@
 #define WINDENERGYPOWERLAWAUXFUNCTION_H
 
 #include "AuxFunction.h"
+#include "KokkosInterface.h"
+
+#include "stk_math/StkMath.hpp"
+
 #include <vector>
-#include <array>
 
 namespace sierra{
 namespace nalu{
 
+//! Power law velocity at one point, callable on host and device
+struct WindEnergyPowerLawFunctor
+{
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const double* coords, const double /* time */, double* vel) const
+  {
+    const double y = coords[coord_dir_];
+
+    double power_law_fn = 0.0;
+    if ((y - y_offset_) > 0.0)
+      power_law_fn = stk::math::pow((y - y_offset_) / y_ref_, shear_exp_);
+
+    if (power_law_fn < u_min_)
+      power_law_fn = u_min_;
+    else if (power_law_fn > u_max_)
+      power_law_fn = u_max_;
+
+    for (int d = 0; d < 3; ++d)
+      vel[d] = u_ref_[d] * power_law_fn;
+  }
+
+  int coord_dir_{2}; // Coordinate direction - 0/1/2
+  double y_offset_{0.0}; //Offset for coordinate
+  double y_ref_{1.0}; // Reference height
+  double shear_exp_{0.0}; // Exponent for power law
+  double u_ref_[3]{0.0, 0.0, 0.0}; // Velocity vector at reference height
+  double u_min_{0.0}; // Minimum velocity to cut off power law
+  double u_max_{0.0}; // Maximum velocity to cut off power law
+};
 
 
 /** Create power law velocity profile aux function for wind energy applications
@@ -50,18 +82,12 @@ public:
     const unsigned fieldSize,
     const unsigned beginPos,
     const unsigned endPos) const;
+
+  using FunctorType = WindEnergyPowerLawFunctor;
+  const FunctorType& device_functor() const { return functor_; }
   
 private:
-
-    int coord_dir_; // Coordinate direction - 0/1/2
-    double y_offset_; //Offset for coordinate
-    double y_ref_; // Reference height
-    double shear_exp_ ; // Exponent for power law
-    // Velocity vector at reference height
-    std::array<double,3> u_ref_; 
-    double u_mag_; // Velocity magnitude
-    double u_min_; // Minimum velocity to cut off power law
-    double u_max_; // Maximum velocity to cut off power law
+    WindEnergyPowerLawFunctor functor_;
 };
 
 } // namespace nalu
@@ -4,16 +4,22 @@
 #include <type_traits>
 
 #include <KokkosInterface.h>
+#include <utils/DeviceMemoryPool.h>
 
 namespace sierra {
 namespace nalu {
 
+/** Copy construct an object on device
+ *
+ *  The storage comes from the DeviceMemoryPool and must be returned with
+ *  pool_free_on_device.
+ */
 template <typename T>
 inline 
 T* create_device_expression(const T & rhs)
 {
   const std::string debuggingName(typeid(T).name());
-  T* t = kokkos_malloc_on_device<T>(debuggingName);
+  T* t = pool_malloc_on_device<T>();
   // Bring rhs into local scope for capture to device.
   const T RHS(rhs);
   Kokkos::parallel_for(debuggingName, 1, KOKKOS_LAMBDA (const int /* i */) {
@@ -27,7 +33,7 @@ inline
 T* create_device_expression()
 {
   const std::string debuggingName(typeid(T).name());
-  T* t = kokkos_malloc_on_device<T>(debuggingName);
+  T* t = pool_malloc_on_device<T>();
   Kokkos::parallel_for(debuggingName, 1, KOKKOS_LAMBDA (const int /* i */) {
     new (t) T(); 
   });
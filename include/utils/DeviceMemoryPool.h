@@ -0,0 +1,125 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+#ifndef DEVICEMEMORYPOOL_H_
+#define DEVICEMEMORYPOOL_H_
+
+#include <KokkosInterface.h>
+
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Caching allocator for transient device memory
+ *
+ *  Blocks are rounded up to a power of two size class and kept on a free
+ *  list when released, so the temporaries created in every assembly or
+ *  solve (device copies of the coefficient appliers, small staging arrays)
+ *  reuse memory instead of calling the device allocator each time. Cached
+ *  blocks are only returned to Kokkos by release().
+ *
+ *  The pool is host-side state shared by all realms of a rank.
+ */
+class DeviceMemoryPool
+{
+public:
+  //! Allocation counters since the start of the run
+  struct Statistics
+  {
+    size_t hits{0};
+    size_t misses{0};
+    size_t bytesInUse{0};
+    size_t bytesCached{0};
+    size_t highWaterBytes{0};
+  };
+
+  static DeviceMemoryPool& self();
+
+  //! Return a block of at least `bytes` bytes in MemSpace
+  void* allocate(const size_t bytes);
+
+  //! Return a block obtained from allocate() to the pool
+  void deallocate(void* ptr);
+
+  //! Free all cached blocks; blocks still in use are left alone
+  void release();
+
+  const Statistics& statistics() const { return stats_; }
+
+  //! Smallest size class in bytes
+  static constexpr size_t minBlockBytes_{256};
+
+  //! Size class used for an allocation of `bytes` bytes
+  static size_t size_class(const size_t bytes);
+
+private:
+  DeviceMemoryPool() = default;
+  ~DeviceMemoryPool() = default;
+  DeviceMemoryPool(const DeviceMemoryPool&) = delete;
+  DeviceMemoryPool& operator=(const DeviceMemoryPool&) = delete;
+
+  //! Cached blocks for each size class
+  std::map<size_t, std::vector<void*>> freeBlocks_;
+
+  //! Size class of every block handed out
+  std::unordered_map<void*, size_t> inUse_;
+
+  Statistics stats_;
+};
+
+//! Allocate storage for one T from the device memory pool
+template <typename T>
+inline T*
+pool_malloc_on_device()
+{
+  return static_cast<T*>(DeviceMemoryPool::self().allocate(sizeof(T)));
+}
+
+//! Return storage obtained from pool_malloc_on_device
+inline void
+pool_free_on_device(void* ptr)
+{
+  DeviceMemoryPool::self().deallocate(ptr);
+}
+
+/** One-dimensional device array backed by the device memory pool
+ *
+ *  The view is unmanaged; the block goes back to the pool when the
+ *  PooledView goes out of scope, so it must outlive the kernels using it.
+ */
+template <typename T>
+class PooledView
+{
+public:
+  using ViewType =
+    Kokkos::View<T*, MemSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  explicit PooledView(const size_t n)
+    : view_(
+        static_cast<T*>(DeviceMemoryPool::self().allocate(n * sizeof(T))), n)
+  {}
+
+  ~PooledView() { DeviceMemoryPool::self().deallocate(view_.data()); }
+
+  PooledView(const PooledView&) = delete;
+  PooledView& operator=(const PooledView&) = delete;
+
+  const ViewType& view() const { return view_; }
+
+private:
+  ViewType view_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* DEVICEMEMORYPOOL_H_ */
@@ -0,0 +1,54 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef EDGECACHE_H
+#define EDGECACHE_H
+
+#include <string>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class Part;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Per rank file name of an edge cache, `fileName.N.r`
+ */
+std::string edge_cache_file_name(
+  const std::string& fileName, const int numProcs, const int rank);
+
+/** Write the edge ids of every locally owned element to the edge cache
+ *
+ *  The cache lists, for each element, the id of the edge at every edge
+ *  ordinal. It is only valid for the same mesh on the same decomposition.
+ */
+void write_edge_cache(
+  const stk::mesh::BulkData& bulk, const std::string& fileName);
+
+/** Recreate the edges saved by write_edge_cache
+ *
+ *  Edges are declared with their saved ids, connected to the locally owned
+ *  elements and faces and added to `edgesPart`; sharing and ghosting are
+ *  resolved by the modification cycle. Collective: when the cache is missing
+ *  or does not match the mesh on any rank no edges are created and false is
+ *  returned on every rank.
+ */
+bool read_edge_cache(
+  stk::mesh::BulkData& bulk,
+  const std::string& fileName,
+  stk::mesh::Part* edgesPart);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* EDGECACHE_H */
@@ -0,0 +1,117 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ELEMENTSEARCHTREE_H
+#define ELEMENTSEARCHTREE_H
+
+#include <stk_mesh/base/Types.hpp>
+#include <stk_search/BoundingBox.hpp>
+#include <stk_search/IdentProc.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Bounding volume hierarchy over the boxes of locally owned mesh entities
+ *
+ *  stk::search::coarse_search rebuilds its tree on every call. This tree is
+ *  built once from the entity boxes and then queried with any number of
+ *  point spheres, which is what the actuator and data probe searches do
+ *  over the same background mesh.
+ */
+class ElementSearchTree
+{
+public:
+  using Key = stk::search::IdentProc<uint64_t, int>;
+  using BoxVec = std::vector<std::pair<stk::search::Box<double>, Key>>;
+  using SphereVec = std::vector<std::pair<stk::search::Sphere<double>, Key>>;
+  using KeyPairVec = std::vector<std::pair<Key, Key>>;
+
+  explicit ElementSearchTree(BoxVec boxes);
+
+  //! All (sphere, box) pairs that overlap, sorted like coarse_search
+  void query(const SphereVec& spheres, KeyPairVec& searchKeyPair) const;
+
+  std::size_t num_boxes() const { return boxes_.size(); }
+
+private:
+  struct Node
+  {
+    stk::search::Box<double> box_;
+    int left_{-1};
+    int right_{-1};
+    int begin_{0};
+    int end_{0};
+  };
+
+  static constexpr int leafSize_{8};
+
+  int build(int begin, int end);
+
+  BoxVec boxes_;
+  std::vector<Node> nodes_;
+};
+
+/** Boxes of the locally owned entities of `parts`, keyed by entity id
+ *
+ *  The entity rank is the primary rank of the first part; in 2-D the z
+ *  extent of the boxes is zero.
+ */
+ElementSearchTree::BoxVec create_entity_boxes(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::PartVector& parts,
+  const std::string& coordinatesName);
+
+/** Search trees of a realm, shared by the point searches that use them
+ *
+ *  A tree is rebuilt when the mesh is modified and, for any coordinates but
+ *  the model `coordinates`, when the `geometryEpoch` of the caller changes,
+ *  e.g., Realm::geometry_cache_epoch(); trees over the model coordinates
+ *  survive mesh motion.
+ */
+class ElementSearchTreeCache
+{
+public:
+  explicit ElementSearchTreeCache(const stk::mesh::BulkData& bulk);
+
+  //! Tree over the locally owned entities of `parts`
+  std::shared_ptr<const ElementSearchTree> get(
+    const stk::mesh::PartVector& parts,
+    const std::string& coordinatesName,
+    const unsigned geometryEpoch = 0);
+
+private:
+  struct Entry
+  {
+    std::vector<unsigned> partOrdinals_;
+    std::string coordinatesName_;
+    size_t syncCount_{0};
+    unsigned geometryEpoch_{0};
+    std::shared_ptr<const ElementSearchTree> tree_;
+  };
+
+  const stk::mesh::BulkData& bulk_;
+  std::vector<Entry> entries_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ELEMENTSEARCHTREE_H */
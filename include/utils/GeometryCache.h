@@ -0,0 +1,76 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef GEOMETRYCACHE_H
+#define GEOMETRYCACHE_H
+
+#include <stk_mesh/base/EntityKey.hpp>
+#include <stk_mesh/base/Selector.hpp>
+#include <stk_search/IdentProc.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+using GeometryCacheKey = stk::search::IdentProc<stk::mesh::EntityKey, int>;
+using GeometryCachePairs =
+  std::vector<std::pair<GeometryCacheKey, GeometryCacheKey>>;
+
+/** Per rank file name of a geometry cache, `fileName.N.r`
+ */
+std::string geometry_cache_file_name(
+  const std::string& fileName, const int numProcs, const int rank);
+
+/** Checksum of the ids and coordinates of the nodes selected on this rank
+ *
+ *  The nodes are hashed in id order, so the checksum only depends on the
+ *  mesh and its decomposition; `seed` folds in the options the cached data
+ *  depends on.
+ */
+uint64_t geometry_checksum(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::Selector& sel,
+  const stk::mesh::FieldBase& coordinates,
+  const uint64_t seed);
+
+/** Write the periodic master/slave node pairs found by the search
+ */
+void write_periodic_pair_cache(
+  const stk::mesh::BulkData& bulk,
+  const std::string& fileName,
+  const uint64_t checksum,
+  const GeometryCachePairs& pairs);
+
+/** Read the node pairs saved by write_periodic_pair_cache
+ *
+ *  Collective: when the cache is missing, was written for another checksum
+ *  or lists a node unknown to the rank on any rank, `pairs` is left empty
+ *  and false is returned on every rank.
+ */
+bool read_periodic_pair_cache(
+  const stk::mesh::BulkData& bulk,
+  const std::string& fileName,
+  const uint64_t checksum,
+  GeometryCachePairs& pairs);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* GEOMETRYCACHE_H */
@@ -0,0 +1,37 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef HARDWARECOUNTERS_H
+#define HARDWARECOUNTERS_H
+
+#include "utils/TimerTree.h"
+
+#include <mpi.h>
+
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Host hardware counters of the calling thread, read through PAPI
+ *
+ *  Collective. Events that are unknown on any rank are dropped with a
+ *  warning so that every rank counts the same events; throws if none is
+ *  left or if the code was built without PAPI (ENABLE_PAPI). Device kernels
+ *  are not counted; vendor profilers see the timer tree through the Kokkos
+ *  profiling regions instead.
+ */
+TimerTree::CounterSource
+papi_counter_source(const std::vector<std::string>& events, MPI_Comm comm);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* HARDWARECOUNTERS_H */
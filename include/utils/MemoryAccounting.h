@@ -0,0 +1,68 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+#ifndef MEMORYACCOUNTING_H_
+#define MEMORYACCOUNTING_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Ioss {
+class Region;
+}
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class MetaData;
+class Part;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+//! Named memory consumer on this rank
+struct MemoryRecord
+{
+  std::string name;
+  double bytes{0.0};
+};
+
+/** Local entity counts used to plan memory before the mesh is populated
+ *
+ *  Element and side counts are exact; node and edge counts per part are upper
+ *  bounds since they ignore the entities shared between neighbors.
+ */
+struct MemoryPlanCounts
+{
+  double numNodes{0.0};
+  double numEdges{0.0};
+
+  //! Elements of each element block, sides of each side set
+  std::map<const stk::mesh::Part*, double> partEntities;
+  std::map<const stk::mesh::Part*, double> partNodes;
+  std::map<const stk::mesh::Part*, double> partEdges;
+};
+
+//! Entity counts of the element blocks and side sets of the input region
+MemoryPlanCounts
+memory_plan_counts(const stk::mesh::MetaData& meta, Ioss::Region& region);
+
+//! Allocated bytes of every registered field, all states of a field combined
+std::vector<MemoryRecord> field_memory(const stk::mesh::BulkData& bulk);
+
+//! Predicted bytes of every registered field, all states of a field combined
+std::vector<MemoryRecord>
+planned_field_memory(const stk::mesh::MetaData& meta, const MemoryPlanCounts&);
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MEMORYACCOUNTING_H_ */
@@ -0,0 +1,142 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MIXEDPRECISIONFIELD_H
+#define MIXEDPRECISIONFIELD_H
+
+#include "KokkosInterface.h"
+#include "ngp_utils/NgpFieldManager.h"
+#include "utils/SyncAudit.h"
+
+#include "stk_mesh/base/FieldBase.hpp"
+#include "stk_mesh/base/MetaData.hpp"
+#include "stk_mesh/base/NgpField.hpp"
+
+#include <string>
+#include <typeinfo>
+
+namespace sierra {
+namespace nalu {
+
+class SolutionOptions;
+
+//! True if the field stores its values in single precision
+inline bool
+field_is_float(const stk::mesh::FieldBase& field)
+{
+  return field.data_traits().type_info == typeid(float);
+}
+
+/** Call `f` with a value of the storage type of the field
+ *
+ *  Host code writing a field that may be stored in reduced precision uses a
+ *  generic lambda, e.g.,
+ *
+ *  ```
+ *  dispatch_field_precision(field, [&](auto tag) {
+ *    using T = decltype(tag);
+ *    T* data = static_cast<T*>(stk::mesh::field_data(field, bucket));
+ *  });
+ *  ```
+ */
+template <typename Func>
+void
+dispatch_field_precision(const stk::mesh::FieldBase& field, Func&& f)
+{
+  if (field_is_float(field))
+    f(float());
+  else
+    f(double());
+}
+
+/** Declare a scalar nodal field in single or double precision
+ *
+ *  The field is stored in single precision when it is listed in the
+ *  `reduced_precision_fields` solution option.
+ */
+stk::mesh::FieldBase& declare_mixed_precision_node_field(
+  stk::mesh::MetaData& meta,
+  const std::string& name,
+  stk::mesh::Part& part,
+  const SolutionOptions& solnOpts);
+
+/** Device accessor of a field stored in double or single precision
+ *
+ *  Kernels read the values in double precision whatever the storage type,
+ *  so that fields registered in reduced precision need no second code path.
+ *  Values written through `set` are rounded to the storage type.
+ */
+class MixedPrecisionNgpField
+{
+public:
+  MixedPrecisionNgpField() = default;
+
+  MixedPrecisionNgpField(
+    const nalu_ngp::FieldManager& fieldMgr,
+    const stk::mesh::MetaData& meta,
+    const unsigned ordinal)
+    : isFloat_(field_is_float(*meta.get_fields()[ordinal]))
+  {
+    if (isFloat_)
+      fltField_ = fieldMgr.get_field<float>(ordinal);
+    else
+      dblField_ = fieldMgr.get_field<double>(ordinal);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION double get(const Args&... args) const
+  {
+    return isFloat_ ? static_cast<double>(fltField_.get(args...))
+                    : dblField_.get(args...);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION void set(const double val, const Args&... args) const
+  {
+    if (isFloat_)
+      fltField_.get(args...) = static_cast<float>(val);
+    else
+      dblField_.get(args...) = val;
+  }
+
+  //! Sync the storage field, recorded at the caller by NALU_SYNC_TO_DEVICE
+  void sync_to_device(const char* file, const int line)
+  {
+    if (isFloat_)
+      audited_sync_to_device(fltField_, file, line);
+    else
+      audited_sync_to_device(dblField_, file, line);
+  }
+
+  void modify_on_device()
+  {
+    if (isFloat_)
+      fltField_.modify_on_device();
+    else
+      dblField_.modify_on_device();
+  }
+
+private:
+  stk::mesh::NgpField<double> dblField_;
+  stk::mesh::NgpField<float> fltField_;
+  bool isFloat_{false};
+};
+
+//! NALU_SYNC_TO_DEVICE of a mixed precision field syncs its storage field
+inline void
+audited_sync_to_device(
+  MixedPrecisionNgpField& fld, const char* file, const int line)
+{
+  fld.sync_to_device(file, line);
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MIXEDPRECISIONFIELD_H */
@@ -0,0 +1,100 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef STEPTELEMETRY_H
+#define STEPTELEMETRY_H
+
+#include <mpi.h>
+
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** JSON-lines stream of per time step performance data
+ *
+ *  Rank 0 appends one self-contained JSON object per time step to the
+ *  stream and flushes it, so that the file can be followed while the job
+ *  runs. The rank-local wall times and memory high-water mark are reduced to
+ *  their minimum and maximum over the ranks with a single reduction to rank
+ *  0 per step; iteration counts, residuals and Courant numbers are already
+ *  global and are written as given by rank 0.
+ */
+class StepTelemetry
+{
+public:
+  //! Rank-local values that are reduced to their min and max over the ranks
+  struct Range
+  {
+    double min{0.0};
+    double max{0.0};
+  };
+
+  //! One equation system over one time step
+  struct Equation
+  {
+    std::string realm;
+    std::string name;
+    //! assembly and load complete time of this step
+    Range assemble;
+    //! linear solve time of this step, preconditioner setup included
+    Range solve;
+    int linearSolves{0};
+    int linearIterations{0};
+    //! last linear and nonlinear residuals of the step
+    double linearResidual{0.0};
+    double nonlinearResidual{0.0};
+  };
+
+  struct Step
+  {
+    int timeStepCount{0};
+    double time{0.0};
+    double timeStep{0.0};
+    Range preTime;
+    Range nonlinearTime;
+    Range postTime;
+    Range memoryHighWater;
+    //! largest Courant number over the fluids realms, negative if none
+    double maxCourant{-1.0};
+    std::vector<Equation> equations;
+  };
+
+  /** Open the stream on rank 0
+   *
+   *  Throws if rank 0 cannot open the file.
+   */
+  StepTelemetry(const std::string& fileName, MPI_Comm comm);
+
+  /** Reduce the rank-local values of the step and write it on rank 0
+   *
+   *  Collective; only the `min` members of the ranges need to be set on
+   *  entry, they hold the local value of the rank. Every rank must pass the
+   *  same list of equations.
+   */
+  void write_step(Step& step);
+
+  //! Reduce the local values, held in the `min` members, to rank 0
+  static void reduce(Step& step, MPI_Comm comm);
+
+  //! Write the step as a single line of JSON
+  static void write_json_line(std::ostream& os, const Step& step);
+
+private:
+  MPI_Comm comm_;
+  std::ofstream out_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* STEPTELEMETRY_H */
@@ -83,6 +83,19 @@ unsigned get_field_ordinal(
   return fState->mesh_meta_data_ordinal();
 }
 
+/** Return true if the field was put on at least one part of the mesh
+ *
+ *  Output-only diagnostics may be declared without being allocated, in which
+ *  case algorithms skip writing them.
+ */
+inline
+bool field_is_allocated(
+  const stk::mesh::MetaData& meta,
+  const unsigned ordinal)
+{
+  return !meta.get_fields()[ordinal]->restrictions().empty();
+}
+
 template <typename T = double>
 stk::mesh::NgpField<T>&
 get_node_field(
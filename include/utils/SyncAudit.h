@@ -0,0 +1,201 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+#ifndef SYNCAUDIT_H_
+#define SYNCAUDIT_H_
+
+#include <stk_mesh/base/FieldBase.hpp>
+#include <stk_mesh/base/NgpField.hpp>
+
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class MetaData;
+}
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/** Counters of the host/device field transfers
+ *
+ *  Every sync that actually moves data (the field was modified on the other
+ *  side) is recorded per field and per call site, with the number of bytes
+ *  allocated for the field on this rank. The counters are printed and reset
+ *  by report(), once per time step, which points at the fields bouncing
+ *  between host and device in the middle of a step.
+ *
+ *  Inactive by default; recording then costs a single branch per sync. The
+ *  auditor is host-side state shared by all realms of a rank; every realm
+ *  asking for the audit registers its mesh, the field counters are kept per
+ *  mesh, and a realm removes its mesh again before destroying it.
+ */
+class SyncAudit
+{
+public:
+  struct Counts
+  {
+    size_t toHost{0};
+    size_t toDevice{0};
+    double bytesToHost{0.0};
+    double bytesToDevice{0.0};
+
+    size_t transfers() const { return toHost + toDevice; }
+    double bytes() const { return bytesToHost + bytesToDevice; }
+  };
+
+  static SyncAudit& self();
+
+  //! Start recording the transfers of the fields of this mesh
+  void activate(const stk::mesh::BulkData& bulk, const std::string& name);
+
+  //! Stop recording the transfers of this mesh and drop its counters
+  void deactivate(const stk::mesh::BulkData& bulk);
+
+  bool active() const { return !meshes_.empty(); }
+
+  //! Record one transfer of an stk::mesh field
+  void record(
+    const stk::mesh::FieldBase& field,
+    const bool toDevice,
+    const char* file,
+    const int line);
+
+  //! Record one transfer of an NGP field, matched to the mesh that owns it
+  void record(
+    const stk::mesh::NgpFieldBase& field,
+    const unsigned ordinal,
+    const bool toDevice,
+    const char* file,
+    const int line);
+
+  /** Print the transfers since the last report and reset the counters
+   *
+   *  Collective over the ranks of every registered mesh; the field counters
+   *  of a mesh are summed over its ranks, the call site counters are those
+   *  of each rank printing.
+   */
+  void report(std::ostream& out, const int timeStepCount);
+
+  //! Field counters of a registered mesh, keyed by field ordinal
+  const std::map<unsigned, Counts>&
+  field_counts(const stk::mesh::BulkData& bulk) const;
+
+private:
+  SyncAudit() = default;
+  ~SyncAudit() = default;
+  SyncAudit(const SyncAudit&) = delete;
+  SyncAudit& operator=(const SyncAudit&) = delete;
+
+  struct Mesh
+  {
+    const stk::mesh::BulkData* bulk{nullptr};
+    std::string name;
+    std::map<unsigned, Counts> fields;
+
+    //! Bytes of every field, valid for one mesh modification cycle
+    std::vector<double> fieldBytes;
+    size_t bytesSyncCount{0};
+  };
+
+  Mesh* find_mesh(const stk::mesh::MetaData& meta);
+
+  void record(
+    Mesh& mesh,
+    const unsigned ordinal,
+    const bool toDevice,
+    const char* file,
+    const int line);
+
+  static double field_bytes(Mesh& mesh, const unsigned ordinal);
+
+  //! In activation order, which is the same on all ranks
+  std::vector<Mesh> meshes_;
+
+  //! Keyed by the __FILE__ literal and line of the call
+  std::map<std::pair<const char*, int>, Counts> sites_;
+};
+
+namespace impl {
+
+template <typename FieldType>
+inline void
+audit_record(
+  const FieldType& fld,
+  const bool toDevice,
+  const char* file,
+  const int line,
+  std::true_type)
+{
+  SyncAudit::self().record(fld, toDevice, file, line);
+}
+
+template <typename FieldType>
+inline void
+audit_record(
+  const FieldType& fld,
+  const bool toDevice,
+  const char* file,
+  const int line,
+  std::false_type)
+{
+  SyncAudit::self().record(fld, fld.get_ordinal(), toDevice, file, line);
+}
+
+//! Record the transfer of an stk::mesh::Field or of an NGP field
+template <typename FieldType>
+inline void
+audit_record(
+  const FieldType& fld, const bool toDevice, const char* file, const int line)
+{
+  audit_record(
+    fld, toDevice, file, line,
+    std::is_base_of<stk::mesh::FieldBase, FieldType>());
+}
+
+} // namespace impl
+
+//! sync_to_host, recorded by the SyncAudit when data is moved
+template <typename FieldType>
+inline void
+audited_sync_to_host(FieldType& fld, const char* file, const int line)
+{
+  auto& audit = SyncAudit::self();
+  if (audit.active() && fld.need_sync_to_host())
+    impl::audit_record(fld, false, file, line);
+  fld.sync_to_host();
+}
+
+//! sync_to_device, recorded by the SyncAudit when data is moved
+template <typename FieldType>
+inline void
+audited_sync_to_device(FieldType& fld, const char* file, const int line)
+{
+  auto& audit = SyncAudit::self();
+  if (audit.active() && fld.need_sync_to_device())
+    impl::audit_record(fld, true, file, line);
+  fld.sync_to_device();
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#define NALU_SYNC_TO_HOST(fld)                                                  \
+  sierra::nalu::audited_sync_to_host((fld), __FILE__, __LINE__)
+#define NALU_SYNC_TO_DEVICE(fld)                                                \
+  sierra::nalu::audited_sync_to_device((fld), __FILE__, __LINE__)
+
+#endif /* SYNCAUDIT_H_ */
@@ -0,0 +1,155 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TEAMSIZETUNER_H
+#define TEAMSIZETUNER_H
+
+#include "KokkosInterface.h"
+
+#include <mpi.h>
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Per-algorithm selection of the team size of NGP team launches
+ *
+ *  When active, the first launches of every algorithm key cycle through the
+ *  candidate team sizes of the device execution space, `Kokkos::AUTO` being
+ *  the first candidate. Each candidate is timed over a number of trials, the
+ *  slowest rank deciding, and the fastest one is used for all later
+ *  launches. Candidates whose per-thread scratch memory does not fit in the
+ *  level 1 scratch space are skipped.
+ *
+ *  The choices are kept in a cache, keyed by the execution space name and the
+ *  algorithm key, that can be written to disk and read back by later runs so
+ *  that they skip the tuning launches.
+ *
+ *  The vector length is kept at one: the assembly kernels only use
+ *  TeamThreadRange, and vector lanes would execute the scatter redundantly.
+ */
+class TeamSizeTuner
+{
+public:
+  //! Team size value standing for `Kokkos::AUTO`
+  static constexpr int autoTeamSize = 0;
+
+  //! Global instance used by the assembly algorithms
+  static TeamSizeTuner& self();
+
+  /** Enable tuning of the keys that are not in the cache
+   *
+   *  @param comm Communicator over which the timings are reduced
+   *  @param numTrials Timed launches per candidate team size
+   */
+  void activate(MPI_Comm comm, int numTrials);
+
+  bool active() const { return active_; }
+
+  //! True while the launches of `key` are being timed
+  bool is_tuning(const std::string& key) const;
+
+  /** Team policy for the next launch of `key`
+   *
+   *  Returns the `Kokkos::AUTO` policy of get_device_team_policy when the
+   *  tuner is inactive.
+   */
+  DeviceTeamPolicy policy(
+    const std::string& key,
+    size_t leagueSize,
+    size_t bytesPerTeam,
+    size_t bytesPerThread);
+
+  /** Record the time of the launch issued with the last policy of `key`
+   *
+   *  Collective over the tuning communicator once the last trial of the
+   *  last candidate is recorded.
+   */
+  void record(const std::string& key, double time);
+
+  //! Selected team size of `key`, autoTeamSize if unknown
+  int team_size(const std::string& key) const;
+
+  //! Read `<execution space>:<key> <team size>` lines; other spaces ignored
+  void read_cache(std::istream& is);
+  void read_cache(const std::string& fileName);
+
+  //! Write the selected team sizes, merged with the entries read earlier
+  void write_cache(std::ostream& os) const;
+
+  //! Collective; writes the cache on rank 0
+  void write_cache(const std::string& fileName, MPI_Comm comm) const;
+
+  //! Candidate team sizes of the device execution space
+  static std::vector<int>
+  candidate_team_sizes(size_t bytesPerTeam, size_t bytesPerThread);
+
+  //! Forget all tuning state and cached choices
+  void reset();
+
+private:
+  struct Entry
+  {
+    std::vector<int> candidates;
+    std::vector<double> bestTimes;
+    size_t candidate{0};
+    int trial{0};
+    int teamSize{autoTeamSize};
+    bool tuned{false};
+  };
+
+  std::string cache_key(const std::string& key) const;
+
+  std::map<std::string, Entry> entries_;
+
+  //! Cache lines read from disk for other execution spaces, kept on write
+  std::map<std::string, int> foreignEntries_;
+
+  MPI_Comm comm_{MPI_COMM_WORLD};
+  int numTrials_{3};
+  bool active_{false};
+};
+
+/** RAII helper that times one team launch for the TeamSizeTuner
+ *
+ *  The device is fenced at construction and destruction only while the
+ *  key is being tuned.
+ */
+class TunedTeamLaunch
+{
+public:
+  explicit TunedTeamLaunch(const std::string& key);
+
+  ~TunedTeamLaunch();
+
+  TunedTeamLaunch(const TunedTeamLaunch&) = delete;
+  TunedTeamLaunch& operator=(const TunedTeamLaunch&) = delete;
+
+  DeviceTeamPolicy
+  policy(size_t leagueSize, size_t bytesPerTeam, size_t bytesPerThread) const
+  {
+    return TeamSizeTuner::self().policy(
+      key_, leagueSize, bytesPerTeam, bytesPerThread);
+  }
+
+private:
+  const std::string key_;
+  const bool tuning_;
+  double startTime_{0.0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* TEAMSIZETUNER_H */
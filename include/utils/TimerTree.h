@@ -0,0 +1,146 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TIMERTREE_H
+#define TIMERTREE_H
+
+#include <mpi.h>
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Hierarchical registry of wall-clock timers
+ *
+ *  Timers are started and stopped in a strictly nested fashion; a timer
+ *  started while another is running becomes its child. Each node accumulates
+ *  the inclusive time and the number of calls, the exclusive time is derived
+ *  by subtracting the inclusive time of the children.
+ *
+ *  The tree is reduced across all ranks of a communicator (min/max/avg of the
+ *  inclusive and exclusive times) and can be written as a JSON document.
+ *  Ranks that never entered a given timer do not contribute to its min/avg.
+ *
+ *  Every timer is also pushed as a Kokkos::Profiling region, so profiling
+ *  tools attached through Kokkos::Tools see the same call tree.
+ *
+ *  Optionally, a source of hardware event counts (see HardwareCounters.h) is
+ *  read whenever a timer starts and stops, and the inclusive counts of every
+ *  timer are reduced and written next to its times.
+ */
+class TimerTree
+{
+public:
+  struct Node
+  {
+    Node(const std::string& name, Node* parent) : name_(name), parent_(parent)
+    {}
+
+    Node* find_or_create_child(const std::string& name);
+
+    double exclusive_time() const;
+
+    std::string name_;
+    Node* parent_{nullptr};
+    double inclusive_{0.0};
+    double startTime_{0.0};
+    unsigned long count_{0};
+    //! inclusive event counts, one per counter name
+    std::vector<long long> counters_;
+    std::vector<long long> startCounters_;
+    std::vector<std::unique_ptr<Node>> children_;
+  };
+
+  //! Monotonically increasing event counts of the calling thread
+  struct CounterSource
+  {
+    std::vector<std::string> names;
+    //! Write the current count of every event in `names`
+    std::function<void(long long*)> read;
+  };
+
+  TimerTree();
+
+  //! Global instance used by the solver instrumentation
+  static TimerTree& self();
+
+  //! Start a timer as a child of the currently running timer
+  void start(const std::string& name);
+
+  //! Stop the currently running timer
+  void stop();
+
+  //! Discard all accumulated timings
+  void reset();
+
+  //! Fence the Kokkos device before reading the clock so that asynchronous
+  //! kernel launches are attributed to the timer that issued them
+  void set_fence_device(bool fence) { fenceDevice_ = fence; }
+
+  bool fence_device() const { return fenceDevice_; }
+
+  /** Read these counters whenever a timer starts and stops
+   *
+   *  Discards the accumulated timings; throws if timers are running. The
+   *  names must be the same on all ranks for write_json.
+   */
+  void set_counter_source(CounterSource source);
+
+  const std::vector<std::string>& counter_names() const
+  {
+    return counterSource_.names;
+  }
+
+  //! Number of timers currently running
+  int depth() const;
+
+  const Node& root() const { return root_; }
+
+  /** Reduce the tree across ranks and write it as JSON on rank 0
+   *
+   *  Collective over `comm`; timers still running are not included.
+   */
+  void write_json(std::ostream& os, MPI_Comm comm) const;
+
+  //! Collective; opens `fileName` on rank 0 and calls write_json
+  void write_json(const std::string& fileName, MPI_Comm comm) const;
+
+private:
+  Node root_;
+  Node* current_{nullptr};
+  bool fenceDevice_{false};
+  CounterSource counterSource_;
+  std::vector<long long> counterValues_;
+};
+
+/** RAII helper that times the enclosing scope in TimerTree::self()
+ */
+class ScopedTimer
+{
+public:
+  explicit ScopedTimer(const std::string& name)
+  {
+    TimerTree::self().start(name);
+  }
+
+  ~ScopedTimer() { TimerTree::self().stop(); }
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* TIMERTREE_H */
@@ -0,0 +1,200 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef WALLFACEBVH_H
+#define WALLFACEBVH_H
+
+#include "KokkosInterface.h"
+
+#include "stk_math/StkMath.hpp"
+
+#include <cfloat>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Bounding volume hierarchy over wall faces for nearest-face queries
+ *
+ *  Faces are stored as triangles of three 3-D vertices; in 2-D a face is a
+ *  line segment stored as the triangle (a, b, b) with zero z coordinates.
+ *  The tree is built on the host by median splits along the longest extent
+ *  of the face centroids and copied to device memory, where distance() can
+ *  be called from a kernel.
+ */
+class WallFaceBVH
+{
+public:
+  //! Doubles per face: three vertices of three coordinates
+  static constexpr int faceStride = 9;
+
+  //! Maximum faces per leaf
+  static constexpr int leafSize = 4;
+
+  //! Traversal stack depth; bounds the tree depth
+  static constexpr int maxDepth = 64;
+
+  /**
+   *  @param nDim  Spatial dimension; faces are segments when 2
+   *  @param faces faceStride doubles per face
+   */
+  WallFaceBVH(const int nDim, const std::vector<double>& faces);
+
+  size_t num_faces() const { return numFaces_; }
+
+  //! Distance from the 3-D point `x` to the nearest face; DBL_MAX if empty
+  KOKKOS_INLINE_FUNCTION
+  double distance(const double* x) const
+  {
+    if (numFaces_ == 0)
+      return DBL_MAX;
+
+    double best = DBL_MAX;
+    int stack[maxDepth];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+      const int n = stack[--top];
+      if (box_distance_sq(n, x) >= best)
+        continue;
+
+      const int count = tree_(n, 1);
+      if (count > 0) {
+        for (int f = tree_(n, 0); f < tree_(n, 0) + count; ++f) {
+          const double* a = &faces_(f, 0);
+          const double d2 = isSegment_
+                              ? segment_distance_sq(x, a, a + 3)
+                              : triangle_distance_sq(x, a, a + 3, a + 6);
+          best = (d2 < best) ? d2 : best;
+        }
+      } else {
+        // visit the nearer child first
+        const int left = tree_(n, 0);
+        const bool leftFirst =
+          box_distance_sq(left, x) <= box_distance_sq(left + 1, x);
+        stack[top++] = leftFirst ? left + 1 : left;
+        stack[top++] = leftFirst ? left : left + 1;
+      }
+    }
+    return stk::math::sqrt(best);
+  }
+
+private:
+  KOKKOS_INLINE_FUNCTION
+  double box_distance_sq(const int n, const double* x) const
+  {
+    double d2 = 0.0;
+    for (int d = 0; d < 3; ++d) {
+      const double lo = boxes_(n, d) - x[d];
+      const double hi = x[d] - boxes_(n, 3 + d);
+      const double delta = (lo > 0.0) ? lo : ((hi > 0.0) ? hi : 0.0);
+      d2 += delta * delta;
+    }
+    return d2;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static double
+  dot(const double* u, const double* v)
+  {
+    return u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static double
+  segment_distance_sq(const double* p, const double* a, const double* b)
+  {
+    double ab[3], ap[3];
+    for (int d = 0; d < 3; ++d) {
+      ab[d] = b[d] - a[d];
+      ap[d] = p[d] - a[d];
+    }
+    const double len2 = dot(ab, ab);
+    double t = (len2 > 0.0) ? dot(ap, ab) / len2 : 0.0;
+    t = (t < 0.0) ? 0.0 : ((t > 1.0) ? 1.0 : t);
+    double d2 = 0.0;
+    for (int d = 0; d < 3; ++d) {
+      const double r = ap[d] - t * ab[d];
+      d2 += r * r;
+    }
+    return d2;
+  }
+
+  //! Squared distance to a triangle by Voronoi region of the closest point
+  KOKKOS_INLINE_FUNCTION
+  static double triangle_distance_sq(
+    const double* p, const double* a, const double* b, const double* c)
+  {
+    double ab[3], ac[3], ap[3], bp[3], cp[3];
+    for (int d = 0; d < 3; ++d) {
+      ab[d] = b[d] - a[d];
+      ac[d] = c[d] - a[d];
+      ap[d] = p[d] - a[d];
+      bp[d] = p[d] - b[d];
+      cp[d] = p[d] - c[d];
+    }
+
+    const double d1 = dot(ab, ap);
+    const double d2 = dot(ac, ap);
+    if (d1 <= 0.0 && d2 <= 0.0)
+      return dot(ap, ap);
+
+    const double d3 = dot(ab, bp);
+    const double d4 = dot(ac, bp);
+    if (d3 >= 0.0 && d4 <= d3)
+      return dot(bp, bp);
+
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+      return segment_distance_sq(p, a, b);
+
+    const double d5 = dot(ab, cp);
+    const double d6 = dot(ac, cp);
+    if (d6 >= 0.0 && d5 <= d6)
+      return dot(cp, cp);
+
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+      return segment_distance_sq(p, a, c);
+
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+      return segment_distance_sq(p, b, c);
+
+    // interior of the face
+    const double denom = 1.0 / (va + vb + vc);
+    const double v = vb * denom;
+    const double w = vc * denom;
+    double d2sum = 0.0;
+    for (int d = 0; d < 3; ++d) {
+      const double r = ap[d] - v * ab[d] - w * ac[d];
+      d2sum += r * r;
+    }
+    return d2sum;
+  }
+
+  size_t numFaces_{0};
+  bool isSegment_{false};
+
+  //! Faces reordered so that every leaf holds a contiguous range; row major
+  //! so that the vertices of a face are contiguous
+  Kokkos::View<const double* [faceStride], Kokkos::LayoutRight, MemSpace>
+    faces_;
+
+  //! Bounding box of every tree node: min x,y,z then max x,y,z
+  Kokkos::View<const double* [6], MemSpace> boxes_;
+
+  //! Leaf: first face and count; interior: left child (right is left + 1), 0
+  Kokkos::View<const int* [2], MemSpace> tree_;
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* WALLFACEBVH_H */
@@ -0,0 +1,162 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef WallFrictionVelocity_h
+#define WallFrictionVelocity_h
+
+#include "KokkosInterface.h"
+#include "SimdInterface.h"
+#include "wind_energy/MoninObukhov.h"
+
+namespace sierra {
+namespace nalu {
+namespace wall_friction_velocity {
+
+/** Friction velocity from the log law, u+ = log(E y+) / kappa
+ *
+ *  Newton iteration with a fixed number of steps so that the same code path
+ *  is taken by all SIMD lanes and GPU threads. A lane stops updating once its
+ *  Newton step drops below the tolerance, which reproduces the early exit of
+ *  the scalar iteration.
+ *
+ *  @param[in] up Tangential velocity at the first point off the wall
+ *  @param[in] yp Normal distance of that point from the wall
+ *  @param[in] utauGuess Initial guess of the friction velocity
+ *  @param[out] converged 1.0 in the lanes that converged, 0.0 otherwise
+ */
+template <typename T>
+KOKKOS_INLINE_FUNCTION T
+log_law(
+  const T& up,
+  const T& yp,
+  const T& density,
+  const T& viscosity,
+  const T& utauGuess,
+  const double kappa,
+  const double elog,
+  const double tolerance,
+  const int maxIters,
+  T& converged)
+{
+  const T A = elog * density * yp / viscosity;
+
+  T utau = utauGuess;
+  converged = 0.0;
+  for (int k = 0; k < maxIters; ++k) {
+    const T wrk = stk::math::log(A * utau);
+    const T fPrime = -(1.0 + wrk);
+    const T f = kappa * up - utau * wrk;
+    const T df = f / fPrime;
+
+    const auto active = (converged < 0.5);
+    utau = stk::math::if_then_else(active, utau - df, utau);
+    converged = stk::math::if_then_else(
+      active && (stk::math::abs(df) < tolerance), T(1.0), converged);
+  }
+  return utau;
+}
+
+/** Friction velocity from Monin-Obukhov similarity theory
+ *
+ *  Secant iteration on utau = kappa uh / (log(zh/z0) - psi_m(zh/L)) with a
+ *  fixed number of steps. The stable and unstable stability functions are
+ *  both evaluated and selected on the sign of the surface temperature flux,
+ *  and lanes with a vanishing flux take the neutral log law.
+ *
+ *  @param[in] uh Tangential velocity at the first point off the wall
+ *  @param[in] zh Normal distance of that point from the wall
+ *  @param[in] term log(zh/z0)
+ *  @param[in] Tflux Surface temperature flux, q / (rho cp)
+ *  @param[in] Lfac Obukhov length divided by utau^3
+ */
+template <typename T>
+KOKKOS_INLINE_FUNCTION T
+monin_obukhov(
+  const T& uh,
+  const T& zh,
+  const T& term,
+  const T& Tflux,
+  const T& Lfac,
+  const T& kappa,
+  const T& beta_m,
+  const T& gamma_m)
+{
+  namespace mo = abl_monin_obukhov;
+
+  const double eps = 1.0e-8;
+  const double convTol = 1.0e-7;
+  const double perturb = 1.0e-3;
+  const int maxIters = 40;
+
+  const auto unstable = (Tflux > 0.0);
+  const T sgnq = stk::math::if_then_else(unstable, T(1.0), T(-1.0));
+
+  const T utauNeutral = kappa * uh / term;
+  T utau0 = stk::math::if_then_else(unstable, 3.0 * utauNeutral, utauNeutral);
+  T utau1 = (1.0 + perturb) * utau0;
+  T utau = utau0;
+  T converged = 0.0;
+
+  for (int k = 0; k < maxIters; ++k) {
+    const T L0 =
+      -sgnq *
+      stk::math::max(1.0e-10, stk::math::abs(utau0 * utau0 * utau0 * Lfac));
+    const T L1 =
+      -sgnq *
+      stk::math::max(1.1e-10, stk::math::abs(utau1 * utau1 * utau1 * Lfac));
+
+    const T znorm0 = zh / L0;
+    const T znorm1 = zh / L1;
+
+    // zh/L is negative in the unstable lanes, the clip only keeps the
+    // discarded unstable evaluation of the stable lanes finite
+    const T psi0 = stk::math::if_then_else(
+      unstable, mo::psim_unstable(stk::math::min(znorm0, 0.0), gamma_m),
+      mo::psim_stable(znorm0, beta_m));
+    const T psi1 = stk::math::if_then_else(
+      unstable, mo::psim_unstable(stk::math::min(znorm1, 0.0), gamma_m),
+      mo::psim_stable(znorm1, beta_m));
+
+    const T f0 = utau0 - uh * kappa / (term - psi0);
+    const T f1 = utau1 - uh * kappa / (term - psi1);
+
+    T dutau = utau1 - utau0;
+    dutau = stk::math::if_then_else(
+      (dutau > 0.0), stk::math::max(1.0e-15, dutau),
+      stk::math::min(-1.0e-15, dutau));
+
+    T fprime = (f1 - f0) / dutau;
+    fprime = stk::math::if_then_else(
+      (fprime > 0.0), stk::math::max(1.0e-15, fprime),
+      stk::math::min(-1.0e-15, fprime));
+
+    const T utauNew = utau0 - f0 / fprime;
+
+    const auto active = (converged < 0.5);
+    const auto done = active && (stk::math::abs(f1) < convTol);
+    utau = stk::math::if_then_else(done, stk::math::max(0.0, utauNew), utau);
+    converged = stk::math::if_then_else(done, T(1.0), converged);
+
+    const auto update = (converged < 0.5);
+    utau0 = stk::math::if_then_else(update, utau1, utau0);
+    utau1 = stk::math::if_then_else(update, utauNew, utau1);
+  }
+
+  // Lanes with no velocity at the first point, including the padded lanes of
+  // a partially filled SIMD group, return epsilon
+  return stk::math::if_then_else(
+    (stk::math::abs(uh) < eps), T(eps),
+    stk::math::if_then_else((stk::math::abs(Tflux) > eps), utau, utauNeutral));
+}
+
+} // namespace wall_friction_velocity
+} // namespace nalu
+} // namespace sierra
+
+#endif
@@ -87,9 +87,21 @@ public:
   //! Parse input file for user options and initialize
   void load(const YAML::Node&);
 
+  //! Register the per-node height interpolation fields
+  void setup();
+
   //! Initialize ABL forcing (steps after mesh creation)
   void initialize();
 
+  /** Cache the source table index and weight of every node's height
+   *
+   *  Fills `abl_forcing_height_index` and `abl_forcing_height_weight`, two
+   *  components each for the velocity and temperature tables. The search is
+   *  repeated only when the mesh is modified, or once per time step when the
+   *  mesh moves.
+   */
+  void update_height_cache();
+
   //! Execute field transfers, compute planar averaging, and determine source
   //! terms at desired levels.
   void execute();
@@ -115,23 +127,19 @@ public:
     return (momentumForcingOn() || temperatureForcingOn());
   }
 
+  //! Temperature source table on device, updated once per step by execute()
   inline ABLScalarInterpolator& temperature_source_interpolator()
   {
-    if (!TSrcInterp_) {
+    if (!TSrcInterp_)
       TSrcInterp_.reset(new ABLScalarInterpolator(tempHeights_, TSource_));
-    } else {
-      TSrcInterp_->update_view_on_device(TSource_);
-    }
     return *TSrcInterp_;
   }
 
+  //! Momentum source table on device, updated once per step by execute()
   inline ABLVectorInterpolator& velocity_source_interpolator()
   {
-    if (!USrcInterp_) {
+    if (!USrcInterp_)
       USrcInterp_.reset(new ABLVectorInterpolator(velHeights_, USource_));
-    } else {
-      USrcInterp_->update_view_on_device(USource_);
-    }
     return *USrcInterp_;
   }
 
@@ -222,6 +230,15 @@ private:
   //! Write frequency for source term output
   int outputFreq_{10};
 
+  //! Bulk synchronization count when the height cache was computed
+  size_t heightCacheSyncCount_{0};
+
+  //! Time step when the height cache was computed
+  int heightCacheStep_{-1};
+
+  //! Flag indicating the height cache has been computed
+  bool heightCacheValid_{false};
+
   //! Format string specifier indicating the file name for output. The
   //! specification takes one `%s` specifier that is used to populate Ux, Uy,
   //! Uz, T. Default is "abl_sources_%s.dat"
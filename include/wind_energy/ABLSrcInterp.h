@@ -37,6 +37,32 @@ unsigned abl_find_index(
   }
   return (npts - 2);
 }
+
+/** Lower table index and linear weight of `xout`, clipped to the table range
+ *
+ *  The interpolated value is `(1 - fac) * y(idx) + fac * y(idx + 1)`, where
+ *  the second term is dropped when `fac` is zero so that single-entry tables
+ *  are supported.
+ */
+KOKKOS_FORCEINLINE_FUNCTION
+void abl_interp_weight(
+  const Array1D& xinp,
+  const double& xout,
+  int& idx,
+  double& fac)
+{
+  const unsigned npts = xinp.extent(0);
+  if ((npts == 1) || (xout <= xinp(0))) {
+    idx = 0;
+    fac = 0.0;
+  } else if (xout >= xinp(npts - 1)) {
+    idx = npts - 2;
+    fac = 1.0;
+  } else {
+    idx = abl_find_index(xinp, xout);
+    fac = (xout - xinp(idx)) / (xinp(idx + 1) - xinp(idx));
+  }
+}
 }
 
 /** NGP-friendly source interpolation class for use with ABL forcing term
@@ -97,6 +123,21 @@ public:
     }
   }
 
+  //! Interpolation index and weight of a height; see abl_interp_weight
+  KOKKOS_FORCEINLINE_FUNCTION
+  void interp_weight(const double& xout, int& idx, double& fac) const
+  {
+    abl_impl::abl_interp_weight(xinp_, xout, idx, fac);
+  }
+
+  //! Source at a height given by its precomputed index and weight
+  KOKKOS_FORCEINLINE_FUNCTION
+  void operator()(const int idx, const double fac, double& yout) const
+  {
+    const int idx1 = (fac > 0.0) ? idx + 1 : idx;
+    yout = (1.0 - fac) * yinp_(idx) + fac * yinp_(idx1);
+  }
+
 private:
   //! Height array (device view)
   Array1D xinp_;
@@ -179,6 +220,22 @@ public:
     }
   }
 
+  //! Interpolation index and weight of a height; see abl_interp_weight
+  KOKKOS_FORCEINLINE_FUNCTION
+  void interp_weight(const double& xout, int& idx, double& fac) const
+  {
+    abl_impl::abl_interp_weight(xinp_, xout, idx, fac);
+  }
+
+  //! Source at a height given by its precomputed index and weight
+  KOKKOS_FORCEINLINE_FUNCTION
+  void operator()(const int idx, const double fac, double* yout) const
+  {
+    const int idx1 = (fac > 0.0) ? idx + 1 : idx;
+    for (int d=0; d < ndim; d++)
+      yout[d] = (1.0 - fac) * yinp_(idx, d) + fac * yinp_(idx1, d);
+  }
+
 private:
   static constexpr int ndim = 3;
 
@@ -13,6 +13,7 @@
 
 #include "FieldTypeDef.h"
 
+#include <string>
 #include <vector>
 
 namespace YAML { class Node; }
@@ -34,6 +35,12 @@ public:
     ScalarIntFieldType&,
     std::vector<double>&) = 0;
 
+  /** Node field holding the height of the nodes used for binning
+   *
+   *  Empty when the height is the wall normal coordinate
+   */
+  virtual std::string node_height_field() const { return ""; }
+
 protected:
   Realm& realm_;
 
@@ -79,6 +86,46 @@ private:
   RectilinearMeshHeightAlg(const RectilinearMeshHeightAlg&) = delete;
 };
 
+/** Height above ground of unstructured, terrain-following meshes
+ *
+ *  The height of a node is its distance to the nearest wall, taken from the
+ *  `minimum_distance_to_wall` field computed by the WallDistance equation
+ *  system. Nodes are binned in uniform intervals of `height_bin_size`; the
+ *  empty intervals are dropped and the height of a level is the mean height
+ *  of the nodes in it.
+ */
+class WallDistanceHeightAlg : public BdyHeightAlgorithm
+{
+public:
+  WallDistanceHeightAlg(
+    Realm&,
+    const YAML::Node&);
+
+  virtual ~WallDistanceHeightAlg() {}
+
+  virtual void calc_height_levels(
+    stk::mesh::Selector&,
+    ScalarIntFieldType&,
+    std::vector<double>&) override;
+
+  virtual std::string node_height_field() const override
+  { return wallDistName_; }
+
+protected:
+  //! Process yaml inputs and initialize the class data
+  void load(const YAML::Node&);
+
+  //! Name of the wall distance field
+  std::string wallDistName_{"minimum_distance_to_wall"};
+
+  //! Size of the height intervals
+  double binSize_{0.0};
+
+private:
+  WallDistanceHeightAlg() = delete;
+  WallDistanceHeightAlg(const WallDistanceHeightAlg&) = delete;
+};
+
 }  // nalu
 }  // sierra
 
@@ -15,8 +15,11 @@
 #include "FieldTypeDef.h"
 
 #include "stk_mesh/base/Part.hpp"
+#include "stk_mesh/base/Types.hpp"
 
 #include <memory>
+#include <sstream>
+#include <string>
 
 namespace YAML { class Node; }
 
@@ -37,12 +40,22 @@ class BdyHeightAlgorithm;
  *
  *  The temporal averaging is perfomed via
  *  sierra::nalu::TurbulenceAveragingPostProcessing class.
+ *
+ *  The spatial averages are computed by a segmented reduction: the nodes are
+ *  sorted by height level once per mesh modification, and one team per level
+ *  sums the volume weighted statistics of its nodes into a packed
+ *  [nHeights, numStats] buffer, which is reduced across ranks in a single
+ *  MPI_Allreduce per time step.
  */
 class BdyLayerStatistics
 {
 public:
   using ArrayType = Kokkos::View<double*, Kokkos::LayoutRight, MemSpace>;
   using HostArrayType = typename ArrayType::HostMirror;
+  using StatsArrayType = Kokkos::View<double**, Kokkos::LayoutRight, MemSpace>;
+
+  //! Upper bound on the number of packed statistics per height level
+  static constexpr int maxStats = 48;
 
   BdyLayerStatistics(
     Realm&,
@@ -100,6 +113,10 @@ public:
   //! Return the reference to the heights vector
   const HostArrayType& abl_heights() const { return heights_; }
 
+  //! Node field of the heights used for binning, empty for the wall normal
+  //! coordinate
+  std::string node_height_field() const;
+
   //! Return the index in height array
   //!
   //! Returns index into the height array such that
@@ -120,6 +137,16 @@ private:
   //! Process the user inputs and initialize class data
   void load(const YAML::Node&);
 
+  //! Sort the averaged nodes by height level; no-op unless the mesh changed
+  void build_height_bins();
+
+  /** Sum the volume weighted statistics of every height level
+   *
+   *  Fills stats_ with the global sums of all velocity and, if requested,
+   *  temperature statistics; see the column layout in the implementation.
+   */
+  void accumulate_statistics();
+
   //! Initialize necessary parameters in sierra::nalu::TurbulenceAveragingPostProcessing
   void setup_turbulence_averaging(const double);
 
@@ -129,6 +156,9 @@ private:
   //! Output averaged temperature profiles as a function of height
   void output_temperature_averages();
 
+  //! Write the buffered contents to `fileName`, replacing the previous profile
+  void write_profile(const std::string&, const std::ostringstream&) const;
+
   /** Helper method to perform interpolations across data with multiple components
    *
    *  @param[in] nComp The number of components: scalar=1, vector=3, tensor=6 and so on
@@ -152,55 +182,17 @@ private:
   //! Reference to Realm object
   Realm& realm_;
 
-  //! Spatially averaged instantaneous velocity at desired heights [nHeights, nDim]
-  ArrayType d_velAvg_;
-
-  //! Spatially averaged instantaneous horizontal velocity magnitude at desired heights [nHeights]
-  ArrayType d_velMagAvg_;
-
-  //! Spatially and temporally averaged velocity at desired heights [nHeights, nDim]
-  ArrayType d_velBarAvg_;
-
-  //! Spatially averaged resolved stress [nHeights, nDim]
-  ArrayType d_uiujAvg_;
+  //! Averaged nodes sorted by height level
+  Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace> d_binNodes_;
 
-  //! Spatially averaged sfs stress [nHeights, nDim]
-  ArrayType d_sfsAvg_;
+  //! Offsets of every height level into d_binNodes_ [nHeights + 1]
+  Kokkos::View<int*, MemSpace> d_binOffsets_;
 
-  //! Spatially and temporally averaged resolved stress field at desired heights [nHeights, nDim * 2]
-  ArrayType d_uiujBarAvg_;
+  //! Packed per-level sums of all statistics [nHeights, numStats_]
+  StatsArrayType d_stats_;
 
-  //! Spatially and temporally averaged SFS field at desired heights [nHeights, nDim * 2]
-  ArrayType d_sfsBarAvg_;
-
-  //! Spatially averaged instantaneous temperature field [nHeights]
-  ArrayType d_thetaAvg_;
-
-  //! Spatially and temporally averaged temperature field [nHeights]
-  ArrayType d_thetaBarAvg_;
-
-  //! Spatially averaged instantaneous temperature SFS field
-  ArrayType d_thetaSFSAvg_;
-
-  //! Spatially averaged instantaneous temperature variance
-  ArrayType d_thetaUjAvg_;
-
-  //! Spatially and temporally averaged Temperature SFS field
-  ArrayType d_thetaSFSBarAvg_;
-
-  ArrayType d_thetaUjBarAvg_;
-
-  //! Spatially averaged temperature variance [nHeights]
-  ArrayType d_thetaVarAvg_;
-
-  //! Spatially and temporally averaged temperature variance [nHeights]
-  ArrayType d_thetaBarVarAvg_;
-
-  //! Total nodal volume at each height level used for volumetric averaging
-  ArrayType d_sumVol_;
-
-  //! Average density at each height level
-  ArrayType d_rhoAvg_;
+  //! Host copy of d_stats_, summed across ranks
+  typename StatsArrayType::HostMirror stats_;
 
   //! Height from the wall
   ArrayType d_heights_;
@@ -290,6 +282,12 @@ private:
 
   std::unique_ptr<BdyHeightAlgorithm> bdyHeightAlg_;
 
+  //! Number of packed statistics per height level
+  int numStats_{0};
+
+  //! Bulk synchronization count when the height bins were built
+  size_t binSyncCount_{0};
+
   //! Calculate temperature statistics
   bool calcTemperatureStats_{true};
 
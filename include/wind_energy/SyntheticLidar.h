@@ -65,6 +65,14 @@ private:
   std::array<double, 3> groundNormal_{{0,0,1}};
 };
 
+/** Line of sight probes of one or more spinner lidars
+ *
+ *  `lidar_specifications` is either a single lidar or a sequence of lidars.
+ *  The beams of all lidars are collected into one data probe specification,
+ *  so every beam point of every lidar is located and interpolated together
+ *  (one interpolation kernel per field with device sampling) at each output
+ *  step.
+ */
 class LidarLineOfSite
 {
 public:
@@ -73,6 +81,9 @@ public:
 private:
   void load(const YAML::Node& node);
 
+  // beams of this lidar; probe owners continue from probeOffset
+  std::unique_ptr<DataProbeInfo> line_of_site_probes(int probeOffset) const;
+
   SpinnerLidarSegmentGenerator segGen;
 
   double scanTime_{2};
@@ -0,0 +1,144 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef BoundaryPlaneChannel_h
+#define BoundaryPlaneChannel_h
+
+#include <KokkosInterface.h>
+
+#include <stk_mesh/base/Types.hpp>
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+/** In-memory boundary-plane channel between two realms of one job
+ *
+ *  The nodes of the "from" parts of a precursor realm are matched once, by
+ *  coordinates, to the nodes of the "to" parts of the receiving realm, and
+ *  the exchange pattern between their ranks is stored. Every converged step
+ *  of the precursor publishes one time level: the receives are posted and
+ *  the values of the owned plane nodes are sent with nonblocking messages
+ *  on a private communicator, and the solver continues. The receiving realm
+ *  completes the messages at its next external data transfer, keeps the
+ *  last `buffered_levels` levels and interpolates them linearly on device
+ *  at its current time minus `time_lag`.
+ *
+ *  Both realms advance in the same time loop, so the newest level is one
+ *  step behind the receiving realm; without a lag of at least one time step
+ *  the receiving realm holds the newest level.
+ */
+class BoundaryPlaneChannel
+{
+public:
+  BoundaryPlaneChannel(
+    Realm& fromRealm,
+    Realm& toRealm,
+    const stk::mesh::PartVector& fromParts,
+    const stk::mesh::PartVector& toParts,
+    const std::vector<std::pair<std::string, std::string>>& fieldNames,
+    const double tolerance,
+    const double timeLag,
+    const int bufferedLevels);
+
+  ~BoundaryPlaneChannel();
+
+  BoundaryPlaneChannel(const BoundaryPlaneChannel&) = delete;
+  BoundaryPlaneChannel& operator=(const BoundaryPlaneChannel&) = delete;
+
+  //! Match the plane nodes and set up the exchange pattern
+  void initialize();
+
+  //! Post the messages of the current level of the "from" realm
+  void publish();
+
+  //! Complete the pending levels and fill the fields of the "to" realm
+  void receive();
+
+  int num_published() const { return numPublished_; }
+
+private:
+  using LevelView = Kokkos::View<double**, MemSpace>;
+
+  struct Level
+  {
+    int id_{0};
+    double time_{0.0};
+    std::vector<double> data_;
+  };
+
+  //! A level whose messages are in flight
+  struct PendingLevel
+  {
+    Level level_;
+    std::vector<std::vector<double>> sendBuffers_;
+    std::vector<std::vector<double>> recvBuffers_;
+    std::vector<MPI_Request> requests_;
+  };
+
+  void complete(PendingLevel& pending);
+  void upload(const Level& level, LevelView& view);
+
+  Realm& fromRealm_;
+  Realm& toRealm_;
+  stk::mesh::PartVector fromParts_;
+  stk::mesh::PartVector toParts_;
+  std::vector<std::pair<std::string, std::string>> fieldNames_;
+  const double tolerance_;
+  const double timeLag_;
+  const int bufferedLevels_;
+
+  MPI_Comm comm_{MPI_COMM_NULL};
+
+  //! Source fields and the offset of their components in a node
+  std::vector<const stk::mesh::FieldBase*> fromFields_;
+  std::vector<std::pair<const stk::mesh::FieldBase*, int>> toFields_;
+  int valuesPerNode_{0};
+
+  //! Owned plane nodes of the "from" realm sent to every destination rank
+  std::vector<stk::mesh::Entity> fromNodes_;
+  std::vector<int> sendRanks_;
+  std::vector<std::vector<int>> sendNodes_;
+
+  //! Plane nodes of the "to" realm received from every source rank
+  std::vector<stk::mesh::EntityId> toNodeIds_;
+  std::vector<int> recvRanks_;
+  std::vector<std::vector<int>> recvNodes_;
+
+  int numPublished_{0};
+  std::deque<PendingLevel> pending_;
+  std::deque<Level> levels_;
+
+  Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace> nodes_;
+  size_t syncCount_{0};
+  LevelView levelA_;
+  LevelView levelB_;
+  LevelView::HostMirror hostLevel_;
+  int idA_{-1};
+  int idB_{-1};
+  bool warnedStagger_{false};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -29,6 +29,9 @@
 #include <stk_search/BoundingBox.hpp>
 
 #include <FieldTypeDef.h>
+#include <utils/SyncAudit.h>
+
+#include <stk_mesh/base/GetNgpField.hpp>
 
 // stk
 namespace stk {
@@ -233,14 +236,21 @@ public :
   void update_values()
   {
     if (ghosting_) {
+      // the ghost exchange is done on host
+      for (const auto* fld : fromFieldVec_) {
+        auto& ngpFld = stk::mesh::get_updated_ngp_field<double>(*fld);
+        NALU_SYNC_TO_HOST(ngpFld);
+      }
       std::vector<const stk::mesh::FieldBase *> fields(fromFieldVec_.begin(), fromFieldVec_.end());
-      if (mesh_modified_) {
-        // Copy coordinates to the newly ghosted nodes
+      if (mesh_modified_ || fromRealm_.does_mesh_move()) {
+        // Copy coordinates to the newly ghosted nodes, or the moved ones
         mesh_modified_ = false;
         fields.push_back(fromcoordinates_);
       }
       stk::mesh::communicate_field_data( *ghosting_ ,    fields);
       stk::mesh::copy_owned_to_shared  (  fromBulkData_, fields);
+      for (const auto* fld : fromFieldVec_)
+        stk::mesh::get_updated_ngp_field<double>(*fld).modify_on_host();
     }
   }
 
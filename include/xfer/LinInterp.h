@@ -20,6 +20,8 @@
 #include <stk_mesh/base/Entity.hpp>
 
 #include <Realm.h>
+#include <NaluEnv.h>
+#include <xfer/TransferInterpMap.h>
 #include <master_element/MasterElement.h>
 #include <master_element/MasterElementFactory.h>
 
@@ -154,61 +156,33 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::apply
   
   const stk::mesh::BulkData &fromBulkData = FromElem.fromBulkData_;
   stk::mesh::BulkData         &toBulkData = ToPoints.toBulkData_;
- 
-  typename EntityKeyMap::const_iterator ii;
-  for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) { 
-    
-    const stk::mesh::EntityKey thePt  = ii->first;
-    const stk::mesh::EntityKey theBox = ii->second; 
-    
-    if (1 != ToPoints.TransferInfo_.count(thePt)) {
-      if (0 == ToPoints.TransferInfo_.count(thePt)) 
-        throw std::runtime_error("Key not found in database");
-      else  
+
+  // the search result is turned into stencils once and reused; moving meshes
+  // only refresh the isoparametric coordinates of the pairs found
+  TransferInterpMap &interpMap = ToPoints.interpMap_;
+  if (!interpMap.is_current(fromBulkData, toBulkData)) {
+    typename TransferInterpMap::EntityKeyPairs pairs;
+    pairs.reserve(RangeToDomain.size());
+    typename EntityKeyMap::const_iterator ii;
+    for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) {
+      if (1 != RangeToDomain.count(ii->first))
         throw std::runtime_error("Too many Keys found in database");
+      pairs.emplace_back(ii->first, ii->second);
     }
-    const std::vector<double> &isoParCoords_ = ToPoints.TransferInfo_[thePt];
-    stk::mesh::Entity theNode =   toBulkData.get_entity(thePt);
-    stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);    
-
-    const stk::mesh::Bucket &theBucket = fromBulkData.bucket(theElem);
-    const stk::topology &theElemTopo = theBucket.topology();
-    MasterElement *meSCS = sierra::nalu::MasterElementRepo::get_surface_master_element(theElemTopo);
-
-    stk::mesh::Entity const* elem_node_rels = fromBulkData.begin_nodes(theElem);
-    const int num_nodes = fromBulkData.num_nodes(theElem);
-    const int nodesPerElement = meSCS->nodesPerElement_;
-
-    for (unsigned n=0; n!=FromElem.fromFieldVec_.size(); ++n) {
-
-      // extract field
-      const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
-
-      // FixMe: integers are problematic for now...
-      const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
-      std::vector <double > Coeff(nodesPerElement*sizeOfField);
-
-      // now load the elemental values for future interpolation; fill in connected nodes
-      for ( int ni = 0; ni < num_nodes; ++ni ) { 
-        stk::mesh::Entity node = elem_node_rels[ni];
-
-        const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
-        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, node );
-
-        for ( size_t j = 0; j < sizeOfField; ++j) {
-          const int offSet = j*nodesPerElement + ni; 
-          Coeff[offSet] = theField[j];
-        }   
-      }
-
-      double * toField = (double*)stk::mesh::field_data(*toFieldBaseField, theNode);
-      if (!toField) throw std::runtime_error("Receiving field undefined on mesh object.");
-      meSCS->interpolatePoint(sizeOfField,
-                              &isoParCoords_[0],
-                              &Coeff[0],
-                              toField);
-    }   
+    interpMap.build(fromBulkData, toBulkData, pairs, ToPoints.TransferInfo_);
   }
+  else if (FromElem.fromRealm_.does_mesh_move() || ToPoints.toRealm_.does_mesh_move()) {
+    const double maxBestX = interpMap.update_coordinates(
+      fromBulkData, toBulkData, *FromElem.fromcoordinates_, *ToPoints.tocoordinates_);
+    double g_maxBestX = 0.0;
+    stk::all_reduce_max(FromElem.comm(), &maxBestX, &g_maxBestX, 1);
+    if (g_maxBestX > 1.0 + ToPoints.radius_)
+      NaluEnv::self().naluOutputP0()
+        << "XFER::LinInterp::apply() Warning: points have moved out of their elements,"
+        << " maximum normalized distance is: " << g_maxBestX << std::endl;
+  }
+
+  interpMap.apply(fromBulkData, toBulkData, FromElem.fromFieldVec_, ToPoints.toFieldVec_);
 }
 
 } // namespace nalu
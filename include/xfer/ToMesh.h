@@ -26,6 +26,10 @@
 #include <stk_search/BoundingBox.hpp>
 
 #include <FieldTypeDef.h>
+#include <xfer/TransferInterpMap.h>
+#include <utils/SyncAudit.h>
+
+#include <stk_mesh/base/GetNgpField.hpp>
 
 // stk
 namespace stk {
@@ -183,8 +187,15 @@ public :
 
   void update_values()
   {
+    // the interpolated values are on device
+    for (const auto* fld : toFieldVec_) {
+      auto& ngpFld = stk::mesh::get_updated_ngp_field<double>(*fld);
+      NALU_SYNC_TO_HOST(ngpFld);
+    }
     std::vector<const stk::mesh::FieldBase *> fields(toFieldVec_.begin(), toFieldVec_.end());
     stk::mesh::copy_owned_to_shared  (  toBulkData_, fields);
+    for (const auto* fld : toFieldVec_)
+      stk::mesh::get_updated_ngp_field<double>(*fld).modify_on_host();
   }
   
   stk::mesh::MetaData &toMetaData_;
@@ -199,6 +210,9 @@ public :
   typedef std::map<stk::mesh::EntityKey, std::vector<double> > TransferInfo;
   TransferInfo TransferInfo_;
 
+  //! Stencils of the search result, reused by every execution
+  TransferInterpMap interpMap_;
+
 };
 
 } // namespace nalu
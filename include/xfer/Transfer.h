@@ -36,6 +36,7 @@ namespace nalu{
 class Realm;
 class Transfers;
 class Simulation;
+class BoundaryPlaneChannel;
 
 class Transfer
 {
@@ -51,6 +52,8 @@ public:
   void initialize_end();
   void execute();
 
+  // post the current level of a boundary_plane transfer
+  void publish();
 
   Simulation *root();
   Transfers *parent();
@@ -72,6 +75,11 @@ public:
   std::string searchMethodName_;
   double searchTolerance_;
   double searchExpansionFactor_;
+
+  // boundary_plane objective: time staggering and levels kept
+  double timeLag_;
+  int bufferedLevels_;
+  std::unique_ptr<BoundaryPlaneChannel> channel_;
   std::pair<std::string, std::string> realmPairName_;
   
   // allow the user to provide a vector "from" and "to" parts; names
@@ -0,0 +1,106 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef TransferInterpMap_h
+#define TransferInterpMap_h
+
+#include <KokkosInterface.h>
+#include <FieldTypeDef.h>
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/EntityKey.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+/** Persistent interpolation stencils of a transfer
+ *
+ *  For every target node found by the search, the nodes of the source
+ *  element containing it and their shape function values at the
+ *  isoparametric coordinates of the fine search. The stencils are built on
+ *  host from the result of the search the first time the transfer is applied,
+ *  copied to device and reused by every later execution; they are rebuilt
+ *  when either mesh is modified. On moving meshes the isoparametric
+ *  coordinates of the stored pairs are recomputed from the current
+ *  coordinates before each execution, without a new search.
+ */
+class TransferInterpMap
+{
+public:
+  static constexpr int maxNodes = 27;
+
+  using EntityKeyPairs =
+    std::vector<std::pair<stk::mesh::EntityKey, stk::mesh::EntityKey>>;
+  using IsoParCoords = std::map<stk::mesh::EntityKey, std::vector<double>>;
+
+  //! Store the (target node, source element) pairs of the search and stencils
+  void build(
+    const stk::mesh::BulkData& fromBulk,
+    const stk::mesh::BulkData& toBulk,
+    const EntityKeyPairs& pairs,
+    const IsoParCoords& isoParCoords);
+
+  //! True when the stencils were built for the current meshes
+  bool is_current(
+    const stk::mesh::BulkData& fromBulk,
+    const stk::mesh::BulkData& toBulk) const;
+
+  /** Recompute the isoparametric coordinates of the stored pairs
+   *
+   *  @return The maximum normalized distance of the target nodes from their
+   *  elements, unity or less while no node has left its element
+   */
+  double update_coordinates(
+    const stk::mesh::BulkData& fromBulk,
+    const stk::mesh::BulkData& toBulk,
+    const VectorFieldType& fromCoords,
+    const VectorFieldType& toCoords);
+
+  //! Interpolate every source field to the matching target field on device
+  void apply(
+    const stk::mesh::BulkData& fromBulk,
+    const stk::mesh::BulkData& toBulk,
+    const std::vector<const stk::mesh::FieldBase*>& fromFields,
+    const std::vector<const stk::mesh::FieldBase*>& toFields);
+
+private:
+  void compute_stencils(
+    const stk::mesh::BulkData& fromBulk,
+    const stk::mesh::BulkData& toBulk);
+
+  std::vector<stk::mesh::Entity> toNodesHost_;
+  std::vector<stk::mesh::Entity> fromElemsHost_;
+  std::vector<double> isoParCoordsHost_;
+
+  Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace> toNodes_;
+  Kokkos::View<stk::mesh::FastMeshIndex* [maxNodes], MemSpace> fromNodes_;
+  Kokkos::View<double* [maxNodes], MemSpace> weights_;
+  Kokkos::View<int*, MemSpace> numNodes_;
+
+  size_t fromSyncCount_{0};
+  size_t toSyncCount_{0};
+  bool built_{false};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
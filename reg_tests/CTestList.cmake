@@ -153,6 +153,36 @@ function(add_test_r_cat testname np ncat)
     endif()
 endfunction(add_test_r_cat)
 
+# Scaling performance test on a generated mesh; the deck is configured from
+# test_files/<testname>/<testname>.template.yaml and the run is summarized in
+# <testname>.perf.json by perf_report.py
+function(add_test_p_scaling testname np mesh suffix)
+    set(perfname "${testname}${suffix}Np${np}")
+    set(TEST_WORKING_DIR "${CMAKE_CURRENT_BINARY_DIR}/perf_tests/${perfname}")
+    file(MAKE_DIRECTORY ${TEST_WORKING_DIR})
+    set(PERF_TEST_MESH "${mesh}")
+    set(PERF_TEST_STEPS "${NALU_PERF_TEST_STEPS}")
+    set(PERF_TEST_HYPRE_SETTINGS "${CMAKE_CURRENT_SOURCE_DIR}/hypre_settings")
+    configure_file(${CMAKE_CURRENT_SOURCE_DIR}/test_files/${testname}/${testname}.template.yaml
+                   ${TEST_WORKING_DIR}/${perfname}.yaml @ONLY)
+    set(MPI_COMMAND "${MPIEXEC_EXECUTABLE} ${MPIEXEC_NUMPROC_FLAG} ${np} ${MPIEXEC_PREFLAGS} ${CMAKE_BINARY_DIR}/${nalu_ex_name} ${MPIEXEC_POSTFLAGS}")
+    set(REPORT_COMMAND "python3 ${CMAKE_CURRENT_SOURCE_DIR}/perf_report.py ${perfname} ${perfname}.log --np ${np} --mesh ${mesh}")
+    add_test(${perfname} sh -c "${MPI_COMMAND} -i ${perfname}.yaml -o ${perfname}.log && ${REPORT_COMMAND}")
+    set_tests_properties(${perfname} PROPERTIES TIMEOUT 20000 PROCESSORS ${np} WORKING_DIRECTORY "${TEST_WORKING_DIR}" LABELS "performance")
+endfunction(add_test_p_scaling)
+
+# Weak (fixed cells per rank, the domain is extended along x) and strong
+# (fixed global mesh) scaling runs of a deck over NALU_PERF_TEST_RANKS
+function(add_test_p_scaling_suite testname)
+    foreach(np ${NALU_PERF_TEST_RANKS})
+      set(n ${NALU_PERF_TEST_WEAK_SIZE})
+      math(EXPR nx "${n} * ${np}")
+      add_test_p_scaling(${testname} ${np} "${nx}x${n}x${n}" "Weak")
+      set(n ${NALU_PERF_TEST_STRONG_SIZE})
+      add_test_p_scaling(${testname} ${np} "${n}x${n}x${n}" "Strong")
+    endforeach()
+endfunction(add_test_p_scaling_suite)
+
 if(NOT ENABLE_CUDA)
 
   #=============================================================================
@@ -297,3 +327,12 @@ else(NOT ENABLE_CUDA)
   add_test_u_gpu(unitTestGPU 1)
 
 endif(NOT ENABLE_CUDA)
+
+#=============================================================================
+# Scaling performance tests
+#=============================================================================
+if(ENABLE_PERF_TESTS)
+  if(ENABLE_HYPRE)
+    add_test_p_scaling_suite(ablNeutralPerf)
+  endif()
+endif(ENABLE_PERF_TESTS)
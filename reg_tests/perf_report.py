@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+Collect the results of a scaling performance test into a JSON report
+
+The report holds the run configuration (test name, number of ranks, mesh),
+the number of time steps completed, the per equation system timings and
+linear iteration counts printed at the end of the Nalu-Wind log, and the
+timer tree written through the ``timer_tree_output`` input option. Reports
+from different builds or node counts can be compared entry by entry.
+"""
+
+import sys
+import os
+import re
+import json
+import argparse
+
+def parse_arguments():
+    """Parse command line arguments"""
+    parser = argparse.ArgumentParser(
+        description="Nalu-Wind scaling performance report utility")
+    parser.add_argument(
+        "test_name", help="Performance test name")
+    parser.add_argument(
+        "log_file", help="Nalu-Wind log file of the run")
+    parser.add_argument(
+        '--timer-tree', default="timers.json",
+        help="Timer tree JSON file written by the run")
+    parser.add_argument(
+        '--np', type=int, default=1, help="Number of MPI ranks")
+    parser.add_argument(
+        '--mesh', default="", help="Mesh description of the run")
+    parser.add_argument(
+        '--output', default=None,
+        help="Report file (default: <test_name>.perf.json)")
+    return parser.parse_args()
+
+def parse_log(log_file):
+    """Extract the step count and the equation system summaries"""
+    num_steps = 0
+    equations = {}
+    current = None
+    stat_re = re.compile(
+        r"^\s*([\w ]+?)\s+--\s+(.*)$")
+    value_re = re.compile(r"(\w+):\s+([-+0-9.eE]+)")
+    with open(log_file, 'r') as fh:
+        for line in fh:
+            if line.startswith("Mean System Norm:"):
+                num_steps += 1
+                continue
+            if line.startswith("Timing for Eq:"):
+                current = line.split(":", 1)[1].strip()
+                equations[current] = {}
+                continue
+            if current is None:
+                continue
+            match = stat_re.match(line)
+            if match is None:
+                current = None
+                continue
+            key = match.group(1).strip().replace(" ", "_")
+            values = dict((k, float(v))
+                          for k, v in value_re.findall(match.group(2)))
+            equations[current][key] = values
+    return num_steps, equations
+
+def main():
+    """Driver function"""
+    args = parse_arguments()
+    if not os.path.isfile(args.log_file):
+        print("Log file %s does not exist"%args.log_file)
+        sys.exit(1)
+
+    num_steps, equations = parse_log(args.log_file)
+    report = {
+        "test_name": args.test_name,
+        "num_ranks": args.np,
+        "mesh": args.mesh,
+        "num_steps": num_steps,
+        "equation_systems": equations,
+    }
+    if os.path.isfile(args.timer_tree):
+        with open(args.timer_tree, 'r') as fh:
+            report["timer_tree"] = json.load(fh)
+
+    output = args.output or (args.test_name + ".perf.json")
+    with open(output, 'w') as fh:
+        json.dump(report, fh, indent=2, sort_keys=True)
+
+    if num_steps == 0:
+        print("No time steps found in %s"%args.log_file)
+        sys.exit(1)
+    print("Wrote %s: %d steps on %d ranks"%(output, num_steps, args.np))
+
+if __name__ == "__main__":
+    main()
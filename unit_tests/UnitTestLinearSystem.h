@@ -118,7 +118,7 @@ void resetRows(unsigned /*numNodes*/,
   void free_device_pointer()
   {
     if (this != devicePointer_) {
-      sierra::nalu::kokkos_free_on_device(devicePointer_);
+      sierra::nalu::pool_free_on_device(devicePointer_);
       devicePointer_ = nullptr;
     }
   }
@@ -126,7 +126,7 @@ void resetRows(unsigned /*numNodes*/,
   sierra::nalu::CoeffApplier* device_pointer()
   {
     if (devicePointer_ != nullptr) {
-      sierra::nalu::kokkos_free_on_device(devicePointer_);
+      sierra::nalu::pool_free_on_device(devicePointer_);
       devicePointer_ = nullptr;
     }
     devicePointer_ = sierra::nalu::create_device_expression(*this);
@@ -0,0 +1,71 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef UNITTESTTHROUGHPUTUTILS_H
+#define UNITTESTTHROUGHPUTUTILS_H
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace unit_test_utils {
+
+/** Elements per direction of the meshes used by the throughput tests
+ *
+ *  Read from NALU_THROUGHPUT_MESH_SIZE so that a regular test run stays
+ *  cheap while a benchmark run can use a mesh that exceeds the caches.
+ */
+inline int throughput_mesh_size(const int defaultSize = 8)
+{
+  const char* env = std::getenv("NALU_THROUGHPUT_MESH_SIZE");
+  const int size = (env != nullptr) ? std::atoi(env) : defaultSize;
+  return std::max(size, 1);
+}
+
+/** Print the throughput of a kernel that processed numEntities per pass
+ *
+ *  With a model of the bytes moved and the floating point operations per
+ *  entity, the achieved GB/s and GFLOP/s are also reported, and the fraction
+ *  of the memory bandwidth roof when NALU_THROUGHPUT_PEAK_GBS is set.
+ */
+inline void report_throughput(
+  const std::string& name,
+  const double numEntities,
+  const int numIt,
+  const double elapsed,
+  const double bytesPerEntity = 0.0,
+  const double flopsPerEntity = 0.0)
+{
+  const double time = std::max(elapsed, 1.0e-12);
+  const double rate = numEntities * numIt / time;
+
+  std::cout << name << " [" << Kokkos::DefaultExecutionSpace::name()
+            << "]: " << rate << " entities/s";
+  if (bytesPerEntity > 0.0) {
+    const double gbs = rate * bytesPerEntity * 1.0e-9;
+    std::cout << ", " << gbs << " GB/s";
+    if (flopsPerEntity > 0.0)
+      std::cout << ", " << rate * flopsPerEntity * 1.0e-9 << " GFLOP/s"
+                << ", intensity " << flopsPerEntity / bytesPerEntity
+                << " flop/byte";
+
+    const char* peak = std::getenv("NALU_THROUGHPUT_PEAK_GBS");
+    if (peak != nullptr && std::atof(peak) > 0.0)
+      std::cout << ", " << 100.0 * gbs / std::atof(peak)
+                << "% of the bandwidth roof";
+  }
+  std::cout << std::endl;
+}
+
+}  // namespace unit_test_utils
+
+#endif /* UNITTESTTHROUGHPUTUTILS_H */
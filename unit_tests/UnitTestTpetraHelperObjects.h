@@ -261,6 +261,8 @@ struct TpetraHelperObjectsEdge : public TpetraHelperObjectsBase {
     ThrowRequire(edgeAlg != nullptr);
     linsys->buildEdgeToNodeGraph({&realm.metaData_->universal_part()});
     linsys->finalizeLinearSystem();
+    if (useScatterMap)
+      linsys->buildEdgeScatterMap();
 
     edgeAlg->execute();
 
@@ -272,6 +274,8 @@ struct TpetraHelperObjectsEdge : public TpetraHelperObjectsBase {
   }
 
   sierra::nalu::AssembleEdgeSolverAlgorithm* edgeAlg;
+  //! assemble through the precomputed CSR offsets of the edges
+  bool useScatterMap{false};
 };
 
 }
@@ -23,6 +23,7 @@
 #include "AlgTraits.h"
 #include "KokkosInterface.h"
 #include "TimeIntegrator.h"
+#include "ngp_algorithms/WallFuncGeometryAlg.h"
 
 #include <gtest/gtest.h>
 
@@ -148,6 +149,11 @@ void calc_exposed_area_vec(
   const VectorFieldType& coordinates,
   GenericFieldType& exposedAreaVec);
 
+void calc_wall_face_geometry(
+  const stk::mesh::BulkData& bulk,
+  const GenericFieldType& exposedAreaVec,
+  GenericFieldType& wallFaceGeom);
+
 void calc_mass_flow_rate(
   const stk::mesh::BulkData&,
   const VectorFieldType&,
@@ -288,10 +294,16 @@ public:
 
   virtual ~TestKernelHex8Mesh() {}
 
+  //! Generated mesh description, one element per rank unless overridden
+  virtual std::string mesh_spec() const
+  {
+    return "generated:1x1x" + std::to_string(bulk_.parallel_size());
+  }
+
   virtual void fill_mesh_and_init_fields(
     const bool doPerturb = false, const bool generateSidesets = false)
   {
-    std::string meshSpec = "generated:1x1x" + std::to_string(bulk_.parallel_size());
+    std::string meshSpec = mesh_spec();
     if (generateSidesets)  meshSpec += "|sideset:xXyYzZ";
     unit_test_utils::fill_hex8_mesh(meshSpec, bulk_);
     if (doPerturb) {
@@ -555,8 +567,14 @@ public:
                      meta_.side_rank(), "wall_friction_velocity_bip")),
       wallNormDist_(&meta_.declare_field<ScalarFieldType>(
                       meta_.side_rank(), "wall_normal_distance_bip")),
+      wallFaceGeom_(&meta_.declare_field<GenericFieldType>(
+                      meta_.side_rank(), "wall_face_geometry_bip")),
       tGradBC_(&meta_.declare_field<ScalarFieldType>(
                  stk::topology::NODE_RANK, "temperature_gradient_bc")),
+      ablHeightIndex_(&meta_.declare_field<ScalarIntFieldType>(
+                        stk::topology::NODE_RANK, "abl_forcing_height_index")),
+      ablHeightWeight_(&meta_.declare_field<ScalarFieldType>(
+                         stk::topology::NODE_RANK, "abl_forcing_height_weight")),
       ustar_(kappa_ * uh_ / std::log(zh_ / z0_))
   {
 
@@ -566,7 +584,12 @@ public:
     stk::mesh::put_field_on_mesh(*specificHeat_, meta_.universal_part(), 1, nullptr);
     stk::mesh::put_field_on_mesh(*wallFricVel_, meta_.universal_part(), 4, nullptr);
     stk::mesh::put_field_on_mesh(*wallNormDist_, meta_.universal_part(), 4, nullptr);
+    stk::mesh::put_field_on_mesh(
+      *wallFaceGeom_, meta_.universal_part(),
+      4 * sierra::nalu::wall_face_geometry_bip_size(spatialDim_), nullptr);
     stk::mesh::put_field_on_mesh(*tGradBC_, meta_.universal_part(), 1, nullptr);
+    stk::mesh::put_field_on_mesh(*ablHeightIndex_, meta_.universal_part(), 2, nullptr);
+    stk::mesh::put_field_on_mesh(*ablHeightWeight_, meta_.universal_part(), 2, nullptr);
   }
 
   virtual ~MomentumABLKernelHex8Mesh() = default;
@@ -601,6 +624,9 @@ public:
     wallNormDist_->modify_on_host();
     wallNormDist_->sync_to_device();
 
+    unit_test_kernel_utils::calc_wall_face_geometry(
+      bulk_, *exposedAreaVec_, *wallFaceGeom_);
+
     stk::mesh::field_fill(-0.003, *tGradBC_);
     tGradBC_->modify_on_host();
     tGradBC_->sync_to_device();
@@ -611,7 +637,10 @@ public:
   ScalarFieldType* specificHeat_{nullptr};
   ScalarFieldType* wallFricVel_{nullptr};
   ScalarFieldType* wallNormDist_{nullptr};
+  GenericFieldType* wallFaceGeom_{nullptr};
   ScalarFieldType* tGradBC_{nullptr};
+  ScalarIntFieldType* ablHeightIndex_{nullptr};
+  ScalarFieldType* ablHeightWeight_{nullptr};
 
   const double z0_{0.1};
   const double zh_{0.25};
@@ -623,7 +652,22 @@ public:
 };
 
 class MomentumNodeHex8Mesh : public MomentumKernelHex8Mesh
-{};
+{
+public:
+  MomentumNodeHex8Mesh()
+    : MomentumKernelHex8Mesh(),
+      ablHeightIndex_(&meta_.declare_field<ScalarIntFieldType>(
+                        stk::topology::NODE_RANK, "abl_forcing_height_index")),
+      ablHeightWeight_(&meta_.declare_field<ScalarFieldType>(
+                         stk::topology::NODE_RANK, "abl_forcing_height_weight"))
+  {
+    stk::mesh::put_field_on_mesh(*ablHeightIndex_, meta_.universal_part(), 2, nullptr);
+    stk::mesh::put_field_on_mesh(*ablHeightWeight_, meta_.universal_part(), 2, nullptr);
+  }
+
+  ScalarIntFieldType* ablHeightIndex_{nullptr};
+  ScalarFieldType* ablHeightWeight_{nullptr};
+};
 
 class EnthalpyABLKernelHex8Mesh : public MomentumABLKernelHex8Mesh
 {
@@ -703,6 +747,10 @@ public:
         stk::topology::NODE_RANK, "assembled_wall_area_sdr")),
       wallFricVel_(&meta_.declare_field<GenericFieldType>(
         meta_.side_rank(), "wall_friction_velocity_bip")),
+      wallNormDist_(&meta_.declare_field<GenericFieldType>(
+        meta_.side_rank(), "wall_normal_distance_bip")),
+      wallFaceGeom_(&meta_.declare_field<GenericFieldType>(
+        meta_.side_rank(), "wall_face_geometry_bip")),
       pecletFactor_(&meta_.declare_field<ScalarFieldType>(stk::topology::EDGE_RANK, "peclet_factor"))
   {
     stk::mesh::put_field_on_mesh(*tke_, meta_.universal_part(), 1, nullptr);
@@ -731,6 +779,10 @@ public:
     stk::mesh::put_field_on_mesh(*sdrWallbc_, meta_.universal_part(), 1, nullptr);
     stk::mesh::put_field_on_mesh(*sdrWallArea_, meta_.universal_part(), 1, nullptr);
     stk::mesh::put_field_on_mesh(*wallFricVel_, meta_.universal_part(), 4, nullptr);
+    stk::mesh::put_field_on_mesh(*wallNormDist_, meta_.universal_part(), 4, nullptr);
+    stk::mesh::put_field_on_mesh(
+      *wallFaceGeom_, meta_.universal_part(),
+      4 * sierra::nalu::wall_face_geometry_bip_size(spatialDim_), nullptr);
     stk::mesh::put_field_on_mesh(*pecletFactor_, meta_.universal_part(), 1, nullptr);
   }
 
@@ -754,6 +806,8 @@ public:
     stk::mesh::field_fill(0.0, *dkdx_);
     stk::mesh::field_fill(0.0, *dwdx_);
     stk::mesh::field_fill(0.0, *pecletFactor_);
+    unit_test_kernel_utils::calc_wall_face_geometry(
+      bulk_, *exposedAreaVec_, *wallFaceGeom_);
   }
 
   ScalarFieldType* tke_{nullptr};
@@ -773,6 +827,8 @@ public:
   ScalarFieldType* sdrWallbc_{nullptr};
   ScalarFieldType* sdrWallArea_{nullptr};
   GenericFieldType* wallFricVel_{nullptr};
+  GenericFieldType* wallNormDist_{nullptr};
+  GenericFieldType* wallFaceGeom_{nullptr};
   ScalarFieldType* pecletFactor_ {nullptr};
 };
 
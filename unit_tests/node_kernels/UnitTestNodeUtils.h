@@ -14,6 +14,12 @@
 #include "wind_energy/ABLForcingAlgorithm.h"
 #include "Realm.h"
 
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/FieldBase.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+
+#include <vector>
+
 namespace unit_test_utils {
 
 class TestABLForcingAlg : public sierra::nalu::ABLForcingAlgorithm
@@ -33,6 +39,66 @@ public:
   }
 };
 
+/** Cube of edge `h` at `origin` on which the gold values of the former
+ *  supplemental source algorithms are given, one per corner with x fastest
+ *
+ *  The cube is away from the zeros and extrema of the manufactured solutions.
+ */
+namespace shrunk_cube {
+constexpr double h = 0.01;
+constexpr double origin[3] = {0.0025, 0.005, 0.0075};
+}
+
+//! Move the unit cube of a one element mesh to the shrunk cube
+inline void
+shrink_unit_cube(stk::mesh::BulkData& bulk)
+{
+  const double h = shrunk_cube::h;
+  const double* origin = shrunk_cube::origin;
+  auto& coords = *bulk.mesh_meta_data().coordinate_field();
+  for (const auto* b : bulk.get_buckets(
+         stk::topology::NODE_RANK, bulk.mesh_meta_data().universal_part())) {
+    for (const auto node : *b) {
+      double* x = static_cast<double*>(stk::mesh::field_data(coords, node));
+      for (int d = 0; d < 3; ++d)
+        x[d] = origin[d] + h * x[d];
+    }
+  }
+  coords.modify_on_host();
+  coords.sync_to_device();
+}
+
+/** Right-hand side of a node kernel on the shrunk cube
+ *
+ *  `golds` holds the contributions of the eight corners, x fastest, and is
+ *  scattered in the node order of the test linear system.
+ */
+template <int numDof>
+std::vector<double>
+shrunk_cube_rhs(
+  const stk::mesh::BulkData& bulk, const double (*golds)[numDof])
+{
+  const double h = shrunk_cube::h;
+  const double* origin = shrunk_cube::origin;
+  const auto& coords = *bulk.mesh_meta_data().coordinate_field();
+  std::vector<double> rhs(8 * numDof, 0.0);
+  for (const auto* b : bulk.get_buckets(
+         stk::topology::NODE_RANK, bulk.mesh_meta_data().universal_part())) {
+    for (const auto node : *b) {
+      const double* x =
+        static_cast<const double*>(stk::mesh::field_data(coords, node));
+      int corner = 0;
+      for (int d = 0; d < 3; ++d)
+        if (x[d] - origin[d] > 0.5 * h)
+          corner += 1 << d;
+      const auto offset = (node.local_offset() - 1) * numDof;
+      for (int i = 0; i < numDof; ++i)
+        rhs[offset + i] = golds[corner][i];
+    }
+  }
+  return rhs;
+}
+
 }
 
 #endif /* UNITTESTNODEUTILS_H */